@@ -3,6 +3,31 @@
 
 #pragma once
 
+// Maps a key to the value the HashMap hashes and compares on. For reference types this is the
+// IUnknown identity, which is what winrt's operator== compares, so two different interface
+// pointers to the same object find the same entry.
+template <typename K>
+struct HashMapKeyTraits
+{
+    using identity_type = void*;
+
+    static identity_type Identity(K const& key)
+    {
+        return key ? winrt::get_abi(key.as<winrt::IUnknown>()) : nullptr;
+    }
+};
+
+template <>
+struct HashMapKeyTraits<winrt::hstring>
+{
+    using identity_type = winrt::hstring;
+
+    static identity_type const& Identity(winrt::hstring const& key)
+    {
+        return key;
+    }
+};
+
 template <typename K, typename V>
 class HashMap :
     public ReferenceTracker<
@@ -15,7 +40,11 @@ class HashMap :
     using V_storage = tracker_ref<V>;
     typedef typename winrt::IKeyValuePair<K, V> KVP;
 
-    typedef typename std::map<K_storage, V_storage>::const_iterator T_iterator;
+    // The key is stored unwrapped as the hash table key so lookups don't need to create a
+    // tracker_ref, the tracker_ref copy next to the value keeps the key alive.
+    using K_identity = typename HashMapKeyTraits<K>::identity_type;
+    using T_map = std::unordered_map<K_identity, std::pair<K_storage, V_storage>>;
+    typedef typename T_map::const_iterator T_iterator;
 
 public:
 #pragma region IMap(View)<K, V> interface
@@ -24,7 +53,7 @@ public:
         auto it = FindKey(key);
         if (it != m_map.end())
         {
-            return it->second.get();
+            return it->second.second.get();
         }
         else
         {
@@ -54,11 +83,13 @@ public:
         bool found = (it != m_map.end());
         if (found)
         {
-            it->second = tracker_ref<V>{ this, value };
+            it->second.second = tracker_ref<V>{ this, value };
         }
         else
         {
-            m_map.insert(std::make_pair(tracker_ref<K>{ this, key }, tracker_ref<V>{ this, value }));
+            m_map.emplace(
+                HashMapKeyTraits<K>::Identity(key),
+                std::make_pair(tracker_ref<K>{ this, key }, tracker_ref<V>{ this, value }));
         }
 
         return found;
@@ -113,7 +144,7 @@ public:
 private:
     auto FindKey(K const& key)
     {
-        return std::find_if(m_map.begin(), m_map.end(), [&key](const auto& entry) { return entry.first == key; });
+        return m_map.find(HashMapKeyTraits<K>::Identity(key));
     }
 
     class Iterator :
@@ -135,7 +166,7 @@ private:
 
             if (m_iterator != m_map.get()->End())
             {
-                return winrt::make<KeyValuePair>(m_iterator->first.get(), m_iterator->second.get());
+                return winrt::make<KeyValuePair>(m_iterator->second.first.get(), m_iterator->second.second.get());
             }
             else
             {
@@ -222,6 +253,6 @@ private:
         };
     };
 
-    std::map<K_storage, V_storage> m_map;
+    T_map m_map;
     unsigned int m_mutationCount = 0;
 };
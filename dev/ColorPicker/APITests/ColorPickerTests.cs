@@ -6,6 +6,7 @@ using MUXControlsTestApp.Utilities;
 using System;
 using System.Numerics;
 using System.Collections;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.Foundation;
@@ -31,6 +32,7 @@ using ColorSpectrumComponents = Microsoft.UI.Xaml.Controls.ColorSpectrumComponen
 using ColorPicker = Microsoft.UI.Xaml.Controls.ColorPicker;
 using ColorChangedEventArgs = Microsoft.UI.Xaml.Controls.ColorChangedEventArgs;
 using ColorSpectrum = Microsoft.UI.Xaml.Controls.Primitives.ColorSpectrum;
+using ColorSpectrumTestHooks = Microsoft.UI.Private.Controls.ColorSpectrumTestHooks;
 using XamlControlsXamlMetaDataProvider = Microsoft.UI.Xaml.XamlTypeInfo.XamlControlsXamlMetaDataProvider;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
@@ -264,6 +266,235 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             SetAsRootAndWaitForColorSpectrumFill(colorSpectrum);
         }
 
+        [TestMethod]
+        public void MeasureSpectrumBitmapGeneration()
+        {
+            // Generates a large spectrum for every shape and component combination and logs how long each took
+            // from being put in the tree to the spectrum being filled in.
+            foreach (ColorSpectrumShape shape in new[] { ColorSpectrumShape.Box, ColorSpectrumShape.Ring })
+            {
+                foreach (ColorSpectrumComponents components in Enum.GetValues(typeof(ColorSpectrumComponents)))
+                {
+                    ColorSpectrum colorSpectrum = null;
+
+                    RunOnUIThread.Execute(() =>
+                    {
+                        colorSpectrum = new ColorSpectrum {
+                            Width = 1000,
+                            Height = 1000,
+                            Shape = shape,
+                            Components = components
+                        };
+                    });
+
+                    var stopwatch = Stopwatch.StartNew();
+                    SetAsRootAndWaitForColorSpectrumFill(colorSpectrum);
+                    stopwatch.Stop();
+
+                    Log.Comment("{0} {1}: {2} ms", shape, components, stopwatch.Elapsed.TotalMilliseconds);
+                }
+            }
+        }
+
+        [TestMethod]
+        public void ValidateSpectrumWithSameParametersReusesBitmaps()
+        {
+            // The second spectrum matches the first one's shape, components, size and ranges,
+            // so it should be filled from the pixel data generated for the first one.
+            var fillTimes = new double[2];
+
+            for (int i = 0; i < fillTimes.Length; i++)
+            {
+                ColorSpectrum colorSpectrum = null;
+
+                RunOnUIThread.Execute(() =>
+                {
+                    colorSpectrum = new ColorSpectrum {
+                        Width = 800,
+                        Height = 800,
+                        Shape = ColorSpectrumShape.Ring,
+                        Components = ColorSpectrumComponents.SaturationValue,
+                        MinHue = 20,
+                        MaxHue = 300
+                    };
+                });
+
+                var stopwatch = Stopwatch.StartNew();
+                SetAsRootAndWaitForColorSpectrumFill(colorSpectrum);
+                stopwatch.Stop();
+                fillTimes[i] = stopwatch.Elapsed.TotalMilliseconds;
+            }
+
+            Log.Comment("Generated: {0} ms, reused: {1} ms", fillTimes[0], fillTimes[1]);
+        }
+
+        [TestMethod]
+        public void ValidateSpectrumRowsMatchPerPixelMath()
+        {
+            // Bitmap generation and hit-testing fill whole rows at a time. Validate them against
+            // the per-pixel math the spectrum used before it did that.
+            const int pixelWidth = 37;
+
+            RunOnUIThread.Execute(() =>
+            {
+                var colorSpectrum = new ColorSpectrum {
+                    MinHue = 20,
+                    MaxHue = 300,
+                    MinSaturation = 10,
+                    MaxValue = 90
+                };
+
+                foreach (ColorSpectrumShape shape in Enum.GetValues(typeof(ColorSpectrumShape)))
+                {
+                    foreach (ColorSpectrumComponents components in Enum.GetValues(typeof(ColorSpectrumComponents)))
+                    {
+                        colorSpectrum.Shape = shape;
+                        colorSpectrum.Components = components;
+                        Log.Comment("Shape = {0}, Components = {1}", shape, components);
+
+                        for (int row = 0; row < pixelWidth; row++)
+                        {
+                            var rowValues = ColorSpectrumTestHooks.GetSpectrumRowHsvValues(colorSpectrum, pixelWidth, row);
+                            Verify.AreEqual(pixelWidth * 3, rowValues.Length);
+
+                            for (int column = 0; column < pixelWidth; column++)
+                            {
+                                var expected = GetExpectedSpectrumPixelHsv(shape, components, pixelWidth, column, row, 20, 300, 10, 100, 0, 90);
+                                for (int i = 0; i < 3; i++)
+                                {
+                                    if (Math.Abs(expected[i] - rowValues[column * 3 + i]) > 1e-9)
+                                    {
+                                        Verify.Fail(string.Format("Pixel ({0}, {1}) component {2}: expected {3}, actual {4}",
+                                            column, row, i, expected[i], rowValues[column * 3 + i]));
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        // The hue, saturation and value at a pixel of the spectrum, computed one pixel at a time the way
+        // ColorSpectrum's FillPixelForBox and FillPixelForRing used to. The third dimension is at its minimum.
+        private static double[] GetExpectedSpectrumPixelHsv(
+            ColorSpectrumShape shape,
+            ColorSpectrumComponents components,
+            int pixelWidth,
+            int column,
+            int row,
+            double minHue,
+            double maxHue,
+            double minSaturation,
+            double maxSaturation,
+            double minValue,
+            double maxValue)
+        {
+            double hMin = minHue;
+            double hMax = maxHue;
+            double sMin = minSaturation / 100.0;
+            double sMax = maxSaturation / 100.0;
+            double vMin = minValue / 100.0;
+            double vMax = maxValue / 100.0;
+
+            // The percents along the first and second axes of the components.
+            double firstPercent;
+            double secondPercent;
+
+            if (shape == ColorSpectrumShape.Box)
+            {
+                // The box used to be generated from the bottom right corner with the columns
+                // and rows swapped, so x and y are the mirrored row and column.
+                double minDimension = pixelWidth;
+                double x = minDimension - 1 - row;
+                double y = minDimension - 1 - column;
+                double xPercent = (minDimension - 1 - x) / (minDimension - 1);
+                double yPercent = (minDimension - 1 - y) / (minDimension - 1);
+                firstPercent = yPercent;
+                secondPercent = xPercent;
+            }
+            else
+            {
+                double radius = pixelWidth / 2.0;
+                double x = column;
+                double y = row;
+                double distanceFromRadius = Math.Sqrt(Math.Pow(x - radius, 2) + Math.Pow(y - radius, 2));
+
+                double xToUse = x;
+                double yToUse = y;
+
+                if (distanceFromRadius > radius)
+                {
+                    xToUse = (radius / distanceFromRadius) * (x - radius) + radius;
+                    yToUse = (radius / distanceFromRadius) * (y - radius) + radius;
+                    distanceFromRadius = radius;
+                }
+
+                double r = 1 - distanceFromRadius / radius;
+
+                double theta = Math.Atan2((radius - yToUse), (radius - xToUse)) * 180.0 / Math.PI;
+                theta += 180.0;
+                theta = Math.Floor(theta);
+
+                while (theta > 360)
+                {
+                    theta -= 360;
+                }
+
+                firstPercent = theta / 360;
+                secondPercent = r;
+            }
+
+            double h = 0;
+            double s = 0;
+            double v = 0;
+
+            switch (components)
+            {
+                case ColorSpectrumComponents.HueValue:
+                    h = hMin + firstPercent * (hMax - hMin);
+                    v = vMin + secondPercent * (vMax - vMin);
+                    break;
+
+                case ColorSpectrumComponents.HueSaturation:
+                    h = hMin + firstPercent * (hMax - hMin);
+                    s = sMin + secondPercent * (sMax - sMin);
+                    break;
+
+                case ColorSpectrumComponents.ValueHue:
+                    v = vMin + firstPercent * (vMax - vMin);
+                    h = hMin + secondPercent * (hMax - hMin);
+                    break;
+
+                case ColorSpectrumComponents.ValueSaturation:
+                    v = vMin + firstPercent * (vMax - vMin);
+                    s = sMin + secondPercent * (sMax - sMin);
+                    break;
+
+                case ColorSpectrumComponents.SaturationHue:
+                    s = sMin + firstPercent * (sMax - sMin);
+                    h = hMin + secondPercent * (hMax - hMin);
+                    break;
+
+                case ColorSpectrumComponents.SaturationValue:
+                    s = sMin + firstPercent * (sMax - sMin);
+                    v = vMin + secondPercent * (vMax - vMin);
+                    break;
+            }
+
+            if (components == ColorSpectrumComponents.HueSaturation ||
+                components == ColorSpectrumComponents.SaturationHue)
+            {
+                s = sMax - s + sMin;
+            }
+            else
+            {
+                v = vMax - v + vMin;
+            }
+
+            return new double[] { h, s, v };
+        }
+
         // XamlControlsXamlMetaDataProvider does not exist in the OS repo,
         // so we can't execute this test as authored there.
         [TestMethod]
@@ -304,6 +535,12 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                     var spectrumRectangle = VisualTreeUtils.FindVisualChildByName(element, "SpectrumRectangle") as Rectangle;
                     Verify.IsNotNull(spectrumRectangle);
 
+                    // When the spectrum's bitmaps are already cached, it may have been filled before it loaded.
+                    if (spectrumRectangle.Fill != null)
+                    {
+                        spectrumLoadedEvent.Set();
+                    }
+
                     spectrumRectangle.RegisterPropertyChangedCallback(Shape.FillProperty, (o, dp) =>
                     {
                         spectrumLoadedEvent.Set();
@@ -6,6 +6,14 @@
 #include "ColorHelpers.h"
 #include "SharedHelpers.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#define COLORHELPERS_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(_M_ARM64)
+#define COLORHELPERS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 const int CheckerSize = 4;
 
 Hsv FindNextNamedColor(
@@ -439,6 +447,151 @@ void CreateCheckeredBackgroundAsync(
     }));
 }
 
+#if defined(COLORHELPERS_SIMD_SSE2) || defined(COLORHELPERS_SIMD_NEON)
+
+// Thin wrappers over two-lane double vectors so that HsvToBgraPixelData has a single vectorized body.
+namespace
+{
+#if defined(COLORHELPERS_SIMD_SSE2)
+    using double2 = __m128d;
+
+    inline double2 Load(const double* values) { return _mm_loadu_pd(values); }
+    inline double2 Splat(double value) { return _mm_set1_pd(value); }
+    inline double2 Add(double2 lhs, double2 rhs) { return _mm_add_pd(lhs, rhs); }
+    inline double2 Subtract(double2 lhs, double2 rhs) { return _mm_sub_pd(lhs, rhs); }
+    inline double2 Multiply(double2 lhs, double2 rhs) { return _mm_mul_pd(lhs, rhs); }
+    inline double2 Divide(double2 lhs, double2 rhs) { return _mm_div_pd(lhs, rhs); }
+    inline double2 Min(double2 lhs, double2 rhs) { return _mm_min_pd(lhs, rhs); }
+    inline double2 Max(double2 lhs, double2 rhs) { return _mm_max_pd(lhs, rhs); }
+    inline double2 Equals(double2 lhs, double2 rhs) { return _mm_cmpeq_pd(lhs, rhs); }
+    inline double2 Or(double2 lhs, double2 rhs) { return _mm_or_pd(lhs, rhs); }
+    inline double2 Select(double2 mask, double2 ifTrue, double2 ifFalse) { return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse)); }
+
+    // SSE2 has no floor instruction, so we truncate and step down when truncation rounded up.
+    // Only used on values well within the range of a 32-bit integer.
+    inline double2 Floor(double2 values)
+    {
+        const double2 truncated = _mm_cvtepi32_pd(_mm_cvttpd_epi32(values));
+        return _mm_sub_pd(truncated, _mm_and_pd(_mm_cmpgt_pd(truncated, values), _mm_set1_pd(1.0)));
+    }
+
+    // Converts channels in [0, 1] to bytes, rounding to nearest.
+    inline void StoreChannelBytes(double2 channel, int (&bytes)[2])
+    {
+        const __m128i rounded = _mm_cvttpd_epi32(_mm_add_pd(_mm_mul_pd(channel, _mm_set1_pd(255.0)), _mm_set1_pd(0.5)));
+        bytes[0] = _mm_cvtsi128_si32(rounded);
+        bytes[1] = _mm_cvtsi128_si32(_mm_srli_si128(rounded, 4));
+    }
+#else
+    using double2 = float64x2_t;
+
+    inline double2 Load(const double* values) { return vld1q_f64(values); }
+    inline double2 Splat(double value) { return vdupq_n_f64(value); }
+    inline double2 Add(double2 lhs, double2 rhs) { return vaddq_f64(lhs, rhs); }
+    inline double2 Subtract(double2 lhs, double2 rhs) { return vsubq_f64(lhs, rhs); }
+    inline double2 Multiply(double2 lhs, double2 rhs) { return vmulq_f64(lhs, rhs); }
+    inline double2 Divide(double2 lhs, double2 rhs) { return vdivq_f64(lhs, rhs); }
+    inline double2 Min(double2 lhs, double2 rhs) { return vminq_f64(lhs, rhs); }
+    inline double2 Max(double2 lhs, double2 rhs) { return vmaxq_f64(lhs, rhs); }
+    inline double2 Equals(double2 lhs, double2 rhs) { return vreinterpretq_f64_u64(vceqq_f64(lhs, rhs)); }
+    inline double2 Or(double2 lhs, double2 rhs) { return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(lhs), vreinterpretq_u64_f64(rhs))); }
+    inline double2 Select(double2 mask, double2 ifTrue, double2 ifFalse) { return vbslq_f64(vreinterpretq_u64_f64(mask), ifTrue, ifFalse); }
+    inline double2 Floor(double2 values) { return vrndmq_f64(values); }
+
+    // Converts channels in [0, 1] to bytes, rounding to nearest.
+    inline void StoreChannelBytes(double2 channel, int (&bytes)[2])
+    {
+        const uint64x2_t rounded = vcvtq_u64_f64(vaddq_f64(vmulq_f64(channel, vdupq_n_f64(255.0)), vdupq_n_f64(0.5)));
+        bytes[0] = static_cast<int>(vgetq_lane_u64(rounded, 0));
+        bytes[1] = static_cast<int>(vgetq_lane_u64(rounded, 1));
+    }
+#endif
+}
+
+#endif
+
+void HsvToBgraPixelData(
+    const double* hues,
+    const double* saturations,
+    const double* values,
+    size_t pixelCount,
+    byte* bgraPixelData)
+{
+    size_t i = 0;
+
+#if defined(COLORHELPERS_SIMD_SSE2) || defined(COLORHELPERS_SIMD_NEON)
+    // This is HsvToRgb (see ColorConversion.cpp for the explanation of the math) computed two pixels at a time.
+    // Rather than switching on the sextant, we compute every candidate channel value and select between them.
+    const double2 zero = Splat(0.0);
+    const double2 one = Splat(1.0);
+    const double2 sixty = Splat(60.0);
+    const double2 threeSixty = Splat(360.0);
+
+    for (; i + 2 <= pixelCount; i += 2)
+    {
+        double2 hue = Load(hues + i);
+        hue = Subtract(hue, Multiply(threeSixty, Floor(Divide(hue, threeSixty))));
+
+        const double2 saturation = Max(zero, Min(one, Load(saturations + i)));
+        const double2 value = Max(zero, Min(one, Load(values + i)));
+
+        const double2 chroma = Multiply(saturation, value);
+        const double2 min = Subtract(value, chroma);
+        const double2 max = Add(chroma, min);
+
+        const double2 sextant = Floor(Divide(hue, sixty));
+        const double2 intermediateColorPercentage = Subtract(Divide(hue, sixty), sextant);
+        const double2 increasing = Add(min, Multiply(chroma, intermediateColorPercentage));
+        const double2 decreasing = Add(min, Multiply(chroma, Subtract(one, intermediateColorPercentage)));
+
+        const double2 isSextant0 = Equals(sextant, Splat(0.0));
+        const double2 isSextant1 = Equals(sextant, Splat(1.0));
+        const double2 isSextant2 = Equals(sextant, Splat(2.0));
+        const double2 isSextant3 = Equals(sextant, Splat(3.0));
+        const double2 isSextant4 = Equals(sextant, Splat(4.0));
+        const double2 isSextant5 = Equals(sextant, Splat(5.0));
+
+        double2 r = Select(Or(isSextant0, isSextant5), max, min);
+        r = Select(isSextant1, decreasing, r);
+        r = Select(isSextant4, increasing, r);
+
+        double2 g = Select(Or(isSextant1, isSextant2), max, min);
+        g = Select(isSextant0, increasing, g);
+        g = Select(isSextant3, decreasing, g);
+
+        double2 b = Select(Or(isSextant3, isSextant4), max, min);
+        b = Select(isSextant2, increasing, b);
+        b = Select(isSextant5, decreasing, b);
+
+        int rBytes[2];
+        int gBytes[2];
+        int bBytes[2];
+        StoreChannelBytes(r, rBytes);
+        StoreChannelBytes(g, gBytes);
+        StoreChannelBytes(b, bBytes);
+
+        for (int lane = 0; lane < 2; lane++)
+        {
+            byte* pixel = bgraPixelData + (i + lane) * 4;
+            pixel[0] = static_cast<byte>(bBytes[lane]); // b
+            pixel[1] = static_cast<byte>(gBytes[lane]); // g
+            pixel[2] = static_cast<byte>(rBytes[lane]); // r
+            pixel[3] = 255; // a
+        }
+    }
+#endif
+
+    for (; i < pixelCount; i++)
+    {
+        Rgb rgb = HsvToRgb(Hsv(hues[i], saturations[i], values[i]));
+        byte* pixel = bgraPixelData + i * 4;
+        pixel[0] = static_cast<byte>(round(rgb.b * 255)); // b
+        pixel[1] = static_cast<byte>(round(rgb.g * 255)); // g
+        pixel[2] = static_cast<byte>(round(rgb.r * 255)); // r
+        pixel[3] = 255; // a
+    }
+}
+
 winrt::WriteableBitmap CreateBitmapFromPixelData(
     int pixelWidth,
     int pixelHeight,
@@ -45,6 +45,15 @@ void CreateCheckeredBackgroundAsync(
     DispatcherHelper dispatcherHelper,
     std::function<void(winrt::WriteableBitmap)> completedFunction);
 
+// Converts pixelCount HSV colors, given one component per array, into opaque BGRA pixel data.
+// Equivalent to calling HsvToRgb on each color and rounding each channel to a byte.
+void HsvToBgraPixelData(
+    const double* hues,
+    const double* saturations,
+    const double* values,
+    size_t pixelCount,
+    byte* bgraPixelData);
+
 winrt::WriteableBitmap CreateBitmapFromPixelData(
     int pixelWidth,
     int pixelHeight,
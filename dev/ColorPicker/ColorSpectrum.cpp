@@ -10,6 +10,10 @@
 
 using namespace std;
 
+winrt::slim_mutex ColorSpectrum::s_bitmapCacheLock;
+std::list<std::pair<ColorSpectrum::SpectrumBitmapParameters, std::shared_ptr<ColorSpectrum::SpectrumBitmapData>>> ColorSpectrum::s_bitmapCache;
+size_t ColorSpectrum::s_bitmapCacheByteCount{ 0 };
+
 ColorSpectrum::ColorSpectrum()
 {
     SetDefaultStyleKey(this);
@@ -83,7 +87,7 @@ void ColorSpectrum::OnApplyTemplate()
     }
 
     // If we haven't yet created our bitmaps, do so now.
-    if (m_hsvValues.size() == 0)
+    if (m_bitmapParametersFromLastBitmapCreation.pixelWidth == 0)
     {
         CreateBitmapsAndColorMap();
     }
@@ -488,9 +492,9 @@ void ColorSpectrum::UpdateColor(Hsv newHsv)
 
 void ColorSpectrum::UpdateColorFromPoint(const winrt::PointerPoint& point)
 {
-    // If we haven't initialized our HSV value array yet, then we should just ignore any user input -
+    // If we haven't created our bitmaps yet, then we should just ignore any user input -
     // we don't yet know what to do with it.
-    if (m_hsvValues.size() == 0)
+    if (m_bitmapParametersFromLastBitmapCreation.pixelWidth == 0)
     {
         return;
     }
@@ -509,10 +513,9 @@ void ColorSpectrum::UpdateColorFromPoint(const winrt::PointerPoint& point)
         yPosition = (radius / distanceFromRadius) * (yPosition - radius) + radius;
     }
 
-    // Now we need to find the index into the array of HSL values at each point in the spectrum m_image.
+    // Now we need to find the pixel of the spectrum image that we're over.
     int x = static_cast<int>(round(xPosition));
     int y = static_cast<int>(round(yPosition));
-    int width = static_cast<int>(round(m_imageWidthFromLastBitmapCreation));
 
     if (x < 0)
     {
@@ -534,7 +537,7 @@ void ColorSpectrum::UpdateColorFromPoint(const winrt::PointerPoint& point)
 
     // The gradient image contains two dimensions of HSL information, but not the third.
     // We should keep the third where it already was.
-    Hsv hsvAtPoint = m_hsvValues[y * width + x];
+    Hsv hsvAtPoint = GetHsvAtPixel(m_bitmapParametersFromLastBitmapCreation, x, y);
 
     auto components = Components();
     auto hsvColor = HsvColor();
@@ -808,6 +811,43 @@ void ColorSpectrum::OnSelectionEllipseFlowDirectionChanged(winrt::DependencyObje
     UpdateEllipse();
 }
 
+ColorSpectrum::SpectrumBitmapParameters ColorSpectrum::GetSpectrumBitmapParameters(int pixelWidth)
+{
+    int minHue = MinHue();
+    int maxHue = MaxHue();
+    int minSaturation = MinSaturation();
+    int maxSaturation = MaxSaturation();
+    int minValue = MinValue();
+    int maxValue = MaxValue();
+
+    // If min >= max, then by convention, min is the only number that a property can have.
+    if (minHue >= maxHue)
+    {
+        maxHue = minHue;
+    }
+
+    if (minSaturation >= maxSaturation)
+    {
+        maxSaturation = minSaturation;
+    }
+
+    if (minValue >= maxValue)
+    {
+        maxValue = minValue;
+    }
+
+    return SpectrumBitmapParameters{
+        pixelWidth,
+        Shape(),
+        Components(),
+        static_cast<double>(minHue),
+        static_cast<double>(maxHue),
+        static_cast<double>(minSaturation),
+        static_cast<double>(maxSaturation),
+        static_cast<double>(minValue),
+        static_cast<double>(maxValue) };
+}
+
 void ColorSpectrum::CreateBitmapsAndColorMap()
 {
     if (!m_layoutRoot ||
@@ -848,65 +888,56 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
     m_spectrumOverlayEllipse.Width(minDimension);
     m_spectrumOverlayEllipse.Height(minDimension);
 
-    winrt::float4 hsvColor = HsvColor();
-    int minHue = MinHue();
-    int maxHue = MaxHue();
-    int minSaturation = MinSaturation();
-    int maxSaturation = MaxSaturation();
-    int minValue = MinValue();
-    int maxValue = MaxValue();
-    winrt::ColorSpectrumShape shape = Shape();
-    winrt::ColorSpectrumComponents components = Components();
+    int minDimensionInt = static_cast<int>(round(minDimension));
+    const SpectrumBitmapParameters parameters = GetSpectrumBitmapParameters(minDimensionInt);
+    const winrt::ColorSpectrumComponents components = parameters.components;
 
-    // If min >= max, then by convention, min is the only number that a property can have.
-    if (minHue >= maxHue)
-    {
-        maxHue = minHue;
-    }
+    // Completions are dispatched to the UI thread, so one for an older request can arrive after
+    // this one has started or even applied its bitmaps. Each request gets a generation, and only
+    // the completion for the latest generation applies its data.
+    const uint64_t generation = ++m_bitmapGeneration;
 
-    if (minSaturation >= maxSaturation)
+    // Any bitmap creation still in progress is for parameters that no longer apply.
+    if (m_createImageBitmapAction)
     {
-        maxSaturation = minSaturation;
+        m_createImageBitmapAction.Cancel();
+        m_createImageBitmapAction = nullptr;
     }
 
-    if (minValue >= maxValue)
+    // Another spectrum may already have generated the pixel data we need.
+    if (auto cachedBitmapData = TryGetCachedBitmapData(parameters))
     {
-        maxValue = minValue;
+        ApplyBitmapData(parameters, minDimension, *cachedBitmapData);
+        return;
     }
 
-    Hsv hsv = { hsv::GetHue(hsvColor), hsv::GetSaturation(hsvColor), hsv::GetValue(hsvColor) };
+    auto pixelCount = static_cast<size_t>(minDimensionInt) * static_cast<size_t>(minDimensionInt);
+    size_t pixelDataSize = pixelCount * 4;
 
     // The middle 4 are only needed and used in the case of hue as the third dimension.
     // Saturation and luminosity need only a min and max.
-    shared_ptr<vector<::byte>> bgraMinPixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMaxPixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<Hsv>> newHsvValues = make_shared<vector<Hsv>>();
-
-    auto pixelCount = static_cast<size_t>(round(minDimension) * round(minDimension));
-    size_t pixelDataSize = pixelCount * 4;
-    bgraMinPixelData->reserve(pixelDataSize);
+    // The buffers are allocated up front so that the worker threads can each fill their own rows in place.
+    shared_ptr<SpectrumBitmapData> bitmapData = make_shared<SpectrumBitmapData>();
+    std::array<::byte*, c_spectrumBitmapCount> bgraPixelData{};
 
     // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
+    const bool hasMiddleBitmaps =
+        components == winrt::ColorSpectrumComponents::ValueSaturation ||
+        components == winrt::ColorSpectrumComponents::SaturationValue;
+
+    for (int bitmap = 0; bitmap < c_spectrumBitmapCount; bitmap++)
     {
-        bgraMiddle1PixelData->reserve(pixelDataSize);
-        bgraMiddle2PixelData->reserve(pixelDataSize);
-        bgraMiddle3PixelData->reserve(pixelDataSize);
-        bgraMiddle4PixelData->reserve(pixelDataSize);
-    }
+        bitmapData->bgraPixelData[bitmap] = make_shared<vector<::byte>>();
 
-    bgraMaxPixelData->reserve(pixelDataSize);
-    newHsvValues->reserve(pixelCount);
+        if (bitmap == 0 || bitmap == c_spectrumBitmapCount - 1 || hasMiddleBitmaps)
+        {
+            bitmapData->bgraPixelData[bitmap]->resize(pixelDataSize);
+            bgraPixelData[bitmap] = bitmapData->bgraPixelData[bitmap]->data();
+        }
+    }
 
-    int minDimensionInt = static_cast<int>(round(minDimension));
     winrt::WorkItemHandler workItemHandler(
-        [minDimensionInt, hsv, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue, shape, components,
-        bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]
+        [parameters, bgraPixelData, bitmapData]
     (winrt::IAsyncAction workItem)
         {
             // As the user perceives it, every time the third dimension not represented in the ColorSpectrum changes,
@@ -923,53 +954,47 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
             // We'll then blend between whichever colors our hue exists between - e.g., an orange color would use red and yellow with an opacity of 50%.
             // This optimization does incur slightly more startup time initially since we have to generate multiple bitmaps at once instead of only one,
             // but the running time savings after that are *huge* when we can just set an opacity instead of generating a brand new bitmap.
-            if (shape == winrt::ColorSpectrumShape::Box)
+            //
+            // The rows are split into tiles that this work item and a few helper work items take in turn until none are left.
+            // Since this work item fills tiles as well, generation completes even if the helpers are slow to get scheduled.
+            const int tileCount = (parameters.pixelWidth + c_spectrumRowsPerTile - 1) / c_spectrumRowsPerTile;
+            auto nextTile = make_shared<std::atomic<int>>(0);
+
+            auto fillTiles = [parameters, bgraPixelData, tileCount, nextTile, workItem]()
             {
-                for (int x = minDimensionInt - 1; x >= 0; --x)
+                SpectrumRowScratch scratch(parameters.pixelWidth);
+
+                for (int tile = (*nextTile)++;
+                    tile < tileCount && workItem.Status() != winrt::AsyncStatus::Canceled;
+                    tile = (*nextTile)++)
                 {
-                    for (int y = minDimensionInt - 1; y >= 0; --y)
-                    {
-                        if (workItem.Status() == winrt::AsyncStatus::Canceled)
-                        {
-                            break;
-                        }
-
-                        ColorSpectrum::FillPixelForBox(
-                            x, y, hsv, minDimensionInt, components, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue,
-                            bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData,
-                            newHsvValues);
-                    }
+                    const int firstRow = tile * c_spectrumRowsPerTile;
+                    const int rowCount = min(c_spectrumRowsPerTile, parameters.pixelWidth - firstRow);
+                    ColorSpectrum::FillSpectrumRows(parameters, firstRow, rowCount, bgraPixelData, scratch);
                 }
+            };
+
+            vector<winrt::IAsyncAction> helperWorkItems;
+            const int helperCount = min(GetSpectrumWorkerCount(), tileCount) - 1;
+            for (int i = 0; i < helperCount; i++)
+            {
+                helperWorkItems.push_back(winrt::ThreadPool::RunAsync(winrt::WorkItemHandler(
+                    [fillTiles](winrt::IAsyncAction const&) { fillTiles(); })));
             }
-            else
+
+            fillTiles();
+
+            // The pixel data must not be handed out before every tile has been written.
+            for (auto& helperWorkItem : helperWorkItems)
             {
-                for (int y = 0; y < minDimensionInt; ++y)
-                {
-                    for (int x = 0; x < minDimensionInt; ++x)
-                    {
-                        if (workItem.Status() == winrt::AsyncStatus::Canceled)
-                        {
-                            break;
-                        }
-
-                        ColorSpectrum::FillPixelForRing(
-                            x, y, minDimensionInt / 2.0, hsv, components, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue,
-                            bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData,
-                            newHsvValues);
-                    }
-                }
+                helperWorkItem.get();
             }
         });
 
-    if (m_createImageBitmapAction)
-    {
-        m_createImageBitmapAction.Cancel();
-    }
-
     m_createImageBitmapAction = winrt::ThreadPool::RunAsync(workItemHandler);
     auto strongThis = get_strong();
     m_createImageBitmapAction.Completed(winrt::AsyncActionCompletedHandler(
-        [strongThis, minDimension, components, bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]
+        [strongThis, generation, minDimension, parameters, bitmapData]
     (winrt::IAsyncAction asyncInfo, winrt::AsyncStatus asyncStatus)
     {
         if (asyncStatus != winrt::AsyncStatus::Completed)
@@ -977,363 +1002,333 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
             return;
         }
 
-        strongThis->m_createImageBitmapAction = nullptr;
+        // The pixel data is valid for its parameters even if it is no longer the latest request,
+        // so it is cached either way. The cache is synchronized, unlike the members below.
+        CacheBitmapData(parameters, bitmapData);
 
         strongThis->m_dispatcherHelper.RunAsync(
-            [strongThis, minDimension, bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]()
+            [strongThis, generation, parameters, minDimension, bitmapData]()
         {
-            int pixelWidth = static_cast<int>(round(minDimension));
-            int pixelHeight = static_cast<int>(round(minDimension));
-
-            winrt::ColorSpectrumComponents components = strongThis->Components();
-
-            if (SharedHelpers::IsRS2OrHigher())
-            {
-                winrt::LoadedImageSurface minSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
-                winrt::LoadedImageSurface maxSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
-
-                switch (components)
-                {
-                case winrt::ColorSpectrumComponents::HueValue:
-                case winrt::ColorSpectrumComponents::ValueHue:
-                    strongThis->m_saturationMinimumSurface = minSurface;
-                    strongThis->m_saturationMaximumSurface = maxSurface;
-                    break;
-                case winrt::ColorSpectrumComponents::HueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationHue:
-                    strongThis->m_valueSurface = maxSurface;
-                    break;
-                case winrt::ColorSpectrumComponents::ValueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationValue:
-                    strongThis->m_hueRedSurface = minSurface;
-                    strongThis->m_hueYellowSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
-                    strongThis->m_hueGreenSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
-                    strongThis->m_hueCyanSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
-                    strongThis->m_hueBlueSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
-                    strongThis->m_huePurpleSurface = maxSurface;
-                    break;
-                }
-            }
-            else
+            if (strongThis->m_bitmapGeneration != generation)
             {
-                winrt::WriteableBitmap minBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
-                winrt::WriteableBitmap maxBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
-
-                switch (components)
-                {
-                case winrt::ColorSpectrumComponents::HueValue:
-                case winrt::ColorSpectrumComponents::ValueHue:
-                    strongThis->m_saturationMinimumBitmap = minBitmap;
-                    strongThis->m_saturationMaximumBitmap = maxBitmap;
-                    break;
-                case winrt::ColorSpectrumComponents::HueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationHue:
-                    strongThis->m_valueBitmap = maxBitmap;
-                    break;
-                case winrt::ColorSpectrumComponents::ValueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationValue:
-                    strongThis->m_hueRedBitmap = minBitmap;
-                    strongThis->m_hueYellowBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
-                    strongThis->m_hueGreenBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
-                    strongThis->m_hueCyanBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
-                    strongThis->m_hueBlueBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
-                    strongThis->m_huePurpleBitmap = maxBitmap;
-                    break;
-                }
+                // A newer request has replaced this one, and has already replaced
+                // m_createImageBitmapAction as well.
+                return;
             }
 
-            strongThis->m_shapeFromLastBitmapCreation = strongThis->Shape();
-            strongThis->m_componentsFromLastBitmapCreation = strongThis->Components();
-            strongThis->m_imageWidthFromLastBitmapCreation = minDimension;
-            strongThis->m_imageHeightFromLastBitmapCreation = minDimension;
-            strongThis->m_minHueFromLastBitmapCreation = strongThis->MinHue();
-            strongThis->m_maxHueFromLastBitmapCreation = strongThis->MaxHue();
-            strongThis->m_minSaturationFromLastBitmapCreation = strongThis->MinSaturation();
-            strongThis->m_maxSaturationFromLastBitmapCreation = strongThis->MaxSaturation();
-            strongThis->m_minValueFromLastBitmapCreation = strongThis->MinValue();
-            strongThis->m_maxValueFromLastBitmapCreation = strongThis->MaxValue();
-
-            strongThis->m_hsvValues = *newHsvValues;
-
-            strongThis->UpdateBitmapSources();
-            strongThis->UpdateEllipse();
+            strongThis->m_createImageBitmapAction = nullptr;
+            strongThis->ApplyBitmapData(parameters, minDimension, *bitmapData);
         });
     }));
 }
 
-void ColorSpectrum::FillPixelForBox(
-    double x,
-    double y,
-    const Hsv &baseHsv,
-    double minDimension,
-    winrt::ColorSpectrumComponents components,
-    double minHue,
-    double maxHue,
-    double minSaturation,
-    double maxSaturation,
-    double minValue,
-    double maxValue,
-    shared_ptr<vector<::byte>> bgraMinPixelData,
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData,
-    shared_ptr<vector<::byte>> bgraMaxPixelData,
-    shared_ptr<vector<Hsv>> newHsvValues)
+void ColorSpectrum::ApplyBitmapData(const SpectrumBitmapParameters& parameters, double minDimension, const SpectrumBitmapData& bitmapData)
 {
-    double hMin = minHue;
-    double hMax = maxHue;
-    double sMin = minSaturation / 100.0;
-    double sMax = maxSaturation / 100.0;
-    double vMin = minValue / 100.0;
-    double vMax = maxValue / 100.0;
-
-    Hsv hsvMin = baseHsv;
-    Hsv hsvMiddle1 = baseHsv;
-    Hsv hsvMiddle2 = baseHsv;
-    Hsv hsvMiddle3 = baseHsv;
-    Hsv hsvMiddle4 = baseHsv;
-    Hsv hsvMax = baseHsv;
-
-    double xPercent = (minDimension - 1 - x) / (minDimension - 1);
-    double yPercent = (minDimension - 1 - y) / (minDimension - 1);
+    int pixelWidth = static_cast<int>(round(minDimension));
+    int pixelHeight = static_cast<int>(round(minDimension));
 
-    switch (components)
+    // The bitmaps are laid out for the components they were generated for, which may no
+    // longer be the current value of Components.
+    const winrt::ColorSpectrumComponents components = parameters.components;
+
+    auto const& bgraMinPixelData = bitmapData.bgraPixelData[0];
+    auto const& bgraMiddle1PixelData = bitmapData.bgraPixelData[1];
+    auto const& bgraMiddle2PixelData = bitmapData.bgraPixelData[2];
+    auto const& bgraMiddle3PixelData = bitmapData.bgraPixelData[3];
+    auto const& bgraMiddle4PixelData = bitmapData.bgraPixelData[4];
+    auto const& bgraMaxPixelData = bitmapData.bgraPixelData[5];
+
+    if (SharedHelpers::IsRS2OrHigher())
     {
-    case winrt::ColorSpectrumComponents::HueValue:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + yPercent * (hMax - hMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + xPercent * (vMax - vMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
-        break;
+        winrt::LoadedImageSurface minSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
+        winrt::LoadedImageSurface maxSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
 
-    case winrt::ColorSpectrumComponents::HueSaturation:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + yPercent * (hMax - hMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + xPercent * (sMax - sMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
-        break;
+        switch (components)
+        {
+        case winrt::ColorSpectrumComponents::HueValue:
+        case winrt::ColorSpectrumComponents::ValueHue:
+            m_saturationMinimumSurface = minSurface;
+            m_saturationMaximumSurface = maxSurface;
+            break;
+        case winrt::ColorSpectrumComponents::HueSaturation:
+        case winrt::ColorSpectrumComponents::SaturationHue:
+            m_valueSurface = maxSurface;
+            break;
+        case winrt::ColorSpectrumComponents::ValueSaturation:
+        case winrt::ColorSpectrumComponents::SaturationValue:
+            m_hueRedSurface = minSurface;
+            m_hueYellowSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
+            m_hueGreenSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
+            m_hueCyanSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
+            m_hueBlueSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
+            m_huePurpleSurface = maxSurface;
+            break;
+        }
+    }
+    else
+    {
+        winrt::WriteableBitmap minBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
+        winrt::WriteableBitmap maxBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
 
-    case winrt::ColorSpectrumComponents::ValueHue:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + yPercent * (vMax - vMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + xPercent * (hMax - hMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
-        break;
+        switch (components)
+        {
+        case winrt::ColorSpectrumComponents::HueValue:
+        case winrt::ColorSpectrumComponents::ValueHue:
+            m_saturationMinimumBitmap = minBitmap;
+            m_saturationMaximumBitmap = maxBitmap;
+            break;
+        case winrt::ColorSpectrumComponents::HueSaturation:
+        case winrt::ColorSpectrumComponents::SaturationHue:
+            m_valueBitmap = maxBitmap;
+            break;
+        case winrt::ColorSpectrumComponents::ValueSaturation:
+        case winrt::ColorSpectrumComponents::SaturationValue:
+            m_hueRedBitmap = minBitmap;
+            m_hueYellowBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
+            m_hueGreenBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
+            m_hueCyanBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
+            m_hueBlueBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
+            m_huePurpleBitmap = maxBitmap;
+            break;
+        }
+    }
 
-    case winrt::ColorSpectrumComponents::ValueSaturation:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + yPercent * (vMax - vMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + xPercent * (sMax - sMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
-        break;
+    m_shapeFromLastBitmapCreation = parameters.shape;
+    m_componentsFromLastBitmapCreation = parameters.components;
+    m_imageWidthFromLastBitmapCreation = minDimension;
+    m_imageHeightFromLastBitmapCreation = minDimension;
+    m_minHueFromLastBitmapCreation = static_cast<int>(parameters.minHue);
+    m_maxHueFromLastBitmapCreation = static_cast<int>(parameters.maxHue);
+    m_minSaturationFromLastBitmapCreation = static_cast<int>(parameters.minSaturation);
+    m_maxSaturationFromLastBitmapCreation = static_cast<int>(parameters.maxSaturation);
+    m_minValueFromLastBitmapCreation = static_cast<int>(parameters.minValue);
+    m_maxValueFromLastBitmapCreation = static_cast<int>(parameters.maxValue);
 
-    case winrt::ColorSpectrumComponents::SaturationHue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + yPercent * (sMax - sMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + xPercent * (hMax - hMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
-        break;
+    m_bitmapParametersFromLastBitmapCreation = parameters;
 
-    case winrt::ColorSpectrumComponents::SaturationValue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + yPercent * (sMax - sMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + xPercent * (vMax - vMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
-        break;
+    UpdateBitmapSources();
+    UpdateEllipse();
+}
+
+std::shared_ptr<ColorSpectrum::SpectrumBitmapData> ColorSpectrum::TryGetCachedBitmapData(const SpectrumBitmapParameters& parameters)
+{
+    winrt::slim_lock_guard lock{ s_bitmapCacheLock };
+
+    auto it = std::find_if(s_bitmapCache.begin(), s_bitmapCache.end(),
+        [&parameters](const auto& entry) { return entry.first == parameters; });
+
+    if (it == s_bitmapCache.end())
+    {
+        return nullptr;
     }
 
-    // If saturation is an axis in the spectrum with hue, or value is an axis, then we want
-    // that axis to go from maximum at the top to minimum at the bottom,
-    // or maximum at the outside to minimum at the inside in the case of the ring configuration,
-    // so we'll invert the number before assigning the HSL value to the array.
-    // Otherwise, we'll have a very narrow section in the middle that actually has meaningful hue
-    // in the case of the ring configuration.
-    if (components == winrt::ColorSpectrumComponents::HueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationHue)
+    // The front of the list holds the most recently used entry.
+    s_bitmapCache.splice(s_bitmapCache.begin(), s_bitmapCache, it);
+    return it->second;
+}
+
+void ColorSpectrum::CacheBitmapData(const SpectrumBitmapParameters& parameters, const std::shared_ptr<SpectrumBitmapData>& bitmapData)
+{
+    const size_t byteCount = bitmapData->GetByteCount();
+
+    if (byteCount > c_spectrumBitmapCacheMaxByteCount)
     {
-        hsvMin.s = sMax - hsvMin.s + sMin;
-        hsvMiddle1.s = sMax - hsvMiddle1.s + sMin;
-        hsvMiddle2.s = sMax - hsvMiddle2.s + sMin;
-        hsvMiddle3.s = sMax - hsvMiddle3.s + sMin;
-        hsvMiddle4.s = sMax - hsvMiddle4.s + sMin;
-        hsvMax.s = sMax - hsvMax.s + sMin;
+        return;
     }
-    else
+
+    winrt::slim_lock_guard lock{ s_bitmapCacheLock };
+
+    auto it = std::find_if(s_bitmapCache.begin(), s_bitmapCache.end(),
+        [&parameters](const auto& entry) { return entry.first == parameters; });
+
+    if (it != s_bitmapCache.end())
     {
-        hsvMin.v = vMax - hsvMin.v + vMin;
-        hsvMiddle1.v = vMax - hsvMiddle1.v + vMin;
-        hsvMiddle2.v = vMax - hsvMiddle2.v + vMin;
-        hsvMiddle3.v = vMax - hsvMiddle3.v + vMin;
-        hsvMiddle4.v = vMax - hsvMiddle4.v + vMin;
-        hsvMax.v = vMax - hsvMax.v + vMin;
+        s_bitmapCacheByteCount -= it->second->GetByteCount();
+        s_bitmapCache.erase(it);
     }
 
-    newHsvValues->push_back(hsvMin);
+    s_bitmapCache.emplace_front(parameters, bitmapData);
+    s_bitmapCacheByteCount += byteCount;
 
-    Rgb rgbMin = HsvToRgb(hsvMin);
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.b * 255))); // b
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.g * 255))); // g
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.r * 255))); // r
-    bgraMinPixelData->push_back(255); // a - ignored
+    // Evict the least recently used entries until we fit in the budget again.
+    // Spectra still using evicted data keep it alive through their own references.
+    while (s_bitmapCacheByteCount > c_spectrumBitmapCacheMaxByteCount)
+    {
+        s_bitmapCacheByteCount -= s_bitmapCache.back().second->GetByteCount();
+        s_bitmapCache.pop_back();
+    }
+}
 
-    // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
-    {
-        Rgb rgbMiddle1 = HsvToRgb(hsvMiddle1);
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.b * 255))); // b
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.g * 255))); // g
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.r * 255))); // r
-        bgraMiddle1PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle2 = HsvToRgb(hsvMiddle2);
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.b * 255))); // b
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.g * 255))); // g
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.r * 255))); // r
-        bgraMiddle2PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle3 = HsvToRgb(hsvMiddle3);
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.b * 255))); // b
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.g * 255))); // g
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.r * 255))); // r
-        bgraMiddle3PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle4 = HsvToRgb(hsvMiddle4);
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.b * 255))); // b
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.g * 255))); // g
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.r * 255))); // r
-        bgraMiddle4PixelData->push_back(255); // a - ignored
-    }
-
-    Rgb rgbMax = HsvToRgb(hsvMax);
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.b * 255))); // b
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.g * 255))); // g
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.r * 255))); // r
-    bgraMaxPixelData->push_back(255); // a - ignored
+size_t ColorSpectrum::SpectrumBitmapData::GetByteCount() const
+{
+    size_t byteCount = 0;
+
+    for (auto const& pixelData : bgraPixelData)
+    {
+        byteCount += pixelData ? pixelData->size() : 0;
+    }
+
+    return byteCount;
 }
 
-void ColorSpectrum::FillPixelForRing(
-    double x,
-    double y,
-    double radius,
-    const Hsv &baseHsv,
-    winrt::ColorSpectrumComponents components,
-    double minHue,
-    double maxHue,
-    double minSaturation,
-    double maxSaturation,
-    double minValue,
-    double maxValue,
-    shared_ptr<vector<::byte>> bgraMinPixelData,
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData,
-    shared_ptr<vector<::byte>> bgraMaxPixelData,
-    shared_ptr<vector<Hsv>> newHsvValues)
+bool ColorSpectrum::SpectrumBitmapParameters::operator==(const SpectrumBitmapParameters& other) const
 {
-    double hMin = minHue;
-    double hMax = maxHue;
-    double sMin = minSaturation / 100.0;
-    double sMax = maxSaturation / 100.0;
-    double vMin = minValue / 100.0;
-    double vMax = maxValue / 100.0;
+    return pixelWidth == other.pixelWidth &&
+        shape == other.shape &&
+        components == other.components &&
+        minHue == other.minHue &&
+        maxHue == other.maxHue &&
+        minSaturation == other.minSaturation &&
+        maxSaturation == other.maxSaturation &&
+        minValue == other.minValue &&
+        maxValue == other.maxValue;
+}
 
-    double distanceFromRadius = sqrt(pow(x - radius, 2) + pow(y - radius, 2));
+ColorSpectrum::SpectrumRowScratch::SpectrumRowScratch(int pixelWidth) :
+    firstAxisPercents(pixelWidth),
+    secondAxisPercents(pixelWidth),
+    hues(pixelWidth),
+    saturations(pixelWidth),
+    values(pixelWidth)
+{
+}
+
+void ColorSpectrum::FillSpectrumRows(
+    const SpectrumBitmapParameters& parameters,
+    int firstRow,
+    int rowCount,
+    const std::array<::byte*, c_spectrumBitmapCount>& bgraPixelData,
+    SpectrumRowScratch& scratch)
+{
+    const int pixelWidth = parameters.pixelWidth;
 
-    double xToUse = x;
-    double yToUse = y;
+    // The component that isn't on either axis of the spectrum is the third dimension, which varies between the bitmaps.
+    std::vector<double>* thirdDimensionComponent = nullptr;
+    std::array<double, c_spectrumBitmapCount> thirdDimensionValues{};
 
-    // If we're outside the ring, then we want the pixel to appear as blank.
-    // However, to avoid issues with rounding errors, we'll act as though this point
-    // is on the edge of the ring for the purposes of returning an HSL value.
-    // That way, hittesting on the edges will always return the correct value.
-    if (distanceFromRadius > radius)
+    switch (parameters.components)
     {
-        xToUse = (radius / distanceFromRadius) * (x - radius) + radius;
-        yToUse = (radius / distanceFromRadius) * (y - radius) + radius;
-        distanceFromRadius = radius;
+    case winrt::ColorSpectrumComponents::HueValue:
+    case winrt::ColorSpectrumComponents::ValueHue:
+        thirdDimensionComponent = &scratch.saturations;
+        thirdDimensionValues = { 0, 0, 0, 0, 0, 1 };
+        break;
+
+    case winrt::ColorSpectrumComponents::HueSaturation:
+    case winrt::ColorSpectrumComponents::SaturationHue:
+        thirdDimensionComponent = &scratch.values;
+        thirdDimensionValues = { 0, 0, 0, 0, 0, 1 };
+        break;
+
+    case winrt::ColorSpectrumComponents::ValueSaturation:
+    case winrt::ColorSpectrumComponents::SaturationValue:
+        thirdDimensionComponent = &scratch.hues;
+        thirdDimensionValues = { 0, 60, 120, 180, 240, 300 };
+        break;
     }
 
-    Hsv hsvMin = baseHsv;
-    Hsv hsvMiddle1 = baseHsv;
-    Hsv hsvMiddle2 = baseHsv;
-    Hsv hsvMiddle3 = baseHsv;
-    Hsv hsvMiddle4 = baseHsv;
-    Hsv hsvMax = baseHsv;
+    for (int row = firstRow; row < firstRow + rowCount; row++)
+    {
+        FillSpectrumRowHsv(parameters, row, 0 /* firstColumn */, pixelWidth, scratch);
+
+        const size_t rowPixelOffset = static_cast<size_t>(row) * pixelWidth;
+
+        for (int bitmap = 0; bitmap < c_spectrumBitmapCount; bitmap++)
+        {
+            ::byte* bgraBitmapPixelData = bgraPixelData[bitmap];
+
+            if (!bgraBitmapPixelData)
+            {
+                continue;
+            }
 
-    double r = 1 - distanceFromRadius / radius;
+            std::fill(thirdDimensionComponent->begin(), thirdDimensionComponent->end(), thirdDimensionValues[bitmap]);
+
+            HsvToBgraPixelData(
+                scratch.hues.data(),
+                scratch.saturations.data(),
+                scratch.values.data(),
+                pixelWidth,
+                bgraBitmapPixelData + rowPixelOffset * 4);
+        }
+    }
+}
 
-    double theta = atan2((radius - yToUse), (radius - xToUse)) * 180.0 / M_PI;
-    theta += 180.0;
-    theta = floor(theta);
+void ColorSpectrum::FillSpectrumRowHsv(
+    const SpectrumBitmapParameters& parameters,
+    int row,
+    int firstColumn,
+    int columnCount,
+    SpectrumRowScratch& scratch)
+{
+    double* firstAxisPercents = scratch.firstAxisPercents.data();
+    double* secondAxisPercents = scratch.secondAxisPercents.data();
 
-    while (theta > 360)
+    if (parameters.shape == winrt::ColorSpectrumShape::Box)
     {
-        theta -= 360;
+        FillAxisPercentsForBox(parameters, row, firstColumn, columnCount, firstAxisPercents, secondAxisPercents);
+    }
+    else
+    {
+        FillAxisPercentsForRing(parameters, row, firstColumn, columnCount, firstAxisPercents, secondAxisPercents);
     }
 
-    double thetaPercent = theta / 360;
+    const double hMin = parameters.minHue;
+    const double hMax = parameters.maxHue;
+    const double sMin = parameters.minSaturation / 100.0;
+    const double sMax = parameters.maxSaturation / 100.0;
+    const double vMin = parameters.minValue / 100.0;
+    const double vMax = parameters.maxValue / 100.0;
 
-    switch (components)
+    double* hues = scratch.hues.data();
+    double* saturations = scratch.saturations.data();
+    double* values = scratch.values.data();
+
+    // The third dimension is left at its minimum, which is 0 for each component.
+    std::fill_n(hues, columnCount, 0.0);
+    std::fill_n(saturations, columnCount, 0.0);
+    std::fill_n(values, columnCount, 0.0);
+
+    // Maps one axis onto one component. The switch below picks the pair of axes once per row
+    // instead of once per pixel.
+    auto mapAxis = [columnCount](const double* axisPercents, double min, double max, double* component)
+    {
+        for (int i = 0; i < columnCount; i++)
+        {
+            component[i] = min + axisPercents[i] * (max - min);
+        }
+    };
+
+    switch (parameters.components)
     {
     case winrt::ColorSpectrumComponents::HueValue:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + thetaPercent * (hMax - hMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + r * (vMax - vMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+        mapAxis(firstAxisPercents, hMin, hMax, hues);
+        mapAxis(secondAxisPercents, vMin, vMax, values);
         break;
 
     case winrt::ColorSpectrumComponents::HueSaturation:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + thetaPercent * (hMax - hMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + r * (sMax - sMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
+        mapAxis(firstAxisPercents, hMin, hMax, hues);
+        mapAxis(secondAxisPercents, sMin, sMax, saturations);
         break;
 
     case winrt::ColorSpectrumComponents::ValueHue:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + thetaPercent * (vMax - vMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + r * (hMax - hMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+        mapAxis(firstAxisPercents, vMin, vMax, values);
+        mapAxis(secondAxisPercents, hMin, hMax, hues);
         break;
 
     case winrt::ColorSpectrumComponents::ValueSaturation:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + thetaPercent * (vMax - vMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + r * (sMax - sMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
+        mapAxis(firstAxisPercents, vMin, vMax, values);
+        mapAxis(secondAxisPercents, sMin, sMax, saturations);
         break;
 
     case winrt::ColorSpectrumComponents::SaturationHue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + thetaPercent * (sMax - sMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + r * (hMax - hMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
+        mapAxis(firstAxisPercents, sMin, sMax, saturations);
+        mapAxis(secondAxisPercents, hMin, hMax, hues);
         break;
 
     case winrt::ColorSpectrumComponents::SaturationValue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + thetaPercent * (sMax - sMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + r * (vMax - vMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
+        mapAxis(firstAxisPercents, sMin, sMax, saturations);
+        mapAxis(secondAxisPercents, vMin, vMax, values);
         break;
     }
 
@@ -1343,68 +1338,106 @@ void ColorSpectrum::FillPixelForRing(
     // so we'll invert the number before assigning the HSL value to the array.
     // Otherwise, we'll have a very narrow section in the middle that actually has meaningful hue
     // in the case of the ring configuration.
-    if (components == winrt::ColorSpectrumComponents::HueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationHue)
+    if (parameters.components == winrt::ColorSpectrumComponents::HueSaturation ||
+        parameters.components == winrt::ColorSpectrumComponents::SaturationHue)
     {
-        hsvMin.s = sMax - hsvMin.s + sMin;
-        hsvMiddle1.s = sMax - hsvMiddle1.s + sMin;
-        hsvMiddle2.s = sMax - hsvMiddle2.s + sMin;
-        hsvMiddle3.s = sMax - hsvMiddle3.s + sMin;
-        hsvMiddle4.s = sMax - hsvMiddle4.s + sMin;
-        hsvMax.s = sMax - hsvMax.s + sMin;
+        for (int i = 0; i < columnCount; i++)
+        {
+            saturations[i] = sMax - saturations[i] + sMin;
+        }
     }
     else
     {
-        hsvMin.v = vMax - hsvMin.v + vMin;
-        hsvMiddle1.v = vMax - hsvMiddle1.v + vMin;
-        hsvMiddle2.v = vMax - hsvMiddle2.v + vMin;
-        hsvMiddle3.v = vMax - hsvMiddle3.v + vMin;
-        hsvMiddle4.v = vMax - hsvMiddle4.v + vMin;
-        hsvMax.v = vMax - hsvMax.v + vMin;
+        for (int i = 0; i < columnCount; i++)
+        {
+            values[i] = vMax - values[i] + vMin;
+        }
+    }
+}
+
+// The spectrum's first axis runs along the width of the box configuration, while the second
+// axis runs along the height.
+void ColorSpectrum::FillAxisPercentsForBox(
+    const SpectrumBitmapParameters& parameters,
+    int row,
+    int firstColumn,
+    int columnCount,
+    double* firstAxisPercents,
+    double* secondAxisPercents)
+{
+    const double maxIndex = parameters.pixelWidth - 1.0;
+    const double secondAxisPercent = row / maxIndex;
+
+    for (int i = 0; i < columnCount; i++)
+    {
+        firstAxisPercents[i] = (firstColumn + i) / maxIndex;
+        secondAxisPercents[i] = secondAxisPercent;
     }
+}
 
-    newHsvValues->push_back(hsvMin);
+// The spectrum's first axis runs along the angle in the ring configuration, while the second
+// axis runs along the radius.
+void ColorSpectrum::FillAxisPercentsForRing(
+    const SpectrumBitmapParameters& parameters,
+    int row,
+    int firstColumn,
+    int columnCount,
+    double* firstAxisPercents,
+    double* secondAxisPercents)
+{
+    const double radius = parameters.pixelWidth / 2.0;
+    const double y = row;
+    const double yOffset = y - radius;
+    const double yOffsetSquared = yOffset * yOffset;
 
-    Rgb rgbMin = HsvToRgb(hsvMin);
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.b * 255))); // b
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.g * 255))); // g
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.r * 255))); // r
-    bgraMinPixelData->push_back(255); // a
+    for (int i = 0; i < columnCount; i++)
+    {
+        const double x = firstColumn + i;
+        const double xOffset = x - radius;
+        double distanceFromRadius = sqrt(xOffset * xOffset + yOffsetSquared);
 
-    // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
-    {
-        Rgb rgbMiddle1 = HsvToRgb(hsvMiddle1);
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.b * 255))); // b
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.g * 255))); // g
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.r * 255))); // r
-        bgraMiddle1PixelData->push_back(255); // a
-
-        Rgb rgbMiddle2 = HsvToRgb(hsvMiddle2);
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.b * 255))); // b
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.g * 255))); // g
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.r * 255))); // r
-        bgraMiddle2PixelData->push_back(255); // a
-
-        Rgb rgbMiddle3 = HsvToRgb(hsvMiddle3);
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.b * 255))); // b
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.g * 255))); // g
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.r * 255))); // r
-        bgraMiddle3PixelData->push_back(255); // a
-
-        Rgb rgbMiddle4 = HsvToRgb(hsvMiddle4);
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.b * 255))); // b
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.g * 255))); // g
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.r * 255))); // r
-        bgraMiddle4PixelData->push_back(255); // a
-    }
-
-    Rgb rgbMax = HsvToRgb(hsvMax);
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.b * 255))); // b
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.g * 255))); // g
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.r * 255))); // r
-    bgraMaxPixelData->push_back(255); // a
+        double xToUse = x;
+        double yToUse = y;
+
+        // If we're outside the ring, then we want the pixel to appear as blank.
+        // However, to avoid issues with rounding errors, we'll act as though this point
+        // is on the edge of the ring for the purposes of returning an HSL value.
+        // That way, hittesting on the edges will always return the correct value.
+        if (distanceFromRadius > radius)
+        {
+            xToUse = (radius / distanceFromRadius) * xOffset + radius;
+            yToUse = (radius / distanceFromRadius) * yOffset + radius;
+            distanceFromRadius = radius;
+        }
+
+        double theta = atan2((radius - yToUse), (radius - xToUse)) * 180.0 / M_PI;
+        theta += 180.0;
+        theta = floor(theta);
+
+        while (theta > 360)
+        {
+            theta -= 360;
+        }
+
+        firstAxisPercents[i] = theta / 360;
+        secondAxisPercents[i] = 1 - distanceFromRadius / radius;
+    }
+}
+
+Hsv ColorSpectrum::GetHsvAtPixel(const SpectrumBitmapParameters& parameters, int x, int y)
+{
+    // Hit-testing goes through the same row kernels as bitmap generation, for a single pixel,
+    // so that the color under the pointer is always the color that was drawn there.
+    SpectrumRowScratch scratch(1);
+    FillSpectrumRowHsv(parameters, y, x /* firstColumn */, 1 /* columnCount */, scratch);
+    return Hsv{ scratch.hues[0], scratch.saturations[0], scratch.values[0] };
+}
+
+int ColorSpectrum::GetSpectrumWorkerCount()
+{
+    SYSTEM_INFO systemInfo{};
+    GetNativeSystemInfo(&systemInfo);
+    return max(1, min(static_cast<int>(systemInfo.dwNumberOfProcessors), c_spectrumMaxWorkerCount));
 }
 
 void ColorSpectrum::UpdateBitmapSources()
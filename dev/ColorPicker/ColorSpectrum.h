@@ -34,6 +34,8 @@ public:
     winrt::Rect GetBoundingRectangle();
     void RaiseColorChanged();
 
+    friend class ColorSpectrumTestHooks;
+
 private:
 
     // DependencyProperty changed event handlers
@@ -70,52 +72,107 @@ private:
 
     bool SelectionEllipseShouldBeLight();
 
+    // Inputs of the spectrum bitmap generation done by CreateBitmapsAndColorMap().
+    struct SpectrumBitmapParameters
+    {
+        int pixelWidth;
+        winrt::ColorSpectrumShape shape;
+        winrt::ColorSpectrumComponents components;
+        double minHue;
+        double maxHue;
+        double minSaturation;
+        double maxSaturation;
+        double minValue;
+        double maxValue;
+
+        bool operator==(const SpectrumBitmapParameters& other) const;
+    };
+
+    SpectrumBitmapParameters GetSpectrumBitmapParameters(int pixelWidth);
+
+    // Number of bitmaps generated for a spectrum: the minimum, the four middle ones used when hue is
+    // the third dimension, and the maximum.
+    static constexpr int c_spectrumBitmapCount = 6;
+
+    // Bitmap generation is split into tiles of this many rows, spread over at most this many threads.
+    static constexpr int c_spectrumRowsPerTile = 16;
+    static constexpr int c_spectrumMaxWorkerCount = 8;
+
+    // Pixel data generated for one set of SpectrumBitmapParameters. Middle bitmaps that
+    // weren't needed are left empty. Never modified once generated, so it can be shared.
+    struct SpectrumBitmapData
+    {
+        std::array<std::shared_ptr<std::vector<::byte>>, c_spectrumBitmapCount> bgraPixelData;
+
+        size_t GetByteCount() const;
+    };
+
+    // Per-thread storage reused for every row a thread fills.
+    struct SpectrumRowScratch
+    {
+        explicit SpectrumRowScratch(int pixelWidth);
+
+        std::vector<double> firstAxisPercents;
+        std::vector<double> secondAxisPercents;
+        std::vector<double> hues;
+        std::vector<double> saturations;
+        std::vector<double> values;
+    };
+
     // Helpers used by CreateBitmapsAndColorMap() to fill pixel data and create bitmaps from that data.
-    static void FillPixelForBox(
-        double x,
-        double y,
-        const Hsv &baseHsv,
-        double minDimension,
-        winrt::ColorSpectrumComponents components,
-        double minHue,
-        double maxHue,
-        double minSaturation,
-        double maxSaturation,
-        double minValue,
-        double maxValue,
-        std::shared_ptr<std::vector<byte>> bgraMinPixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle1PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle2PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle3PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle4PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMaxPixelData,
-        std::shared_ptr<std::vector<Hsv>> newHsvValues);
-    static void FillPixelForRing(
-        double x,
-        double y,
-        double radius,
-        const Hsv &baseHsv,
-        winrt::ColorSpectrumComponents components,
-        double minHue,
-        double maxHue,
-        double minSaturation,
-        double maxSaturation,
-        double minValue,
-        double maxValue,
-        std::shared_ptr<std::vector<byte>> bgraMinPixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle1PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle2PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle3PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle4PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMaxPixelData,
-        std::shared_ptr<std::vector<Hsv>> newHsvValues);
+    static void FillSpectrumRows(
+        const SpectrumBitmapParameters& parameters,
+        int firstRow,
+        int rowCount,
+        const std::array<::byte*, c_spectrumBitmapCount>& bgraPixelData,
+        SpectrumRowScratch& scratch);
+
+    // Fills scratch.hues/saturations/values for columnCount pixels of a row starting at firstColumn,
+    // with the third dimension at its minimum. The axis percents are computed by the box or ring kernel.
+    static void FillSpectrumRowHsv(
+        const SpectrumBitmapParameters& parameters,
+        int row,
+        int firstColumn,
+        int columnCount,
+        SpectrumRowScratch& scratch);
+    static void FillAxisPercentsForBox(
+        const SpectrumBitmapParameters& parameters,
+        int row,
+        int firstColumn,
+        int columnCount,
+        double* firstAxisPercents,
+        double* secondAxisPercents);
+    static void FillAxisPercentsForRing(
+        const SpectrumBitmapParameters& parameters,
+        int row,
+        int firstColumn,
+        int columnCount,
+        double* firstAxisPercents,
+        double* secondAxisPercents);
+
+    // Returns the color of the spectrum image generated with the given parameters at the given pixel,
+    // with the third dimension at its minimum. Used both to generate the images and to hit-test them.
+    static Hsv GetHsvAtPixel(const SpectrumBitmapParameters& parameters, int x, int y);
+    static int GetSpectrumWorkerCount();
+
+    void ApplyBitmapData(const SpectrumBitmapParameters& parameters, double minDimension, const SpectrumBitmapData& bitmapData);
+
+    // Process-wide cache of generated pixel data, so that spectra with the same parameters - several
+    // ColorPickers on a page, or one toggled back and forth between shapes - don't regenerate it.
+    // The least recently used entries are evicted once the cache holds more than c_spectrumBitmapCacheMaxByteCount.
+    static std::shared_ptr<SpectrumBitmapData> TryGetCachedBitmapData(const SpectrumBitmapParameters& parameters);
+    static void CacheBitmapData(const SpectrumBitmapParameters& parameters, const std::shared_ptr<SpectrumBitmapData>& bitmapData);
+
+    static constexpr size_t c_spectrumBitmapCacheMaxByteCount = 64 * 1024 * 1024;
+    static winrt::slim_mutex s_bitmapCacheLock;
+    static std::list<std::pair<SpectrumBitmapParameters, std::shared_ptr<SpectrumBitmapData>>> s_bitmapCache;
+    static size_t s_bitmapCacheByteCount;
 
     bool m_updatingColor;
     bool m_updatingHsvColor;
     bool m_isPointerOver;
     bool m_isPointerPressed;
     bool m_shouldShowLargeSelection;
-    std::vector<Hsv> m_hsvValues;
 
     // XAML elements
     winrt::Grid m_layoutRoot{ nullptr };
@@ -132,6 +189,8 @@ private:
     winrt::ToolTip m_colorNameToolTip{ nullptr };
 
     winrt::IAsyncAction m_createImageBitmapAction{ nullptr };
+    // Incremented by every CreateBitmapsAndColorMap() call. Only read and written on the UI thread.
+    uint64_t m_bitmapGeneration{ 0 };
 
     // On RS1 and before, we put the spectrum images in a bitmap,
     // which we then give to an ImageBrush.
@@ -175,6 +234,7 @@ private:
     int m_maxSaturationFromLastBitmapCreation{ 0 };
     int m_minValueFromLastBitmapCreation{ 0 };
     int m_maxValueFromLastBitmapCreation{ 0 };
+    SpectrumBitmapParameters m_bitmapParametersFromLastBitmapCreation{};
 
     winrt::Color m_oldColor{ 255, 255, 255, 255 };
     winrt::float4 m_oldHsvColor{ 0.0, 0.0, 1.0, 1.0 };
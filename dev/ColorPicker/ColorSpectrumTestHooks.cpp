@@ -0,0 +1,39 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ColorSpectrumTestHooks.h"
+
+ColorSpectrum::SpectrumBitmapParameters ColorSpectrumTestHooks::GetParameters(const winrt::ColorSpectrum& colorSpectrum, int pixelWidth, int row)
+{
+    if (!colorSpectrum)
+    {
+        throw winrt::hresult_invalid_argument(L"colorSpectrum cannot be null.");
+    }
+
+    if (pixelWidth < 2 || row < 0 || row >= pixelWidth)
+    {
+        throw winrt::hresult_invalid_argument(L"row must be within a spectrum at least 2 pixels wide.");
+    }
+
+    return winrt::get_self<ColorSpectrum>(colorSpectrum)->GetSpectrumBitmapParameters(pixelWidth);
+}
+
+winrt::com_array<double> ColorSpectrumTestHooks::GetSpectrumRowHsvValues(const winrt::ColorSpectrum& colorSpectrum, int pixelWidth, int row)
+{
+    const auto parameters = GetParameters(colorSpectrum, pixelWidth, row);
+
+    ColorSpectrum::SpectrumRowScratch scratch(pixelWidth);
+    ColorSpectrum::FillSpectrumRowHsv(parameters, row, 0 /* firstColumn */, pixelWidth, scratch);
+
+    winrt::com_array<double> hsvValues(pixelWidth * 3);
+    for (int i = 0; i < pixelWidth; i++)
+    {
+        hsvValues[i * 3] = scratch.hues[i];
+        hsvValues[i * 3 + 1] = scratch.saturations[i];
+        hsvValues[i * 3 + 2] = scratch.values[i];
+    }
+
+    return hsvValues;
+}
@@ -0,0 +1,20 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ColorSpectrum.h"
+
+#include "ColorSpectrumTestHooks.g.h"
+
+class ColorSpectrumTestHooks :
+    public winrt::implementation::ColorSpectrumTestHooksT<ColorSpectrumTestHooks>
+{
+public:
+    static winrt::com_array<double> GetSpectrumRowHsvValues(const winrt::ColorSpectrum& colorSpectrum, int pixelWidth, int row);
+
+private:
+    static ColorSpectrum::SpectrumBitmapParameters GetParameters(const winrt::ColorSpectrum& colorSpectrum, int pixelWidth, int row);
+};
+
+CppWinRTActivatableClassWithBasicFactory(ColorSpectrumTestHooks)
@@ -507,6 +507,40 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
             VerifySelectionEllipseIsNear(isRTL ? 66 : 191, 192);
         }
 
+        [TestMethod]
+        public void CanSelectColorFromRingSpectrum()
+        {
+            using (var setup = SetupColorPickerTest())
+            {
+                Log.Comment("Switch to the ring shape and wait for its image to load.");
+                CheckBox colorSpectrumLoadedCheckBox = new CheckBox(FindElement.ById("ColorSpectrumLoadedCheckBox"));
+                colorSpectrumLoadedCheckBox.Uncheck();
+
+                ComboBox colorSpectrumShapeComboBox = new ComboBox(FindElement.ById("ColorSpectrumShapeComboBox"));
+                colorSpectrumShapeComboBox.SelectItemById("ColorSpectrumShapeRing");
+
+                if (colorSpectrumLoadedCheckBox.ToggleState != ToggleState.On)
+                {
+                    colorSpectrumLoadedCheckBox.GetToggledWaiter().Wait();
+                }
+
+                // The expected colors are the ones the spectrum's per-pixel color map used to give for these points:
+                // hue goes around the ring and saturation increases towards its edge.
+                TapOnColorSpectrum(0.5, 0.1);
+                VerifySelectedColorIsNear(151, 52, 255);
+                TapOnColorSpectrum(0.9, 0.5);
+                VerifySelectedColorIsNear(255, 52, 55);
+                TapOnColorSpectrum(0.5, 0.9);
+                VerifySelectedColorIsNear(154, 255, 52);
+                TapOnColorSpectrum(0.1, 0.5);
+                VerifySelectedColorIsNear(52, 255, 253);
+
+                Log.Comment("Points outside of the ring select the color on its edge.");
+                TapOnColorSpectrum(0.02, 0.02);
+                VerifySelectedColorIsNear(0, 66, 255);
+            }
+        }
+
         [TestMethod]
         public void CanSelectPreviousColor()
         {
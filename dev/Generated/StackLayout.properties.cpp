@@ -8,6 +8,7 @@
 
 CppWinRTActivatableClassWithDPFactory(StackLayout)
 
+GlobalDependencyProperty StackLayoutProperties::s_IsMeasuredSizeIndexEnabledProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_OrientationProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_SpacingProperty{ nullptr };
 
@@ -18,6 +19,17 @@ StackLayoutProperties::StackLayoutProperties()
 
 void StackLayoutProperties::EnsureProperties()
 {
+    if (!s_IsMeasuredSizeIndexEnabledProperty)
+    {
+        s_IsMeasuredSizeIndexEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsMeasuredSizeIndexEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::StackLayout>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(false),
+                winrt::PropertyChangedCallback(&OnIsMeasuredSizeIndexEnabledPropertyChanged));
+    }
     if (!s_OrientationProperty)
     {
         s_OrientationProperty =
@@ -44,10 +56,19 @@ void StackLayoutProperties::EnsureProperties()
 
 void StackLayoutProperties::ClearProperties()
 {
+    s_IsMeasuredSizeIndexEnabledProperty = nullptr;
     s_OrientationProperty = nullptr;
     s_SpacingProperty = nullptr;
 }
 
+void StackLayoutProperties::OnIsMeasuredSizeIndexEnabledPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::StackLayout>();
+    winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
+}
+
 void StackLayoutProperties::OnOrientationPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -64,6 +85,16 @@ void StackLayoutProperties::OnSpacingPropertyChanged(
     winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
 }
 
+void StackLayoutProperties::IsMeasuredSizeIndexEnabled(bool value)
+{
+    static_cast<StackLayout*>(this)->SetValue(s_IsMeasuredSizeIndexEnabledProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool StackLayoutProperties::IsMeasuredSizeIndexEnabled()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<StackLayout*>(this)->GetValue(s_IsMeasuredSizeIndexEnabledProperty));
+}
+
 void StackLayoutProperties::Orientation(winrt::Orientation const& value)
 {
     static_cast<StackLayout*>(this)->SetValue(s_OrientationProperty, ValueHelper<winrt::Orientation>::BoxValueIfNecessary(value));
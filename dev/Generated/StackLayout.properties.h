@@ -9,21 +9,30 @@ class StackLayoutProperties
 public:
     StackLayoutProperties();
 
+    void IsMeasuredSizeIndexEnabled(bool value);
+    bool IsMeasuredSizeIndexEnabled();
+
     void Orientation(winrt::Orientation const& value);
     winrt::Orientation Orientation();
 
     void Spacing(double value);
     double Spacing();
 
+    static winrt::DependencyProperty IsMeasuredSizeIndexEnabledProperty() { return s_IsMeasuredSizeIndexEnabledProperty; }
     static winrt::DependencyProperty OrientationProperty() { return s_OrientationProperty; }
     static winrt::DependencyProperty SpacingProperty() { return s_SpacingProperty; }
 
+    static GlobalDependencyProperty s_IsMeasuredSizeIndexEnabledProperty;
     static GlobalDependencyProperty s_OrientationProperty;
     static GlobalDependencyProperty s_SpacingProperty;
 
     static void EnsureProperties();
     static void ClearProperties();
 
+    static void OnIsMeasuredSizeIndexEnabledPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnOrientationPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -8,6 +8,8 @@
 
 CppWinRTActivatableClassWithDPFactory(UniformGridLayout)
 
+GlobalDependencyProperty UniformGridLayoutProperties::s_HasFixedSizeItemsProperty{ nullptr };
+GlobalDependencyProperty UniformGridLayoutProperties::s_IsClosedFormLayoutEnabledProperty{ nullptr };
 GlobalDependencyProperty UniformGridLayoutProperties::s_ItemsJustificationProperty{ nullptr };
 GlobalDependencyProperty UniformGridLayoutProperties::s_ItemsStretchProperty{ nullptr };
 GlobalDependencyProperty UniformGridLayoutProperties::s_MaximumRowsOrColumnsProperty{ nullptr };
@@ -24,6 +26,28 @@ UniformGridLayoutProperties::UniformGridLayoutProperties()
 
 void UniformGridLayoutProperties::EnsureProperties()
 {
+    if (!s_HasFixedSizeItemsProperty)
+    {
+        s_HasFixedSizeItemsProperty =
+            InitializeDependencyProperty(
+                L"HasFixedSizeItems",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::UniformGridLayout>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(false),
+                winrt::PropertyChangedCallback(&OnHasFixedSizeItemsPropertyChanged));
+    }
+    if (!s_IsClosedFormLayoutEnabledProperty)
+    {
+        s_IsClosedFormLayoutEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsClosedFormLayoutEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::UniformGridLayout>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(false),
+                winrt::PropertyChangedCallback(&OnIsClosedFormLayoutEnabledPropertyChanged));
+    }
     if (!s_ItemsJustificationProperty)
     {
         s_ItemsJustificationProperty =
@@ -116,6 +140,8 @@ void UniformGridLayoutProperties::EnsureProperties()
 
 void UniformGridLayoutProperties::ClearProperties()
 {
+    s_HasFixedSizeItemsProperty = nullptr;
+    s_IsClosedFormLayoutEnabledProperty = nullptr;
     s_ItemsJustificationProperty = nullptr;
     s_ItemsStretchProperty = nullptr;
     s_MaximumRowsOrColumnsProperty = nullptr;
@@ -126,6 +152,22 @@ void UniformGridLayoutProperties::ClearProperties()
     s_OrientationProperty = nullptr;
 }
 
+void UniformGridLayoutProperties::OnHasFixedSizeItemsPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::UniformGridLayout>();
+    winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
+}
+
+void UniformGridLayoutProperties::OnIsClosedFormLayoutEnabledPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::UniformGridLayout>();
+    winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
+}
+
 void UniformGridLayoutProperties::OnItemsJustificationPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -190,6 +232,26 @@ void UniformGridLayoutProperties::OnOrientationPropertyChanged(
     winrt::get_self<UniformGridLayout>(owner)->OnPropertyChanged(args);
 }
 
+void UniformGridLayoutProperties::HasFixedSizeItems(bool value)
+{
+    static_cast<UniformGridLayout*>(this)->SetValue(s_HasFixedSizeItemsProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool UniformGridLayoutProperties::HasFixedSizeItems()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<UniformGridLayout*>(this)->GetValue(s_HasFixedSizeItemsProperty));
+}
+
+void UniformGridLayoutProperties::IsClosedFormLayoutEnabled(bool value)
+{
+    static_cast<UniformGridLayout*>(this)->SetValue(s_IsClosedFormLayoutEnabledProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool UniformGridLayoutProperties::IsClosedFormLayoutEnabled()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<UniformGridLayout*>(this)->GetValue(s_IsClosedFormLayoutEnabledProperty));
+}
+
 void UniformGridLayoutProperties::ItemsJustification(winrt::UniformGridLayoutItemsJustification const& value)
 {
     static_cast<UniformGridLayout*>(this)->SetValue(s_ItemsJustificationProperty, ValueHelper<winrt::UniformGridLayoutItemsJustification>::BoxValueIfNecessary(value));
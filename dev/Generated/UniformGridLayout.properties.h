@@ -9,6 +9,12 @@ class UniformGridLayoutProperties
 public:
     UniformGridLayoutProperties();
 
+    void HasFixedSizeItems(bool value);
+    bool HasFixedSizeItems();
+
+    void IsClosedFormLayoutEnabled(bool value);
+    bool IsClosedFormLayoutEnabled();
+
     void ItemsJustification(winrt::UniformGridLayoutItemsJustification const& value);
     winrt::UniformGridLayoutItemsJustification ItemsJustification();
 
@@ -33,6 +39,8 @@ public:
     void Orientation(winrt::Orientation const& value);
     winrt::Orientation Orientation();
 
+    static winrt::DependencyProperty HasFixedSizeItemsProperty() { return s_HasFixedSizeItemsProperty; }
+    static winrt::DependencyProperty IsClosedFormLayoutEnabledProperty() { return s_IsClosedFormLayoutEnabledProperty; }
     static winrt::DependencyProperty ItemsJustificationProperty() { return s_ItemsJustificationProperty; }
     static winrt::DependencyProperty ItemsStretchProperty() { return s_ItemsStretchProperty; }
     static winrt::DependencyProperty MaximumRowsOrColumnsProperty() { return s_MaximumRowsOrColumnsProperty; }
@@ -42,6 +50,8 @@ public:
     static winrt::DependencyProperty MinRowSpacingProperty() { return s_MinRowSpacingProperty; }
     static winrt::DependencyProperty OrientationProperty() { return s_OrientationProperty; }
 
+    static GlobalDependencyProperty s_HasFixedSizeItemsProperty;
+    static GlobalDependencyProperty s_IsClosedFormLayoutEnabledProperty;
     static GlobalDependencyProperty s_ItemsJustificationProperty;
     static GlobalDependencyProperty s_ItemsStretchProperty;
     static GlobalDependencyProperty s_MaximumRowsOrColumnsProperty;
@@ -54,6 +64,14 @@ public:
     static void EnsureProperties();
     static void ClearProperties();
 
+    static void OnHasFixedSizeItemsPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
+    static void OnIsClosedFormLayoutEnabledPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnItemsJustificationPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -2512,9 +2512,16 @@ std::vector<int> NavigationView::FindMovableItemsRecoverToPrimaryList(float avai
     }
 
     int i = 0;
-    while (i < size && availableWidth > 0)
+    while (availableWidth > 0)
     {
-        if (!m_topDataProvider.IsItemInPrimaryList(i) && !CollectionHelper::contains(includeItems, i))
+        // Jump to the next item in overflow instead of walking over the primary ones
+        i = std::min(m_topDataProvider.NextIndexNotInPrimaryList(i), size);
+        if (i == size)
+        {
+            break;
+        }
+
+        if (!CollectionHelper::contains(includeItems, i))
         {
             auto width = m_topDataProvider.GetWidthForItem(i);
             if (availableWidth >= width)
@@ -2543,19 +2550,16 @@ std::vector<int> NavigationView::FindMovableItemsToBeRemovedFromPrimaryList(floa
 {
     std::vector<int> toBeMoved;
 
-    int i = m_topDataProvider.Size() - 1;
+    int i = m_topDataProvider.PreviousIndexInPrimaryList(m_topDataProvider.Size() - 1);
     while (i >= 0 && widthAtLeastToBeRemoved > 0)
     {
-        if (m_topDataProvider.IsItemInPrimaryList(i))
+        if (!CollectionHelper::contains(excludeItems, i))
         {
-            if (!CollectionHelper::contains(excludeItems, i))
-            {
-                auto width = m_topDataProvider.GetWidthForItem(i);
-                toBeMoved.push_back(i);
-                widthAtLeastToBeRemoved -= width;
-            }
+            auto width = m_topDataProvider.GetWidthForItem(i);
+            toBeMoved.push_back(i);
+            widthAtLeastToBeRemoved -= width;
         }
-        i--;
+        i = m_topDataProvider.PreviousIndexInPrimaryList(i - 1);
     }
     
     return toBeMoved;
@@ -438,6 +438,107 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifyTopNavigationResizeWithManyItems()
+        {
+            const int itemCount = 250;
+            const int resizeCount = 100;
+            const int widthCount = 10;
+            NavigationView navView = null;
+            var expectedPrimaryCounts = new int[widthCount];
+
+            Func<double, NavigationView> createNavView = (width) =>
+            {
+                var result = new NavigationView() { PaneDisplayMode = NavigationViewPaneDisplayMode.Top, Width = width, Height = 100.0 };
+                for (int i = 0; i < itemCount; i++)
+                {
+                    result.MenuItems.Add(new NavigationViewItem() { Content = "Item " + i });
+                }
+                result.SelectedItem = result.MenuItems[0];
+                return result;
+            };
+
+            // A NavigationView laid out at a single width never runs the incremental solver, so it
+            // gives the split that the resized one has to end up with at that width.
+            for (int widthIndex = 0; widthIndex < widthCount; widthIndex++)
+            {
+                NavigationView referenceNavView = null;
+                RunOnUIThread.Execute(() =>
+                {
+                    referenceNavView = createNavView(400.0 + widthIndex * 100.0);
+                    MUXControlsTestApp.App.TestContentRoot = referenceNavView;
+                });
+
+                IdleSynchronizer.Wait();
+
+                RunOnUIThread.Execute(() =>
+                {
+                    expectedPrimaryCounts[widthIndex] = VerifyTopNavigationItemsSplit(referenceNavView, -1);
+                    Log.Comment("Width " + referenceNavView.Width + " keeps " + expectedPrimaryCounts[widthIndex] + " items in the primary list");
+                });
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView = createNavView(1000.0);
+                MUXControlsTestApp.App.TestContentRoot = navView;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                // Bounce the width back and forth so items keep moving between the primary and overflow lists.
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                for (int i = 0; i < resizeCount; i++)
+                {
+                    navView.Width = 400.0 + (i % widthCount) * 100.0;
+                    navView.UpdateLayout();
+                }
+                stopwatch.Stop();
+                Log.Comment("Resizing a top NavigationView with " + itemCount + " items " + resizeCount + " times took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                // Walk the widths again, shrinking and then growing, and check the split after every step.
+                for (int i = 0; i < 2 * widthCount; i++)
+                {
+                    int widthIndex = i < widthCount ? widthCount - 1 - i : i - widthCount;
+                    navView.Width = 400.0 + widthIndex * 100.0;
+                    navView.UpdateLayout();
+                    VerifyTopNavigationItemsSplit(navView, expectedPrimaryCounts[widthIndex]);
+                }
+
+                Verify.AreEqual(itemCount, navView.MenuItems.Count);
+                Verify.AreEqual(navView.MenuItems[0], navView.SelectedItem);
+            });
+        }
+
+        // Verifies that the primary list holds the first items in order and the overflow list holds the rest,
+        // and returns the number of primary items. Pass -1 as expectedPrimaryCount to skip checking it.
+        private int VerifyTopNavigationItemsSplit(NavigationView navView, int expectedPrimaryCount)
+        {
+            Grid rootGrid = VisualTreeHelper.GetChild(navView, 0) as Grid;
+            var primaryItems = (rootGrid.FindName("TopNavMenuItemsHost") as ListView).Items;
+            var overflowItems = (rootGrid.FindName("TopNavMenuItemsOverflowHost") as ListView).Items;
+
+            Verify.AreEqual(navView.MenuItems.Count, primaryItems.Count + overflowItems.Count, "Every item is either in the primary or in the overflow list");
+            Verify.IsTrue(primaryItems.Count > 0, "The selected item stays in the primary list");
+
+            for (int i = 0; i < primaryItems.Count; i++)
+            {
+                Verify.AreEqual(navView.MenuItems[i], primaryItems[i]);
+            }
+            for (int i = 0; i < overflowItems.Count; i++)
+            {
+                Verify.AreEqual(navView.MenuItems[primaryItems.Count + i], overflowItems[i]);
+            }
+
+            if (expectedPrimaryCount >= 0)
+            {
+                Verify.AreEqual(expectedPrimaryCount, primaryItems.Count, "Primary item count at width " + navView.Width);
+            }
+            return primaryItems.Count;
+        }
+
         [TestMethod]
         public void VerifySettingsItemToolTip()
         {
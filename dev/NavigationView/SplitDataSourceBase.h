@@ -5,6 +5,85 @@
 
 #include "Vector.h"
 
+// A Fenwick tree over a sequence of values: updating one value and summing any prefix are both O(log n).
+template<typename T>
+class PrefixSums
+{
+public:
+    // Builds the tree in linear time.
+    void Assign(std::vector<T> const& values)
+    {
+        const int size = static_cast<int>(values.size());
+        m_tree.assign(size + 1, T{});
+        for (int i = 1; i <= size; i++)
+        {
+            m_tree[i] += values[i - 1];
+            const int parent = i + (i & -i);
+            if (parent <= size)
+            {
+                m_tree[parent] += m_tree[i];
+            }
+        }
+    }
+
+    void Add(int index, T delta)
+    {
+        MUX_ASSERT(index >= 0 && index < Size());
+        for (int i = index + 1; i <= Size(); i += i & -i)
+        {
+            m_tree[i] += delta;
+        }
+    }
+
+    // Sum of the values in [0, end)
+    T Sum(int end) const
+    {
+        MUX_ASSERT(end >= 0 && end <= Size());
+        T sum{};
+        for (int i = end; i > 0; i -= i & -i)
+        {
+            sum += m_tree[i];
+        }
+        return sum;
+    }
+
+    // Sum of the values in [start, end)
+    T Sum(int start, int end) const
+    {
+        return Sum(end) - Sum(start);
+    }
+
+    // Returns the smallest index whose inclusive prefix sum reaches target, or Size() if there is none.
+    // Only meaningful when all the values are non-negative.
+    int LowerBound(T target) const
+    {
+        int step = 1;
+        while (step * 2 <= Size())
+        {
+            step *= 2;
+        }
+
+        int position = 0;
+        for (; step > 0; step /= 2)
+        {
+            if (position + step <= Size() && m_tree[position + step] < target)
+            {
+                position += step;
+                target -= m_tree[position];
+            }
+        }
+        return position;
+    }
+
+    int Size() const
+    {
+        return m_tree.empty() ? 0 : static_cast<int>(m_tree.size()) - 1;
+    }
+
+private:
+    std::vector<T> m_tree{};
+};
+
 // The same copy of .Net Collections like C# ObservableCollection<string> data is splitted into multiple Vectors.
 // For example, the raw data is:  Homes Apps Music | Microsoft Development
 // raw Data SplitDataSource is splitted into 3 ObservableVector which is owned by SplitVector:
@@ -17,6 +96,8 @@
 //  We never Add/Delete A,B and C Vector directly, but change the flag.
 //  If flag for Homes is changed from A to B, it asks A to remove it by indexInRawData first, then insert the new data to B vector with indexInRawData
 // SplitVector itself maintained the mapping between indexInRawData and indexInSplitVector.
+// SplitDataSourceBase also keeps per vector prefix sums of the flags and of the attached data, so counting
+// or summing the items of a vector over a range of the raw data, or finding its next item, is O(log n).
 template<typename T, typename SplitVectorID>
 class SplitVector
 {
@@ -118,8 +199,9 @@ public:
 
     int IndexFromIndexInOriginalVector(int indexInOriginalVector)
     {
-        auto pos = std::find(m_indexesInOriginalVector.begin(), m_indexesInOriginalVector.end(), indexInOriginalVector);
-        if (pos != m_indexesInOriginalVector.end())
+        // Items keep the raw data order in every SplitVector, so the indexes are sorted.
+        auto pos = std::lower_bound(m_indexesInOriginalVector.begin(), m_indexesInOriginalVector.end(), indexInOriginalVector);
+        if (pos != m_indexesInOriginalVector.end() && *pos == indexInOriginalVector)
         {
             return static_cast<int>(std::distance(m_indexesInOriginalVector.begin(), pos));
         }
@@ -155,6 +237,10 @@ public:
     void AttachedData(int index, typename AttachedDataType attachedData)
     {
         MUX_ASSERT(index >= 0 && index < RawDataSize());
+        if (m_prefixSumsValid)
+        {
+            m_attachedDataSums[m_flags[index]].Add(index, SummableAttachedData(attachedData) - SummableAttachedData(m_attachedData[index]));
+        }
         m_attachedData[index] = attachedData;
     }
 
@@ -169,6 +255,50 @@ public:
         {
             m_attachedData[i] = attachedData;
         }
+        m_prefixSumsValid = false;
+    }
+
+    // Number of items in [start, end) of the raw data which belong to vectorID
+    int RangeCount(int start, int end, SplitVectorID vectorID)
+    {
+        MUX_ASSERT(start >= 0 && start <= end && end <= RawDataSize());
+        EnsurePrefixSums();
+        return m_flagCounts[vectorID].Sum(start, end);
+    }
+
+    // Sum of the attached data for the items in [start, end) of the raw data which belong to vectorID
+    typename AttachedDataType RangeAttachedData(int start, int end, SplitVectorID vectorID)
+    {
+        MUX_ASSERT(start >= 0 && start <= end && end <= RawDataSize());
+        EnsurePrefixSums();
+        return m_attachedDataSums[vectorID].Sum(start, end);
+    }
+
+    // Returns the first index at or after start which belongs to vectorID, or RawDataSize() if there is none.
+    int NextIndexInVector(int start, SplitVectorID vectorID)
+    {
+        if (start >= RawDataSize())
+        {
+            return RawDataSize();
+        }
+
+        EnsurePrefixSums();
+        auto& counts = m_flagCounts[vectorID];
+        return counts.LowerBound(counts.Sum(std::max(start, 0)) + 1);
+    }
+
+    // Returns the last index at or before index which belongs to vectorID, or -1 if there is none.
+    int PreviousIndexInVector(int index, SplitVectorID vectorID)
+    {
+        if (index < 0)
+        {
+            return -1;
+        }
+
+        EnsurePrefixSums();
+        auto& counts = m_flagCounts[vectorID];
+        auto count = counts.Sum(std::min(index + 1, RawDataSize()));
+        return count > 0 ? counts.LowerBound(count) : -1;
     }
 
     std::shared_ptr<SplitVectorType> GetVectorForItem(int index)
@@ -200,6 +330,8 @@ public:
 
         if (m_flags[index] != newVectorID)
         {
+            EnsurePrefixSums();
+
             // remove from the old vector
             if (auto splitVector = GetVectorForItem(index))
             {
@@ -207,6 +339,11 @@ public:
             }
 
             // change flag
+            auto summableData = SummableAttachedData(m_attachedData[index]);
+            m_flagCounts[m_flags[index]].Add(index, -1);
+            m_attachedDataSums[m_flags[index]].Add(index, -summableData);
+            m_flagCounts[newVectorID].Add(index, 1);
+            m_attachedDataSums[newVectorID].Add(index, summableData);
             m_flags[index] = newVectorID;
 
             // insert item to vector which matches with the newVectorID
@@ -227,6 +364,9 @@ protected:
     virtual SplitVectorID DefaultVectorIDOnInsert() = 0;
     virtual AttachedDataType DefaultAttachedData() = 0;
 
+    // What an item's attached data adds up to in RangeAttachedData.
+    virtual AttachedDataType SummableAttachedData(typename AttachedDataType attachedData) { return attachedData; }
+
     int IndexOfImpl(const typename T& value, typename SplitVectorID vectorID)
     {
         int indexInOriginalVector = IndexOf(value);
@@ -269,6 +409,7 @@ protected:
 
         m_flags.clear();
         m_attachedData.clear();
+        m_prefixSumsValid = false;
     }
 
     void OnRemoveAt(int startIndex, int count)
@@ -300,6 +441,7 @@ protected:
             m_flags.push_back(defaultID);
             m_attachedData.push_back(defaultAttachedData);
         }
+        m_prefixSumsValid = false;
     }
 
     void Clear()
@@ -323,6 +465,7 @@ private:
         
         m_flags.erase(m_flags.begin() + index);
         m_attachedData.erase(m_attachedData.begin() + index);
+        m_prefixSumsValid = false;
     }
 
     void OnReplace(int index)
@@ -352,28 +495,51 @@ private:
 
         m_flags.insert(m_flags.begin() + index, vectorID);
         m_attachedData.insert(m_attachedData.begin() + index, defaultAttachedData);
+        m_prefixSumsValid = false;
     }
 
     int GetPreferIndex(int index, SplitVectorID vectorID)
     {
-        return RangeCount(0, index, vectorID);
+        if (!m_prefixSumsValid)
+        {
+            // A batch of raw data inserts shifts every index after it, so count directly instead of
+            // rebuilding the prefix sums for each inserted item. They are rebuilt on the next query.
+            return static_cast<int>(std::count(m_flags.begin(), m_flags.begin() + index, vectorID));
+        }
+        return m_flagCounts[vectorID].Sum(index);
     }
 
-    int RangeCount(int start, int end, SplitVectorID vectorID)
+    void EnsurePrefixSums()
     {
-        int count = 0;
-        for (int i = start; i < end; i++)
+        if (!m_prefixSumsValid)
         {
-            if (m_flags[i] == vectorID)
+            const auto size = m_flags.size();
+            for (int id = 0; id < SplitVectorSize; id++)
             {
-                count++;
+                std::vector<int> counts(size);
+                std::vector<typename AttachedDataType> attachedData(size);
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (static_cast<int>(m_flags[i]) == id)
+                    {
+                        counts[i] = 1;
+                        attachedData[i] = SummableAttachedData(m_attachedData[i]);
+                    }
+                }
+                m_flagCounts[id].Assign(counts);
+                m_attachedDataSums[id].Assign(attachedData);
             }
+            m_prefixSumsValid = true;
         }
-        return count;
     }
 private:
     // length is the same as data source, and used to identify which SplitVector it belongs to.
     std::vector<typename SplitVectorID> m_flags{ };
     std::vector<typename AttachedDataType> m_attachedData{ };
     std::array<std::shared_ptr<SplitVectorType>, SplitVectorSize> m_splitVectors{};
+
+    // Per SplitVectorID prefix sums over the raw data, rebuilt lazily after the raw data changes.
+    std::array<PrefixSums<int>, SplitVectorSize> m_flagCounts{};
+    std::array<PrefixSums<typename AttachedDataType>, SplitVectorSize> m_attachedDataSums{};
+    bool m_prefixSumsValid{ false };
 };
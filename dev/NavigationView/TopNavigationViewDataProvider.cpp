@@ -104,6 +104,12 @@ float TopNavigationViewDataProvider::DefaultAttachedData()
     return std::numeric_limits<float>::min();
 }
 
+float TopNavigationViewDataProvider::SummableAttachedData(float width)
+{
+    // Same as GetWidthForItem, an unknown width counts as 0
+    return IsValidWidth(width) ? width : 0.f;
+}
+
 void TopNavigationViewDataProvider::MoveAllItemsToPrimaryList()
 {
     for (int i = 0; i < Size(); i++)
@@ -157,9 +163,9 @@ int TopNavigationViewDataProvider::GetPrimaryListSize()
 int TopNavigationViewDataProvider::GetNavigationViewItemCountInPrimaryList()
 {
     int count = 0;
-    for (int i = 0; i < Size(); i++)
+    for (int i = NextIndexInVector(0, PrimaryList); i < Size(); i = NextIndexInVector(i + 1, PrimaryList))
     {
-        if (IsItemInPrimaryList(i) && IsContainerNavigationViewItem(i))
+        if (IsContainerNavigationViewItem(i))
         {
             count++;
         }
@@ -193,12 +199,9 @@ void TopNavigationViewDataProvider::UpdateWidthForPrimaryItem(int indexInPrimary
 float TopNavigationViewDataProvider::WidthRequiredToRecoveryAllItemsToPrimary()
 {
     auto width = 0.f;
-    for (int i=0; i<Size(); i++)
+    for (auto vectorID : { NotInitialized, OverflowList, SkippedList })
     {
-        if (!IsItemInPrimaryList(i))
-        {
-            width += GetWidthForItem(i);
-        }
+        width += RangeAttachedData(0, RawDataSize(), vectorID);
     }
     width -= m_overflowButtonCachedWidth;
     return std::max(0.f, width);
@@ -313,18 +316,15 @@ bool TopNavigationViewDataProvider::IsValidWidthForItem(int index)
 void TopNavigationViewDataProvider::InvalidWidthCacheIfOverflowItemContentChanged()
 {
     bool shouldRefreshCache = false;
-    for (int i = 0; i < Size(); i++)
+    for (int i = NextIndexNotInPrimaryList(0); i < Size(); i = NextIndexNotInPrimaryList(i + 1))
     {
-        if (!IsItemInPrimaryList(i))
+        if (auto navItem = GetAt(i).try_as<winrt::NavigationViewItem>())
         {
-            if (auto navItem = GetAt(i).try_as<winrt::NavigationViewItem>())
+            auto itemPointer = winrt::get_self<NavigationViewItem>(navItem);
+            if (itemPointer->IsContentChangeHandlingDelayedForTopNav())
             {
-                auto itemPointer = winrt::get_self<NavigationViewItem>(navItem);
-                if (itemPointer->IsContentChangeHandlingDelayedForTopNav())
-                {
-                    itemPointer->ClearIsContentChangeHandlingDelayedForTopNavFlag();
-                    shouldRefreshCache = true;
-                }
+                itemPointer->ClearIsContentChangeHandlingDelayedForTopNavFlag();
+                shouldRefreshCache = true;
             }
         }
     }
@@ -337,7 +337,7 @@ void TopNavigationViewDataProvider::InvalidWidthCacheIfOverflowItemContentChange
 
 void TopNavigationViewDataProvider::SetWidthForItem(int index, float width)
 {
-    if (IsValidWidth(width))
+    if (IsValidWidth(width) && AttachedData(index) != width)
     {
         AttachedData(index, width);
     }
@@ -375,6 +375,21 @@ bool TopNavigationViewDataProvider::IsItemInPrimaryList(int index)
     return GetVectorIDForItem(index) == PrimaryList;
 }
 
+int TopNavigationViewDataProvider::NextIndexNotInPrimaryList(int start)
+{
+    int next = RawDataSize();
+    for (auto vectorID : { NotInitialized, OverflowList, SkippedList })
+    {
+        next = std::min(next, NextIndexInVector(start, vectorID));
+    }
+    return next;
+}
+
+int TopNavigationViewDataProvider::PreviousIndexInPrimaryList(int index)
+{
+    return PreviousIndexInVector(index, PrimaryList);
+}
+
 bool TopNavigationViewDataProvider::IsContainerNavigationViewItem(int index)
 {
     bool isContainerNavigationViewItem = true;
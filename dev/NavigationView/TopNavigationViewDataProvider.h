@@ -37,6 +37,7 @@ public:
     int Size() override;
     NavigationViewSplitVectorID DefaultVectorIDOnInsert() override;
     float DefaultAttachedData() override;
+    float SummableAttachedData(float width) override;
 
     void MoveAllItemsToPrimaryList();
     std::vector<int> ConvertPrimaryIndexToIndex(std::vector<int> const& indexesInPrimary);
@@ -58,6 +59,10 @@ public:
     float OverflowButtonWidth();
     void OverflowButtonWidth(float width);
     bool IsItemInPrimaryList(int index);
+    // Returns the first item at or after start which is not in primary list, or Size() if there is none.
+    int NextIndexNotInPrimaryList(int start);
+    // Returns the last item at or before index which is in primary list, or -1 if there is none.
+    int PreviousIndexInPrimaryList(int index);
     bool HasInvalidWidth(std::vector<int> & items);
     bool IsValidWidthForItem(int index);
 
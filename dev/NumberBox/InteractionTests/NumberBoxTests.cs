@@ -405,6 +405,9 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
                     { "(10)", 10 },         // number in parens
                     { "(-9)", -9 },         // negative number in parens
                     { "0^0", 1 },           // who knew?
+                    { "2*-3", -6 },         // negative number right after an operator
+                    { "-0.5 * 4", -2 },
+                    { "(1+2)*(3+4)^2", 147 },
 
                     // These should not parse, which means they will reset back to the previous value.
                     { "5x + 3y", resetValue },        // invalid chars
@@ -415,6 +418,8 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
                     { "9 - * 7",  resetValue },
                     { "9 - - 7",  resetValue },
                     { "+9", resetValue },
+                    { "-", resetValue },              // sign without a number
+                    { "4 - -", resetValue },
                     { "1 / 0", resetValue },          // divide by zero
 
                     // These don't currently work, but maybe should.
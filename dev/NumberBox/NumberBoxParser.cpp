@@ -8,13 +8,16 @@
 
 static constexpr wstring_view c_numberBoxOperators{ L"+-*/^"sv };
 
-// Returns list of MathTokens from expression input string. If there are any parsing errors, it returns an empty vector.
-std::vector<MathToken> NumberBoxParser::GetTokens(const wchar_t* input, const winrt::INumberParser& numberParser)
+// Characters that end a number, in addition to whitespace.
+static constexpr wstring_view c_numberBoxNumberTerminators{ L"+-*/^()"sv };
+
+// Fills tokens with the MathTokens of the expression input string. If there are any parsing errors, tokens is left empty.
+void NumberBoxParser::GetTokens(std::wstring_view input, const winrt::INumberParser& numberParser, std::vector<MathToken>& tokens)
 {
-    auto tokens = std::vector<MathToken>();
+    tokens.clear();
 
     bool expectNumber = true;
-    while (input[0] != '\0')
+    while (!input.empty())
     {
         // Skip spaces
         auto nextChar = input[0];
@@ -34,13 +37,14 @@ std::vector<MathToken> NumberBoxParser::GetTokens(const wchar_t* input, const wi
                     if (charLength > 0)
                     {
                         tokens.push_back(MathToken(MathTokenType::Numeric, value));
-                        input += charLength - 1; // advance the end of the token
+                        input.remove_prefix(charLength - 1); // advance the end of the token
                         expectNumber = false; // next token should be an operator
                     }
                     else
                     {
                         // Error case -- next token is not a number
-                        return {};
+                        tokens.clear();
+                        return;
                     }
                 }
             }
@@ -59,33 +63,38 @@ std::vector<MathToken> NumberBoxParser::GetTokens(const wchar_t* input, const wi
                 else
                 {
                     // Error case -- could not evaluate part of the expression
-                    return {};
+                    tokens.clear();
+                    return;
                 }
             }
         }
 
-        input++;
+        input.remove_prefix(1);
     }
-
-    return tokens;
 }
 
 // Attempts to parse a number from the beginning of the given input string. Returns the character size of the matched string.
-std::tuple<double, size_t> NumberBoxParser::GetNextNumber(const std::wstring& input, const winrt::INumberParser& numberParser)
+std::tuple<double, size_t> NumberBoxParser::GetNextNumber(std::wstring_view input, const winrt::INumberParser& numberParser)
 {
-    // Attempt to parse anything before an operator or space as a number
-    std::wregex regex(L"^-?([^-+/*\\(\\)\\^\\s]+)");
-    std::wsmatch match;
-    if (std::regex_search(input.cbegin(), input.cend(), match, regex))
+    // Attempt to parse anything before an operator or space as a number, optionally preceded by a minus sign.
+    size_t length = (!input.empty() && input[0] == L'-') ? 1 : 0;
+    const size_t digitsBegin = length;
+    while (length < input.size() &&
+        c_numberBoxNumberTerminators.find(input[length]) == std::wstring_view::npos &&
+        !iswspace(input[length]))
+    {
+        length++;
+    }
+
+    if (length > digitsBegin)
     {
-        // Might be a number
-        const auto matchLength = match[0].length();
-        const auto parsedNum = numberParser.ParseDouble(input.substr(0, matchLength));
+        // Might be a number, only the candidate span is handed to the parser
+        const auto parsedNum = numberParser.ParseDouble(input.substr(0, length));
 
         if (parsedNum)
         {
             // Parsing was successful
-            return { parsedNum.Value(), matchLength };
+            return { parsedNum.Value(), length };
         }
     }
 
@@ -107,10 +116,11 @@ int NumberBoxParser::GetPrecedenceValue(wchar_t c)
     return opPrecedence;
 }
 
-// Converts a list of tokens from infix format (e.g. "3 + 5") to postfix (e.g. "3 5 +")
-std::vector<MathToken> NumberBoxParser::ConvertInfixToPostfix(const std::vector<MathToken>& infixTokens)
+// Converts a list of tokens from infix format (e.g. "3 + 5") to postfix (e.g. "3 5 +"). If the parenthesis
+// don't match, postfixTokens is left empty.
+void NumberBoxParser::ConvertInfixToPostfix(const std::vector<MathToken>& infixTokens, std::vector<MathToken>& postfixTokens)
 {
-    std::vector<MathToken> postfixTokens;
+    postfixTokens.clear();
     std::stack<MathToken> operatorStack;
 
     for (auto const token : infixTokens)
@@ -154,7 +164,8 @@ std::vector<MathToken> NumberBoxParser::ConvertInfixToPostfix(const std::vector<
                 if (operatorStack.empty())
                 {
                     // Broken parenthesis
-                    return {};
+                    postfixTokens.clear();
+                    return;
                 }
 
                 // Pop left paren and discard
@@ -169,14 +180,13 @@ std::vector<MathToken> NumberBoxParser::ConvertInfixToPostfix(const std::vector<
         if (operatorStack.top().Type == MathTokenType::Parenthesis)
         {
             // Broken parenthesis
-            return {};
+            postfixTokens.clear();
+            return;
         }
 
         postfixTokens.push_back(operatorStack.top());
         operatorStack.pop();
     }
-
-    return postfixTokens;
 }
 
 winrt::IReference<double> NumberBoxParser::ComputePostfixExpression(const std::vector<MathToken>& tokens)
@@ -254,12 +264,20 @@ winrt::IReference<double> NumberBoxParser::ComputePostfixExpression(const std::v
 
 winrt::IReference<double> NumberBoxParser::Compute(const std::wstring_view expr, const winrt::INumberParser& numberParser)
 {
+    // An expression never has more tokens than characters, so reserving up front keeps the
+    // vectors from growing while tokenizing. These are locals rather than shared buffers
+    // because numberParser is app code and may evaluate another expression re-entrantly.
+    std::vector<MathToken> tokens;
+    tokens.reserve(expr.size());
+    std::vector<MathToken> postfixTokens;
+    postfixTokens.reserve(expr.size());
+
     // Tokenize the input string
-    auto tokens = GetTokens(expr.data(), numberParser);
+    GetTokens(expr, numberParser, tokens);
     if (tokens.size() > 0)
     {
         // Rearrange to postfix notation
-        auto postfixTokens = ConvertInfixToPostfix(tokens);
+        ConvertInfixToPostfix(tokens, postfixTokens);
         if (postfixTokens.size() > 0)
         {
             // Compute expression
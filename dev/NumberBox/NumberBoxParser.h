@@ -5,7 +5,6 @@
 
 #include "pch.h"
 #include "common.h"
-#include <regex>
 #include <stack>
 
 enum MathTokenType
@@ -31,12 +30,12 @@ class NumberBoxParser
         static winrt::IReference<double> Compute(const std::wstring_view expr, const winrt::INumberParser& numberParser);
 
     private:
-        static std::vector<MathToken> GetTokens(const wchar_t *input, const winrt::INumberParser& numberParser);
+        static void GetTokens(std::wstring_view input, const winrt::INumberParser& numberParser, std::vector<MathToken>& tokens);
 
-        static std::tuple<double, size_t> GetNextNumber(const std::wstring& input, const winrt::INumberParser& numberParser);
+        static std::tuple<double, size_t> GetNextNumber(std::wstring_view input, const winrt::INumberParser& numberParser);
         static int GetPrecedenceValue(wchar_t c);
 
-        static std::vector<MathToken> ConvertInfixToPostfix(const std::vector<MathToken>& tokens);
+        static void ConvertInfixToPostfix(const std::vector<MathToken>& tokens, std::vector<MathToken>& postfixTokens);
 
         static winrt::IReference<double> ComputePostfixExpression(const std::vector<MathToken>& tokens);
 };
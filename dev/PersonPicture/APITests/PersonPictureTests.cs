@@ -5,6 +5,7 @@ using System;
 using System.Reflection;
 using System.Threading;
 using Windows.ApplicationModel.Contacts;
+using Windows.Storage.Streams;
 using Windows.UI.Xaml.Automation;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Media;
@@ -160,6 +161,67 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             IdleSynchronizer.Wait();
         }
 
+        [TestMethod]
+        public void VerifyContactPictureIsDecodedAtDisplaySizeAndShared()
+        {
+            Contact contact = null;
+            PersonPicture firstPersonPicture = null;
+            PersonPicture secondPersonPicture = null;
+            StackPanel root = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                contact = new Contact();
+                contact.FirstName = "FirstName";
+                contact.Thumbnail = RandomAccessStreamReference.CreateFromUri(new Uri("ms-appx:///Assets/StoreLogo.png"));
+
+                root = new StackPanel();
+                firstPersonPicture = new PersonPicture() { Width = 32, Height = 32 };
+                root.Children.Add(firstPersonPicture);
+                MUXControlsTestApp.App.TestContentRoot = root;
+                firstPersonPicture.Contact = contact;
+            });
+
+            IdleSynchronizer.Wait();
+
+            // The picture is loaded asynchronously.
+            BitmapImage firstImage = null;
+            for (int attempt = 0; attempt < 50 && firstImage == null; attempt++)
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    var imageBrush = firstPersonPicture.TemplateSettings.ActualImageBrush;
+                    firstImage = imageBrush != null ? imageBrush.ImageSource as BitmapImage : null;
+                });
+
+                if (firstImage == null)
+                {
+                    Thread.Sleep(100);
+                }
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsNotNull(firstImage);
+                Verify.AreEqual(DecodePixelType.Logical, firstImage.DecodePixelType);
+                Verify.AreEqual(32, Math.Max(firstImage.DecodePixelWidth, firstImage.DecodePixelHeight));
+
+                Log.Comment("A second PersonPicture of the same size should reuse the decoded picture.");
+                secondPersonPicture = new PersonPicture() { Width = 32, Height = 32 };
+                root.Children.Add(secondPersonPicture);
+                secondPersonPicture.Contact = contact;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var imageBrush = secondPersonPicture.TemplateSettings.ActualImageBrush;
+                Verify.IsNotNull(imageBrush);
+                Verify.AreSame(firstImage, imageBrush.ImageSource);
+            });
+        }
+
         [TestMethod]
         public void VerifyVSMStatesForPhotosAndInitials()
         {
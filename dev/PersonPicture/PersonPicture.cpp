@@ -10,6 +10,7 @@
 #include "Utils.h"
 #include "RuntimeProfiler.h"
 #include "PersonPictureTemplateSettings.h"
+#include "PersonPictureImageCache.h"
 
 PersonPicture::PersonPicture()
 {
@@ -25,6 +26,7 @@ PersonPicture::PersonPicture()
 
 void PersonPicture::LoadImageAsync(
     std::shared_ptr<winrt::IRandomAccessStreamReference> thumbStreamReference,
+    int decodePixelSize,
     std::function<void(winrt::BitmapImage)> completedFunction)
 {
     com_ptr<PersonPicture> strongThis = get_strong();
@@ -32,14 +34,18 @@ void PersonPicture::LoadImageAsync(
 
     operation.Completed(
         winrt::AsyncOperationCompletedHandler<winrt::IRandomAccessStreamWithContentType>(
-            [strongThis, completedFunction](
+            [strongThis, decodePixelSize, completedFunction](
                 winrt::IAsyncOperation<winrt::IRandomAccessStreamWithContentType> operation,
                 winrt::AsyncStatus asyncStatus)
     {
         strongThis->m_dispatcherHelper.RunAsync(
-            [strongThis, asyncStatus, completedFunction, operation]()
+            [strongThis, asyncStatus, decodePixelSize, completedFunction, operation]()
         {
-            winrt::BitmapImage bitmap;
+            // Loading was canceled or restarted for another contact, don't touch the newer load.
+            if (strongThis->m_profilePictureReadAsync.get() != operation)
+            {
+                return;
+            }
 
             // Handle the failure case here to ensure we are on the UI thread.
             if (asyncStatus != winrt::AsyncStatus::Completed)
@@ -48,12 +54,32 @@ void PersonPicture::LoadImageAsync(
                 return;
             }
 
+            winrt::BitmapImage bitmap;
+
+            // Decode straight at the size we display the picture at rather than at the size of the source.
+            // Logical sizes get scaled by the display's scale factor when decoding.
+            if (decodePixelSize > 0)
+            {
+                bitmap.DecodePixelType(winrt::DecodePixelType::Logical);
+                bitmap.DecodePixelWidth(decodePixelSize);
+            }
+
             try
             {
-                bitmap.SetSourceAsync(operation.GetResults()).Completed(
+                auto setSourceAction = bitmap.SetSourceAsync(operation.GetResults());
+                strongThis->m_profilePictureSetSourceAsync.set(setSourceAction);
+                setSourceAction.Completed(
                     winrt::AsyncActionCompletedHandler(
-                        [strongThis, completedFunction, bitmap](winrt::IAsyncAction, winrt::AsyncStatus asyncStatus)
+                        [strongThis, completedFunction, bitmap, operation](winrt::IAsyncAction action, winrt::AsyncStatus asyncStatus)
                 {
+                    if (strongThis->m_profilePictureSetSourceAsync.get() != action ||
+                        strongThis->m_profilePictureReadAsync.get() != operation)
+                    {
+                        return;
+                    }
+
+                    strongThis->m_profilePictureSetSourceAsync.set(nullptr);
+
                     if (asyncStatus != winrt::AsyncStatus::Completed)
                     {
                         strongThis->m_profilePictureReadAsync.set(nullptr);
@@ -67,6 +93,7 @@ void PersonPicture::LoadImageAsync(
             catch (winrt::hresult_error &e)
             {
                 strongThis->m_profilePictureReadAsync.set(nullptr);
+                strongThis->m_profilePictureSetSourceAsync.set(nullptr);
 
                 // Ignore the exception if the image is invalid
                 if (e.to_abi() == E_INVALIDARG)
@@ -84,6 +111,33 @@ void PersonPicture::LoadImageAsync(
     m_profilePictureReadAsync.set(operation);
 }
 
+void PersonPicture::CancelImageLoad()
+{
+    if (auto profilePictureReadAsync = m_profilePictureReadAsync.get())
+    {
+        profilePictureReadAsync.Cancel();
+        m_profilePictureReadAsync.set(nullptr);
+    }
+
+    if (auto profilePictureSetSourceAsync = m_profilePictureSetSourceAsync.get())
+    {
+        profilePictureSetSourceAsync.Cancel();
+        m_profilePictureSetSourceAsync.set(nullptr);
+    }
+}
+
+int PersonPicture::GetDecodePixelSize()
+{
+    // Width and Height are kept equal by OnSizeChanged, use the shorter one in case they are not yet.
+    const double size = std::min(Width(), Height());
+    if (!(size > 0.0) || std::isinf(size))
+    {
+        return 0;
+    }
+
+    return static_cast<int>(std::ceil(size));
+}
+
 winrt::AutomationPeer PersonPicture::OnCreateAutomationPeer()
 {
     return winrt::make<PersonPictureAutomationPeer>(*this);
@@ -412,6 +466,9 @@ void PersonPicture::UpdateControlForContact(bool isNewContact)
 
     if (!contact)
     {
+        // The control may be getting recycled, nothing should keep decoding the previous contact's picture.
+        CancelImageLoad();
+
         // Explicitly setting to empty/nullptr ensures the bound XAML is
         // correctly updated.
         m_contactDisplayNameInitials.set(L"");
@@ -423,10 +480,7 @@ void PersonPicture::UpdateControlForContact(bool isNewContact)
     // It's possible for a second update to occur before the first finished loading
     // a profile picture (regardless of second having a picture or not).
     // Cancellation of any previously-activated tasks will mitigate race conditions.
-    if (auto profilePictureReadAsync = m_profilePictureReadAsync.get())
-    {
-        profilePictureReadAsync.Cancel();
-    }
+    CancelImageLoad();
 
     m_contactDisplayNameInitials.set(InitialsGenerator::InitialsFromContactObject(contact));
 
@@ -469,28 +523,38 @@ void PersonPicture::UpdateControlForContact(bool isNewContact)
         // The dispatcher is not available in design mode, so when in design mode bypass the call to LoadImageAsync.
         if (!SharedHelpers::IsInDesignMode())
         {
-            com_ptr<PersonPicture> strongThis = get_strong();
+            const int decodePixelSize = GetDecodePixelSize();
+            m_contactImageDecodePixelSize = decodePixelSize;
 
-            LoadImageAsync(
-                thumbStreamReference,
-                [strongThis](winrt::BitmapImage profileBitmap)
+            auto& imageCache = PersonPictureImageCache::GetForCurrentThread();
+            if (auto cachedBitmap = imageCache.TryGet(*thumbStreamReference, decodePixelSize))
+            {
+                m_contactImageSource.set(winrt::ImageSource(cachedBitmap));
+            }
+            else
             {
-                profileBitmap.DecodePixelType(winrt::DecodePixelType::Logical);
+                com_ptr<PersonPicture> strongThis = get_strong();
 
-                // We want to constrain the shorter side to the same dimension as the control, allowing the decoder to
-                // choose the other dimension without distorting the image.
-                if (profileBitmap.PixelHeight() < profileBitmap.PixelWidth())
-                {
-                    profileBitmap.DecodePixelHeight(static_cast<int>(strongThis->Height()));
-                }
-                else
+                LoadImageAsync(
+                    thumbStreamReference,
+                    decodePixelSize,
+                    [strongThis, thumbStreamReference, decodePixelSize](winrt::BitmapImage profileBitmap)
                 {
-                    profileBitmap.DecodePixelWidth(static_cast<int>(strongThis->Width()));
-                }
+                    // The decode width was set up front. We want to constrain the shorter side to the same dimension
+                    // as the control, allowing the decoder to choose the other dimension without distorting the image,
+                    // so landscape pictures are decoded again by height.
+                    if (decodePixelSize > 0 && profileBitmap.PixelHeight() < profileBitmap.PixelWidth())
+                    {
+                        profileBitmap.DecodePixelWidth(0);
+                        profileBitmap.DecodePixelHeight(decodePixelSize);
+                    }
 
-                strongThis->m_contactImageSource.set(winrt::ImageSource(profileBitmap));
-                strongThis->UpdateIfReady();
-            });
+                    PersonPictureImageCache::GetForCurrentThread().Add(*thumbStreamReference, decodePixelSize, profileBitmap);
+
+                    strongThis->m_contactImageSource.set(winrt::ImageSource(profileBitmap));
+                    strongThis->UpdateIfReady();
+                });
+            }
         }
     }
     else
@@ -588,6 +652,12 @@ void PersonPicture::OnSizeChanged(winrt::IInspectable const& /*sender*/, const w
 
         Height(newSize);
         Width(newSize);
+
+        // The contact's picture was decoded for the previous size.
+        if (Contact() && m_contactImageDecodePixelSize != GetDecodePixelSize())
+        {
+            UpdateControlForContact(false /* isNewContact */);
+        }
     }
 
     // Calculate the FontSize of the control's text. Design guidelines have specified the
@@ -618,8 +688,5 @@ void PersonPicture::OnSizeChanged(winrt::IInspectable const& /*sender*/, const w
 
 void PersonPicture::OnUnloaded(winrt::IInspectable const& /*sender*/, winrt::RoutedEventArgs const& /*e*/)
 {
-    if (auto profilePictureReadAsync = m_profilePictureReadAsync.get())
-    {
-        profilePictureReadAsync.Cancel();
-    }
+    CancelImageLoad();
 }
@@ -80,8 +80,19 @@ private:
     // Helper functions
     void LoadImageAsync(
         std::shared_ptr<winrt::IRandomAccessStreamReference> thumbStreamReference,
+        int decodePixelSize,
         std::function<void(winrt::BitmapImage)> completedFunction);
 
+    /// <summary>
+    /// Cancels the loading of the contact's profile picture, if any.
+    /// </summary>
+    void CancelImageLoad();
+
+    /// <summary>
+    /// Size in logical pixels the contact's profile picture is decoded at, 0 to decode it at its full size.
+    /// </summary>
+    int GetDecodePixelSize();
+
     winrt::hstring PersonPicture::GetLocalizedPluralBadgeItemStringResource(unsigned int numericValue);
 
     /// <summary>
@@ -119,6 +130,16 @@ private:
     /// </summary>
     tracker_ref<winrt::IAsyncOperation<winrt::IRandomAccessStreamWithContentType>> m_profilePictureReadAsync{ this };
 
+    /// <summary>
+    /// The async action decoding the Thumbnail once its stream is open.
+    /// </summary>
+    tracker_ref<winrt::IAsyncAction> m_profilePictureSetSourceAsync{ this };
+
+    /// <summary>
+    /// The size in logical pixels the current contact's profile picture was requested at.
+    /// </summary>
+    int m_contactImageDecodePixelSize{ 0 };
+
     /// <summary>
     /// The initials from the DisplayName property.
     /// </summary>
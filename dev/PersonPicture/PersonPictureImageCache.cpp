@@ -0,0 +1,109 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "PersonPictureImageCache.h"
+
+// Enough for a few thousand small avatars. Sizes are logical, so this is an estimate on scaled displays.
+static constexpr size_t c_imageCacheBudgetInBytes = 16 * 1024 * 1024;
+static constexpr size_t c_bytesPerPixel = 4;
+
+PersonPictureImageCache& PersonPictureImageCache::GetForCurrentThread()
+{
+    static thread_local PersonPictureImageCache s_cache;
+    s_cache.AttachToCurrentWindow();
+    return s_cache;
+}
+
+void PersonPictureImageCache::AttachToCurrentWindow()
+{
+    if (!m_isAttachedToWindow && !m_isWindowClosed)
+    {
+        if (auto window = winrt::Window::Current())
+        {
+            m_windowClosedRevoker = window.Closed(winrt::auto_revoke, { this, &PersonPictureImageCache::OnWindowClosed });
+            m_isAttachedToWindow = true;
+        }
+    }
+}
+
+void PersonPictureImageCache::OnWindowClosed(const winrt::IInspectable&, const winrt::CoreWindowEventArgs&)
+{
+    // The thread_local cache itself is destroyed at thread exit, after XAML has been torn down,
+    // so the pictures have to be released now. Nothing is cached on this thread from here on.
+    m_windowClosedRevoker.revoke();
+    m_isAttachedToWindow = false;
+    m_isWindowClosed = true;
+    Clear();
+}
+
+winrt::BitmapImage PersonPictureImageCache::TryGet(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize)
+{
+    if (!m_isAttachedToWindow)
+    {
+        return nullptr;
+    }
+
+    auto it = m_entriesByKey.find(MakeKey(streamReference, decodePixelSize));
+    if (it == m_entriesByKey.end())
+    {
+        return nullptr;
+    }
+
+    // Move the entry to the front, it is now the most recently used one.
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->image;
+}
+
+void PersonPictureImageCache::Add(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize, const winrt::BitmapImage& image)
+{
+    if (!m_isAttachedToWindow)
+    {
+        return;
+    }
+
+    const auto key = MakeKey(streamReference, decodePixelSize);
+    auto it = m_entriesByKey.find(key);
+    if (it != m_entriesByKey.end())
+    {
+        m_byteCount -= it->second->byteCount;
+        m_entries.erase(it->second);
+        m_entriesByKey.erase(it);
+    }
+
+    // The shorter side is decoded at decodePixelSize, count the picture as a square of that size.
+    // Pictures decoded at their full size are not cached, we can't tell how large they are.
+    if (decodePixelSize > 0)
+    {
+        const size_t byteCount = static_cast<size_t>(decodePixelSize) * decodePixelSize * c_bytesPerPixel;
+        m_entries.push_front(Entry{ key, streamReference, image, byteCount });
+        m_entriesByKey.emplace(key, m_entries.begin());
+        m_byteCount += byteCount;
+
+        TrimToBudget();
+    }
+}
+
+void PersonPictureImageCache::Clear()
+{
+    m_entriesByKey.clear();
+    m_entries.clear();
+    m_byteCount = 0;
+}
+
+PersonPictureImageCache::Key PersonPictureImageCache::MakeKey(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize)
+{
+    return Key{ winrt::get_abi(streamReference.as<winrt::IUnknown>()), decodePixelSize };
+}
+
+void PersonPictureImageCache::TrimToBudget()
+{
+    while (m_byteCount > c_imageCacheBudgetInBytes && !m_entries.empty())
+    {
+        auto& last = m_entries.back();
+        m_byteCount -= last.byteCount;
+        m_entriesByKey.erase(last.key);
+        m_entries.pop_back();
+    }
+}
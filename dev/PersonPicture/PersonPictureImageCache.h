@@ -0,0 +1,69 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <list>
+
+/// <summary>
+/// Contact pictures already decoded for a PersonPicture, shared by all the PersonPicture instances of a UI thread.
+/// Pictures are keyed by the stream they came from and the logical size they were decoded at, and the
+/// least recently used ones are dropped once the cache goes over its memory budget.
+/// The pictures are released when the thread's window closes, while XAML is still around to release them.
+/// Threads without a window don't cache anything.
+/// </summary>
+class PersonPictureImageCache
+{
+public:
+    /// <summary>
+    /// Returns the cache of the calling thread. XAML objects can only be used on the thread that created them.
+    /// </summary>
+    static PersonPictureImageCache& GetForCurrentThread();
+
+    winrt::BitmapImage TryGet(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize);
+    void Add(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize, const winrt::BitmapImage& image);
+    void Clear();
+
+private:
+    struct Key
+    {
+        void* streamReference;
+        int decodePixelSize;
+
+        bool operator==(const Key& other) const
+        {
+            return streamReference == other.streamReference && decodePixelSize == other.decodePixelSize;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return std::hash<void*>()(key.streamReference) ^ (std::hash<int>()(key.decodePixelSize) << 1);
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        // Holding on to the stream reference keeps its identity from being reused by another stream.
+        winrt::IRandomAccessStreamReference streamReference;
+        winrt::BitmapImage image;
+        size_t byteCount;
+    };
+
+    static Key MakeKey(const winrt::IRandomAccessStreamReference& streamReference, int decodePixelSize);
+    void TrimToBudget();
+    void AttachToCurrentWindow();
+    void OnWindowClosed(const winrt::IInspectable& sender, const winrt::CoreWindowEventArgs& args);
+
+    // Most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_entriesByKey;
+    size_t m_byteCount{ 0 };
+
+    bool m_isAttachedToWindow{ false };
+    bool m_isWindowClosed{ false };
+    winrt::Window::Closed_revoker m_windowClosedRevoker{};
+};
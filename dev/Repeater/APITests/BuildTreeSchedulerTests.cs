@@ -0,0 +1,109 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System.Collections.Generic;
+using Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
+{
+    [TestClass]
+    public class BuildTreeSchedulerTests : TestsBase
+    {
+        [TestMethod]
+        public void ValidateWorkRunsInPriorityOrderWithinBudget()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RepeaterTestHooks.SetBuildTreeSchedulerManualClock(true);
+                try
+                {
+                    var order = new List<string>();
+                    // Each piece of work takes 3ms on the manual clock.
+                    void Register(int priority, string name)
+                    {
+                        RepeaterTestHooks.RegisterBuildTreeWork(priority, (sender, args) =>
+                        {
+                            order.Add(name);
+                            RepeaterTestHooks.AdvanceBuildTreeSchedulerManualClock(3);
+                        });
+                    }
+
+                    Register(2, "c");
+                    Register(0, "a");
+                    Register(1, "b1");
+                    Register(1, "b2");
+                    var cancelledId = RepeaterTestHooks.RegisterBuildTreeWork(1, (sender, args) => order.Add("cancelled"));
+                    Register(5, "d");
+                    RepeaterTestHooks.CancelBuildTreeWork(cancelledId);
+
+                    Log.Comment("The first frame gets half of a 60Hz frame, so only three pieces of work fit.");
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    var stats = RepeaterTestHooks.GetBuildTreeSchedulerLastFrameStats();
+                    Verify.AreEqual("a,b1,b2", string.Join(",", order));
+                    Verify.AreEqual(3, stats.JobsRun);
+                    Verify.AreEqual(2, stats.JobsDeferred);
+                    Verify.AreEqual(9.0, stats.TimeUsedInMs);
+                    Verify.IsLessThan(stats.BudgetInMs, stats.TimeUsedInMs);
+
+                    Log.Comment("A shorter frame interval shrinks the budget right away.");
+                    RepeaterTestHooks.AdvanceBuildTreeSchedulerManualClock(1);
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    stats = RepeaterTestHooks.GetBuildTreeSchedulerLastFrameStats();
+                    Verify.AreEqual(5.0, stats.BudgetInMs);
+                    Verify.AreEqual("a,b1,b2,c,d", string.Join(",", order));
+                    Verify.AreEqual(2, stats.JobsRun);
+                    Verify.AreEqual(0, stats.JobsDeferred);
+                }
+                finally
+                {
+                    RepeaterTestHooks.SetBuildTreeSchedulerManualClock(false);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void ValidateWorkLongerThanBudgetStillRuns()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RepeaterTestHooks.SetBuildTreeSchedulerManualClock(true);
+                try
+                {
+                    int runCount = 0;
+                    for (int i = 0; i < 2; i++)
+                    {
+                        RepeaterTestHooks.RegisterBuildTreeWork(0, (sender, args) =>
+                        {
+                            runCount++;
+                            RepeaterTestHooks.AdvanceBuildTreeSchedulerManualClock(50);
+                        });
+                    }
+
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    Verify.AreEqual(1, runCount);
+                    Verify.AreEqual(1, RepeaterTestHooks.GetBuildTreeSchedulerLastFrameStats().JobsDeferred);
+
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    Verify.AreEqual(2, runCount);
+                    Verify.AreEqual(0, RepeaterTestHooks.GetBuildTreeSchedulerLastFrameStats().JobsDeferred);
+                }
+                finally
+                {
+                    RepeaterTestHooks.SetBuildTreeSchedulerManualClock(false);
+                }
+            });
+        }
+    }
+}
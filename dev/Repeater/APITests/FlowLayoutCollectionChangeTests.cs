@@ -416,6 +416,54 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateStableResetsReuseElementsWithManyItems()
+        {
+            const int itemCount = 10000;
+            const int resetCount = 20;
+
+            RunOnUIThread.Execute(() =>
+            {
+                var dataSource = new CustomItemsSourceWithUniqueId(Enumerable.Range(0, itemCount).ToList());
+                var elementFactory = new RecyclingElementFactory();
+                elementFactory.RecyclePool = new RecyclePool();
+                elementFactory.Templates["Item"] = SharedHelpers.GetDataTemplate(@"<TextBlock Text='{Binding}' Height='10' />");
+
+                ScrollViewer scrollViewer = null;
+                var repeater = SetupRepeater(dataSource, elementFactory, ref scrollViewer, new StackLayout());
+                ((FrameworkElement)Content).Height = 2000;
+                Content.UpdateLayout();
+
+                int realized = Enumerable.Range(0, itemCount).Count(index => repeater.TryGetElement(index) != null);
+                Log.Comment("Realized " + realized + " elements");
+                Verify.IsGreaterThan(realized, 100);
+
+                // Every reset gives a quarter of the realized items a new unique id. Only those can't be
+                // matched with an element from the unique id reset pool and need their data.
+                int changedPerReset = Enumerable.Range(0, realized).Count(index => index % 4 == 0);
+                dataSource.GetAtCallCount = 0;
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                for (int i = 0; i < resetCount; i++)
+                {
+                    for (int index = 0; index < realized; index += 4)
+                    {
+                        dataSource.Inner[index] = itemCount * (i + 1) + index;
+                    }
+                    dataSource.Reset();
+                    repeater.UpdateLayout();
+                }
+                stopwatch.Stop();
+
+                // Elements coming back from the unique id reset pool keep their data, so any data request is a miss.
+                int requested = realized * resetCount;
+                double hitRate = (double)(requested - dataSource.GetAtCallCount) / requested;
+                Log.Comment(resetCount + " stable resets took " + stopwatch.ElapsedMilliseconds + "ms with a reuse hit rate of " + hitRate.ToString("P1"));
+
+                Verify.AreEqual(changedPerReset * resetCount, dataSource.GetAtCallCount);
+                Verify.AreEqual(realized, Enumerable.Range(0, itemCount).Count(index => repeater.TryGetElement(index) != null));
+            });
+        }
+
         [TestMethod]
         public void ValidateRegularResets()
         {
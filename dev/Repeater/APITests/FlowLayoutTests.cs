@@ -1362,6 +1362,178 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateMeasuredSizeIndexKeepsExtentStable_Stack()
+        {
+            ValidateMeasuredSizeIndexKeepsExtentStable(LayoutChoice.Stack);
+        }
+
+        [TestMethod]
+        public void ValidateMeasuredSizeIndexKeepsExtentStable_Flow()
+        {
+            ValidateMeasuredSizeIndexKeepsExtentStable(LayoutChoice.Flow);
+        }
+
+        [TestMethod]
+        public void ValidateUniformGridClosedFormJump()
+        {
+            const int numItems = 200000;
+            const int targetIndex = 100000;
+            const double itemSize = 100;
+            // The repeater is 400 wide, so every line holds 4 items.
+            const int itemsPerLine = 4;
+            var om = new OrientationBasedMeasures(ScrollOrientation.Vertical);
+
+            // HasFixedSizeItems on its own also switches to the closed-form layout.
+            var configurations = new[]
+            {
+                new { IsClosedFormLayoutEnabled = false, HasFixedSizeItems = false },
+                new { IsClosedFormLayoutEnabled = true, HasFixedSizeItems = true },
+                new { IsClosedFormLayoutEnabled = false, HasFixedSizeItems = true },
+            };
+
+            foreach (var configuration in configurations)
+            {
+                Log.Comment("IsClosedFormLayoutEnabled: {0}, HasFixedSizeItems: {1}", configuration.IsClosedFormLayoutEnabled, configuration.HasFixedSizeItems);
+                ItemsRepeater repeater = null;
+                ScrollViewer scrollViewer = null;
+                var viewChangedEvent = new ManualResetEvent(false);
+                int elementsCreated = 0;
+
+                RunOnUIThread.Execute(() =>
+                {
+                    var elementFactory = new MockElementFactory()
+                    {
+                        GetElementFunc = (index, owner) =>
+                        {
+                            elementsCreated++;
+                            return new Border() { Width = itemSize, Height = itemSize };
+                        }
+                    };
+
+                    Content = CreateAndInitializeRepeater
+                    (
+                       om,
+                       itemsSource: Enumerable.Range(0, numItems).ToList(),
+                       elementFactory: elementFactory,
+                       layout: new UniformGridLayout()
+                       {
+                           MinItemWidth = itemSize,
+                           MinItemHeight = itemSize,
+                           IsClosedFormLayoutEnabled = configuration.IsClosedFormLayoutEnabled,
+                           HasFixedSizeItems = configuration.HasFixedSizeItems
+                       },
+                       repeater: ref repeater,
+                       scrollViewer: ref scrollViewer
+                    );
+
+                    scrollViewer.ViewChanged += (sender, args) =>
+                    {
+                        if (!args.IsIntermediate)
+                        {
+                            viewChangedEvent.Set();
+                        }
+                    };
+
+                    Content.UpdateLayout();
+                    elementsCreated = 0;
+                });
+
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                RunOnUIThread.Execute(() =>
+                {
+                    scrollViewer.ChangeView(null, (targetIndex / itemsPerLine) * itemSize, null, true);
+                });
+
+                Verify.IsTrue(viewChangedEvent.WaitOne(DefaultWaitTimeInMS), "Waiting for ViewChanged.");
+                IdleSynchronizer.Wait();
+                stopwatch.Stop();
+                Log.Comment("Jump from index 0 to {0} took {1} ms and created {2} elements", targetIndex, stopwatch.Elapsed.TotalMilliseconds, elementsCreated);
+
+                RunOnUIThread.Execute(() =>
+                {
+                    var target = (FrameworkElement)repeater.TryGetElement(targetIndex);
+                    Verify.IsNotNull(target);
+
+                    if (configuration.IsClosedFormLayoutEnabled || configuration.HasFixedSizeItems)
+                    {
+                        Verify.AreEqual((numItems / itemsPerLine) * itemSize, om.Major(repeater.DesiredSize));
+                        Verify.AreEqual(new Rect(0, (targetIndex / itemsPerLine) * itemSize, itemSize, itemSize), LayoutInformation.GetLayoutSlot(target));
+                        // Only the lines in the 400px viewport get realized.
+                        Verify.IsLessThanOrEqual(elementsCreated, 5 * itemsPerLine);
+                    }
+                });
+            }
+        }
+
+        [TestMethod]
+        public void ValidateTallItemInLineStaysRealizedWhenScrolledPartwayPast()
+        {
+            const double itemWidth = 200;
+            var om = new OrientationBasedMeasures(ScrollOrientation.Vertical);
+            // The repeater is 400 wide, so every line holds 2 items. The first line mixes a tall item
+            // with a short one, so the short item ends well before the tall one does.
+            Func<int, double> getItemHeight = index => index == 0 ? 600 : index == 1 ? 20 : 50;
+
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            UIElement tallElement = null;
+            var viewChangedEvent = new ManualResetEvent(false);
+            var clearedIndices = new List<int>();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var elementFactory = new MockElementFactory()
+                {
+                    GetElementFunc = (index, owner) => new Border() { Width = itemWidth, Height = getItemHeight(index) }
+                };
+
+                Content = CreateAndInitializeRepeater
+                (
+                   om,
+                   itemsSource: Enumerable.Range(0, 50).ToList(),
+                   elementFactory: elementFactory,
+                   layout: new FlowLayout(),
+                   repeater: ref repeater,
+                   scrollViewer: ref scrollViewer
+                );
+
+                repeater.ElementClearing += (sender, args) =>
+                {
+                    clearedIndices.Add(repeater.GetElementIndex(args.Element));
+                };
+
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChangedEvent.Set();
+                    }
+                };
+
+                Content.UpdateLayout();
+                tallElement = repeater.TryGetElement(0);
+                Verify.IsNotNull(tallElement);
+            });
+
+            // Scroll past the short item but only halfway through the tall one.
+            RunOnUIThread.Execute(() =>
+            {
+                scrollViewer.ChangeView(null, 300, null, true);
+            });
+
+            Verify.IsTrue(viewChangedEvent.WaitOne(DefaultWaitTimeInMS), "Waiting for ViewChanged.");
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Cleared indices: " + string.Join(", ", clearedIndices));
+                Verify.IsFalse(clearedIndices.Contains(0), "The tall item still reaches into the window and should not be cleared.");
+                Verify.AreSame(tallElement, repeater.TryGetElement(0));
+                Verify.AreEqual(new Rect(0, 0, itemWidth, 600), LayoutInformation.GetLayoutSlot((FrameworkElement)tallElement));
+            });
+        }
+
         #region Private Helpers
 
         private enum LayoutChoice
@@ -1523,6 +1695,86 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             };
         }
 
+        // Jumps through a million items of alternating size and validates that the extent
+        // reported with the measured size index stays close to the real one the whole way.
+        private void ValidateMeasuredSizeIndexKeepsExtentStable(LayoutChoice layoutChoice)
+        {
+            const int numItems = 1000000;
+            const int numJumps = 20;
+            var om = new OrientationBasedMeasures(ScrollOrientation.Vertical);
+            Func<int, double> getItemHeight = index => index % 2 == 0 ? 40 : 60;
+            // Stack items are stacked one after the other. Flow items are 100 wide so a 400 wide
+            // line holds 4 of them and is as tall as its tallest item.
+            double expectedExtent = layoutChoice == LayoutChoice.Stack ?
+                Enumerable.Range(0, numItems).Sum(i => getItemHeight(i)) :
+                (numItems / 4) * 60.0;
+
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            var viewChangedEvent = new ManualResetEvent(false);
+            var extents = new List<double>();
+
+            RunOnUIThread.Execute(() =>
+            {
+                VirtualizingLayout layout = layoutChoice == LayoutChoice.Stack ?
+                    (VirtualizingLayout)new StackLayout() { IsMeasuredSizeIndexEnabled = true } :
+                    new FlowLayout() { IsMeasuredSizeIndexEnabled = true };
+
+                var elementFactory = new MockElementFactory()
+                {
+                    GetElementFunc = (index, owner) => new Border() { Width = 100, Height = getItemHeight(index) }
+                };
+
+                Content = CreateAndInitializeRepeater
+                (
+                   om,
+                   itemsSource: Enumerable.Range(0, numItems).ToList(),
+                   elementFactory: elementFactory,
+                   layout: layout,
+                   repeater: ref repeater,
+                   scrollViewer: ref scrollViewer
+                );
+
+                // Realize a few viewports so that every window measures a good sample of items.
+                repeater.VerticalCacheLength = 2;
+
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChangedEvent.Set();
+                    }
+                };
+
+                Content.UpdateLayout();
+            });
+
+            for (int jump = 1; jump <= numJumps; jump++)
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    viewChangedEvent.Reset();
+                    scrollViewer.ChangeView(null, expectedExtent * jump / (numJumps + 1), null, true);
+                });
+
+                Verify.IsTrue(viewChangedEvent.WaitOne(DefaultWaitTimeInMS), "Waiting for ViewChanged.");
+                IdleSynchronizer.Wait();
+
+                RunOnUIThread.Execute(() =>
+                {
+                    var extent = om.Major(repeater.DesiredSize);
+                    Log.Comment(string.Format("Jump {0}: offset {1}, extent {2}", jump, scrollViewer.VerticalOffset, extent));
+                    Verify.IsLessThan(Math.Abs(extent - expectedExtent), expectedExtent * 0.01, "Extent is within 1% of the real extent.");
+                    if (extents.Count > 0)
+                    {
+                        Verify.IsLessThan(Math.Abs(extent - extents.Last()), expectedExtent * 0.01, "Extent did not jump.");
+                    }
+
+                    extents.Add(extent);
+                });
+            }
+        }
+
         private void ValidateLayoutEstimations(ScrollOrientation scrollOrientation, LayoutChoice layoutChoice)
         {
             Log.Comment(string.Format("ScrollOrientation: {0}", scrollOrientation));
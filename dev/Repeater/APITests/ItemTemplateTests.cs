@@ -597,6 +597,51 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateTemplatesMapLookupAndInsertScale()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var template = SharedHelpers.GetDataTemplate(@"<TextBlock Text='{Binding}' />");
+                var otherTemplate = SharedHelpers.GetDataTemplate(@"<Button Content='{Binding}' />");
+
+                foreach (int count in new int[] { 10, 1000, 100000 })
+                {
+                    var templates = new RecyclingElementFactory().Templates;
+                    var keys = Enumerable.Range(0, count).Select(i => "key" + i).ToArray();
+
+                    var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                    foreach (var key in keys)
+                    {
+                        templates.Add(key, template);
+                    }
+                    stopwatch.Stop();
+                    Log.Comment("{0} entries: insert {1} ms", count, stopwatch.Elapsed.TotalMilliseconds);
+
+                    stopwatch.Restart();
+                    foreach (var key in keys)
+                    {
+                        Verify.IsTrue(templates.ContainsKey(key));
+                    }
+                    stopwatch.Stop();
+                    Log.Comment("{0} entries: lookup {1} ms", count, stopwatch.Elapsed.TotalMilliseconds);
+
+                    Verify.AreEqual(count, templates.Count);
+                    Verify.IsFalse(templates.ContainsKey("missing"));
+
+                    // Replacing an existing key keeps the count and updates the value.
+                    templates[keys[0]] = otherTemplate;
+                    Verify.AreEqual(count, templates.Count);
+                    Verify.AreSame(otherTemplate, templates[keys[0]]);
+
+                    templates.Remove(keys[count - 1]);
+                    Verify.AreEqual(count - 1, templates.Count);
+                    Verify.IsFalse(templates.ContainsKey(keys[count - 1]));
+                    Verify.AreEqual(count - 1, templates.Count());
+                }
+            });
+        }
+
         private ItemsRepeaterScrollHost CreateAndInitializeRepeater(
             object itemsSource,
             Layout layout,
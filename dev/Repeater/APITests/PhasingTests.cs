@@ -179,15 +179,203 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        [TestMethod]
+        public void ValidatePhasingCompletesForRealizedElementsWhileScrolling()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThan(OSVersion.Redstone2))
+            {
+                Log.Warning("Skipping: GetAvailableSize API is only available in RS3 and above.");
+                return;
+            }
+
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            int numPhases = 4; // 0 to 3
+            var stopwatch = new System.Diagnostics.Stopwatch();
+
+            RunOnUIThread.Execute(() =>
+            {
+                ElementPhasingManager.ProcessedCalls = null;
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 1000),
+                    ItemTemplate = new CustomElementFactory(numPhases, 20 /* height */),
+                    Layout = new StackLayout(),
+                };
+
+                scrollViewer = new ScrollViewer { Content = repeater };
+                Content = new ItemsRepeaterScrollHost()
+                {
+                    Width = 400,
+                    Height = 400,
+                    ScrollViewer = scrollViewer
+                };
+
+                stopwatch.Start();
+            });
+
+            // Scroll while elements are still being phased so that some of them
+            // get cleared before they reach their last phase.
+            for (int i = 1; i <= 10; i++)
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    scrollViewer.ChangeView(null, i * 1000, null, true /* disableAnimation */);
+                });
+                IdleSynchronizer.Wait();
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                stopwatch.Stop();
+                Log.Comment("Phasing while scrolling took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                var calls = ElementPhasingManager.ProcessedCalls;
+                int realizedCount = 0;
+                for (int i = 0; i < 1000; i++)
+                {
+                    if (repeater.TryGetElement(i) != null)
+                    {
+                        realizedCount++;
+                        Verify.IsTrue(calls.ContainsKey(i));
+                        Verify.AreEqual(numPhases - 1, calls[i].Last());
+                    }
+                }
+
+                Verify.IsTrue(realizedCount > 0);
+                ElementPhasingManager.ProcessedCalls.Clear();
+            });
+        }
+
+        [TestMethod]
+        public void ValidateVisibleElementsArePhasedFirstAfterViewportMoves()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThan(OSVersion.Redstone2))
+            {
+                Log.Warning("Skipping: GetAvailableSize API is only available in RS3 and above.");
+                return;
+            }
+
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            int numPhases = 4; // 0 to 3
+            const double itemHeight = 100;
+            const double viewportHeight = 400;
+            const double scrollOffset = 400;
+            var viewChangedEvent = new ManualResetEvent(false);
+            // (index, phase) of every phase processed by the phaser, in order.
+            var processedOrder = new List<Tuple<int, int>>();
+            bool advanceClockOnProcess = true;
+
+            RunOnUIThread.Execute(() =>
+            {
+                // Phasing only runs when we run a frame, so we control when the visible window is looked at.
+                RepeaterTestHooks.SetBuildTreeSchedulerManualClock(true);
+                ElementPhasingManager.ProcessedCalls = null;
+                ElementPhasingManager.ProcessBindingsCallback = (index, phase) =>
+                {
+                    if (phase > 0)
+                    {
+                        processedOrder.Add(Tuple.Create(index, phase));
+                        if (advanceClockOnProcess)
+                        {
+                            // Use up the frame budget so the phaser yields after a single element.
+                            RepeaterTestHooks.AdvanceBuildTreeSchedulerManualClock(100);
+                        }
+                    }
+                };
+
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 100),
+                    ItemTemplate = new CustomElementFactory(numPhases, itemHeight),
+                    Layout = new StackLayout(),
+                    // Realize a viewport before and after the visible one.
+                    VerticalCacheLength = 2,
+                };
+
+                scrollViewer = new ScrollViewer { Content = repeater };
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChangedEvent.Set();
+                    }
+                };
+
+                Content = new ItemsRepeaterScrollHost()
+                {
+                    Width = 400,
+                    Height = viewportHeight,
+                    ScrollViewer = scrollViewer
+                };
+            });
+
+            IdleSynchronizer.Wait();
+
+            try
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    Verify.IsNotNull(repeater.TryGetElement((int)((scrollOffset + viewportHeight) / itemHeight) - 1),
+                        "The elements we scroll to should already be realized and waiting for their phases.");
+
+                    Log.Comment("Run one frame so that the pending elements get classified against the first viewport.");
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    Verify.AreEqual(1, processedOrder.Count);
+                    processedOrder.Clear();
+
+                    scrollViewer.ChangeView(null, scrollOffset, null, true /* disableAnimation */);
+                });
+
+                Verify.IsTrue(viewChangedEvent.WaitOne(DefaultWaitTimeInMS), "Waiting for ViewChanged.");
+                IdleSynchronizer.Wait();
+
+                RunOnUIThread.Execute(() =>
+                {
+                    Log.Comment("Run a frame long enough to finish phasing and validate that the elements now in view went first.");
+                    advanceClockOnProcess = false;
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+
+                    Func<int, bool> isInView = index =>
+                        (index + 1) * itemHeight > scrollOffset && index * itemHeight < scrollOffset + viewportHeight;
+                    Func<int, bool> isOutOfView = index =>
+                        (index + 1) * itemHeight < scrollOffset || index * itemHeight > scrollOffset + viewportHeight;
+
+                    Log.Comment("Processed: " + string.Join(", ", processedOrder.Select(call => call.Item1 + ":" + call.Item2)));
+                    int lastInViewCall = processedOrder.FindLastIndex(call => isInView(call.Item1));
+                    int firstOutOfViewCall = processedOrder.FindIndex(call => isOutOfView(call.Item1));
+                    Verify.IsGreaterThanOrEqual(lastInViewCall, 0);
+                    Verify.IsGreaterThan(firstOutOfViewCall, lastInViewCall, "Elements in view should finish phasing before the ones out of view start.");
+
+                    for (int index = (int)(scrollOffset / itemHeight); index < (scrollOffset + viewportHeight) / itemHeight; index++)
+                    {
+                        Verify.AreEqual(numPhases - 1, ElementPhasingManager.ProcessedCalls[index].Last());
+                    }
+                });
+            }
+            finally
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    ElementPhasingManager.ProcessBindingsCallback = null;
+                    ElementPhasingManager.ProcessedCalls.Clear();
+                    RepeaterTestHooks.SetBuildTreeSchedulerManualClock(false);
+                });
+            }
+        }
+
         private class CustomElementFactory : ElementFactory
         {
             private int _numPhases;
+            private double _height;
             private RecyclePool _recyclePool = new RecyclePool();
             private string key = "foobar";
 
-            public CustomElementFactory(int numPhases)
+            public CustomElementFactory(int numPhases, double height = 100)
             {
                 _numPhases = numPhases;
+                _height = height;
             }
 
             protected override UIElement GetElementCore(ElementFactoryGetArgs args)
@@ -195,7 +383,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 var element = _recyclePool.TryGetElement(key, args.Parent);
                 if (element == null)
                 {
-                    element = new Button() { Width = 100, Height = 100 };
+                    element = new Button() { Width = 100, Height = _height };
                 }
 
                 var elementManager = new ElementPhasingManager(_numPhases);
@@ -221,6 +409,9 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             // data index -> list<phases>
             public static Dictionary<int, List<int>> ProcessedCalls { get; set; }
 
+            // Called with the data index and phase of every ProcessBindings call.
+            public static Action<int, int> ProcessBindingsCallback { get; set; }
+
             public ElementPhasingManager(int numPhases)
             {
                 _numPhases = numPhases;
@@ -252,6 +443,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 }
 
                 ProcessedCalls[_data].Add(phase);
+                ProcessBindingsCallback?.Invoke(_data, phase);
 
                 nextPhase = phase >= _numPhases -1 ? -1 : phase + 1;
                 Log.Comment(string.Format("Index:{0}  Phase:{1}  NextPhase:{2}", item.ToString(), phase, nextPhase));
@@ -4,9 +4,11 @@
 using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
 using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common.Mocks;
 using MUXControlsTestApp.Utilities;
+using System;
 using System.Collections.ObjectModel;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Markup;
@@ -24,6 +26,8 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 
 using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
+using RecyclingElementFactory = Microsoft.UI.Xaml.Controls.RecyclingElementFactory;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ItemsRepeaterScrollHost = Microsoft.UI.Xaml.Controls.ItemsRepeaterScrollHost;
 
@@ -209,5 +213,127 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.IsNull(recycled2.Parent);
             });
         }
+
+        [TestMethod]
+        public void ValidateMaxElementsPerKeyEvictsLeastRecentlyUsed()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const string key = "Key";
+                const string otherKey = "OtherKey";
+                RecyclePool pool = new RecyclePool();
+                var owner = new StackPanel();
+                var elements = Enumerable.Range(0, 5).Select(i => new Button() { Content = i }).ToList();
+                foreach (var element in elements)
+                {
+                    owner.Children.Add(element);
+                    pool.PutElement(element, key, owner);
+                }
+
+                pool.PutElement(new TextBlock(), otherKey);
+                pool.SetMaxElementsForKey(otherKey, 10);
+
+                Log.Comment("Limit the pool to 3 elements per key");
+                pool.MaxElementsPerKey = 3;
+                Verify.AreEqual(3, pool.GetElementCount(key));
+                Verify.AreEqual(1, pool.GetElementCount(otherKey));
+                Verify.AreEqual(2u, pool.EvictionCount);
+
+                // The two oldest elements were evicted and removed from their owner.
+                Verify.IsNull(elements[0].Parent);
+                Verify.IsNull(elements[1].Parent);
+                Verify.AreEqual(3, owner.Children.Count);
+
+                RepeaterTestHooks.SetBuildTreeSchedulerManualClock(true);
+                try
+                {
+                    Log.Comment("Putting another element evicts the least recently used one on the next scheduler pass");
+                    var newest = new Button();
+                    owner.Children.Add(newest);
+                    pool.PutElement(newest, key, owner);
+                    Verify.AreEqual(4, pool.GetElementCount(key));
+                    Verify.AreEqual(2u, pool.EvictionCount);
+                    Verify.AreSame(owner, elements[2].Parent);
+
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    Verify.AreEqual(3, pool.GetElementCount(key));
+                    Verify.AreEqual(3u, pool.EvictionCount);
+                    Verify.IsNull(elements[2].Parent);
+
+                    // The most recently used element is handed out first.
+                    Verify.AreSame(newest, pool.TryGetElement(key, owner));
+                    Verify.AreSame(elements[4], pool.TryGetElement(key, owner));
+                    Verify.AreSame(elements[3], pool.TryGetElement(key, owner));
+                    Verify.IsNull(pool.TryGetElement(key, owner));
+                    Verify.AreEqual(3u, pool.HitCount);
+                    Verify.AreEqual(1u, pool.MissCount);
+
+                    Log.Comment("A per-key limit overrides MaxElementsPerKey");
+                    pool.SetMaxElementsForKey(key, 0);
+                    pool.PutElement(new Button(), key);
+                    RepeaterTestHooks.RunBuildTreeSchedulerFrame();
+                    Verify.AreEqual(0, pool.GetElementCount(key));
+                }
+                finally
+                {
+                    RepeaterTestHooks.SetBuildTreeSchedulerManualClock(false);
+                }
+
+                Verify.Throws<ArgumentException>(() => pool.MaxElementsPerKey = -1);
+            });
+        }
+
+        [TestMethod]
+        public void ValidatePrewarmElements()
+        {
+            const string key = "key";
+            const int prewarmCount = 20;
+            var buildTreeCompleted = new ManualResetEvent(false);
+            RecyclePool pool = null;
+            // The prewarm work only holds a weak reference to the factory, so keep it alive
+            // until the work has run.
+            RecyclingElementFactory factory = null;
+            Windows.Foundation.TypedEventHandler<object, object> onBuildTreeCompleted = (sender, args) =>
+            {
+                buildTreeCompleted.Set();
+            };
+
+            try
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    pool = new RecyclePool();
+                    factory = new RecyclingElementFactory()
+                    {
+                        RecyclePool = pool,
+                        Templates = { { key, SharedHelpers.GetDataTemplate(@"<TextBlock Text='{Binding}' />") } }
+                    };
+
+                    Verify.Throws<COMException>(() => factory.PrewarmElements("missing", prewarmCount));
+
+                    RepeaterTestHooks.BuildTreeCompleted += onBuildTreeCompleted;
+
+                    factory.PrewarmElements(key, prewarmCount);
+                    Verify.AreEqual(0, pool.GetElementCount(key));
+                });
+
+                Verify.IsTrue(buildTreeCompleted.WaitOne(TimeSpan.FromMilliseconds(5000)), "Waiting for prewarm work to complete");
+
+                RunOnUIThread.Execute(() =>
+                {
+                    Verify.AreEqual(prewarmCount, pool.GetElementCount(key));
+                    Verify.IsNotNull((TextBlock)pool.TryGetElement(key));
+                    Verify.AreEqual(1u, pool.HitCount);
+                });
+            }
+            finally
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    RepeaterTestHooks.BuildTreeCompleted -= onBuildTreeCompleted;
+                });
+                GC.KeepAlive(factory);
+            }
+        }
     }
 }
@@ -25,6 +25,9 @@ using RecyclingElementFactory = Microsoft.UI.Xaml.Controls.RecyclingElementFacto
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ItemsRepeaterScrollHost = Microsoft.UI.Xaml.Controls.ItemsRepeaterScrollHost;
+using MUXControlsTestHooks = Microsoft.UI.Private.Controls.MUXControlsTestHooks;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
+using RepeaterLayoutSpan = Microsoft.UI.Private.Controls.RepeaterLayoutSpan;
 using System.Collections.ObjectModel;
 using System.Threading;
 using System.Collections.Generic;
@@ -76,6 +79,121 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void CanDrainStructuredTraceEvents()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                MUXControlsTestHooks.SetStructuredTracingEnabled(true);
+                try
+                {
+                    // Drop whatever earlier tests recorded.
+                    MUXControlsTestHooks.DrainStructuredTraceEvents();
+
+                    var repeater = new ItemsRepeater() {
+                        ItemsSource = Enumerable.Range(0, 10),
+                        ItemTemplate = CreateDataTemplateWithContent(@"<TextBlock Text='{Binding}' Height='50' />")
+                    };
+
+                    Content = new ItemsRepeaterScrollHost() {
+                        Width = 400,
+                        Height = 800,
+                        ScrollViewer = new ScrollViewer {
+                            Content = repeater
+                        }
+                    };
+
+                    Content.UpdateLayout();
+
+                    var events = MUXControlsTestHooks.DrainStructuredTraceEvents().ToList();
+                    foreach (var message in events)
+                    {
+                        Log.Comment(message);
+                    }
+
+                    var measureBegin = events.FindIndex(e => e.Contains(" RepeaterMeasureBegin "));
+                    var firstCreated = events.FindIndex(e => e.Contains(" RepeaterElementCreated "));
+                    Verify.IsGreaterThanOrEqual(measureBegin, 0);
+                    Verify.IsGreaterThan(firstCreated, measureBegin);
+                    Verify.AreEqual(10, events.Count(e => e.Contains(" RepeaterElementCreated ")));
+                    Verify.IsTrue(events.Any(e => e.Contains(" RepeaterMeasureEnd ") && e.Contains("realizedCount=10")));
+                    Verify.IsTrue(events.Any(e => e.Contains(" RepeaterArrangeEnd ")));
+
+                    Log.Comment("Validate that draining empties the buffer.");
+                    Verify.AreEqual(0, MUXControlsTestHooks.DrainStructuredTraceEvents().Count);
+                }
+                finally
+                {
+                    MUXControlsTestHooks.SetStructuredTracingEnabled(false);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void CanCollectLayoutMetrics()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RepeaterTestHooks.SetLayoutMetricsEnabled(true);
+                try
+                {
+                    RepeaterTestHooks.ResetLayoutMetrics();
+
+                    var repeater = new ItemsRepeater() {
+                        ItemsSource = Enumerable.Range(0, 100),
+                        ItemTemplate = CreateDataTemplateWithContent(@"<TextBlock Text='{Binding}' Height='50' />")
+                    };
+
+                    Content = new ItemsRepeaterScrollHost() {
+                        Width = 400,
+                        Height = 800,
+                        ScrollViewer = new ScrollViewer {
+                            Content = repeater
+                        }
+                    };
+
+                    Content.UpdateLayout();
+
+                    var counters = RepeaterTestHooks.GetLayoutCounters();
+                    Log.Comment($"Realized: {counters.ElementsRealized}, Recycled: {counters.ElementsRecycled}, Measured: {counters.ElementsMeasured}, Reflow passes: {counters.ReflowPasses}, Anchor changes: {counters.AnchorChanges}");
+                    foreach (RepeaterLayoutSpan span in Enum.GetValues(typeof(RepeaterLayoutSpan)))
+                    {
+                        var stats = RepeaterTestHooks.GetLayoutSpanStats(span);
+                        Log.Comment($"{span}: {stats.Count} spans, {stats.TotalInMs:F3}ms total, {stats.MaxInMs:F3}ms max");
+                    }
+
+                    Verify.IsGreaterThan(counters.ElementsRealized, 0);
+                    Verify.AreEqual(0, counters.ElementsRecycled);
+                    Verify.IsGreaterThanOrEqual(counters.ElementsMeasured, counters.ElementsRealized);
+                    Verify.IsGreaterThan(counters.AnchorChanges, 0);
+                    Verify.AreEqual(0, counters.ReflowPasses);
+
+                    var measure = RepeaterTestHooks.GetLayoutSpanStats(RepeaterLayoutSpan.Measure);
+                    var generate = RepeaterTestHooks.GetLayoutSpanStats(RepeaterLayoutSpan.Generate);
+                    Verify.IsGreaterThan(measure.Count, 0);
+                    Verify.IsGreaterThan(generate.Count, 0);
+                    Verify.IsGreaterThanOrEqual(measure.TotalInMs, generate.TotalInMs);
+                    Verify.IsGreaterThanOrEqual(measure.TotalInMs, measure.MaxInMs);
+
+                    Log.Comment("Every element came from the element factory and was created from its template.");
+                    Verify.AreEqual(counters.ElementsRealized, RepeaterTestHooks.GetLayoutSpanStats(RepeaterLayoutSpan.GetElementFromElementFactory).Count);
+                    Verify.AreEqual(counters.ElementsRealized, RepeaterTestHooks.GetLayoutSpanStats(RepeaterLayoutSpan.TemplateInstantiation).Count);
+
+                    Log.Comment("Validate that nothing is recorded once metrics are disabled.");
+                    RepeaterTestHooks.SetLayoutMetricsEnabled(false);
+                    RepeaterTestHooks.ResetLayoutMetrics();
+                    repeater.InvalidateMeasure();
+                    Content.UpdateLayout();
+                    Verify.AreEqual(0, RepeaterTestHooks.GetLayoutSpanStats(RepeaterLayoutSpan.Measure).Count);
+                    Verify.AreEqual(0, RepeaterTestHooks.GetLayoutCounters().ElementsMeasured);
+                }
+                finally
+                {
+                    RepeaterTestHooks.SetLayoutMetricsEnabled(false);
+                }
+            });
+        }
+
         [TestMethod]
         public void ValidateRepeaterDefaults()
         {
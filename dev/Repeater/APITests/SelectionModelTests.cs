@@ -927,6 +927,43 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateSelectAllOnLargeSource()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int itemCount = 1000000;
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, itemCount).ToList();
+
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                selectionModel.SelectAll();
+                var selectedIndices = selectionModel.SelectedIndices;
+                Verify.AreEqual(itemCount, selectedIndices.Count);
+                Verify.AreEqual(0, selectedIndices[0].GetAt(0));
+                Verify.AreEqual(500000, selectedIndices[500000].GetAt(0));
+                Verify.AreEqual(itemCount - 1, selectedIndices[itemCount - 1].GetAt(0));
+                Verify.AreEqual(123456, selectionModel.SelectedItems[123456]);
+                stopwatch.Stop();
+                Log.Comment("Select all and read indices took {0} ms", stopwatch.Elapsed.TotalMilliseconds);
+
+                Log.Comment("Deselect a range in the middle and select an overlapping range");
+                selectionModel.DeselectRange(IndexPath.CreateFrom(10), IndexPath.CreateFrom(19));
+                selectedIndices = selectionModel.SelectedIndices;
+                Verify.AreEqual(itemCount - 10, selectedIndices.Count);
+                Verify.AreEqual(9, selectedIndices[9].GetAt(0));
+                Verify.AreEqual(20, selectedIndices[10].GetAt(0));
+                Verify.IsFalse(selectionModel.IsSelected(15).Value);
+
+                selectionModel.SelectRange(IndexPath.CreateFrom(5), IndexPath.CreateFrom(14));
+                selectedIndices = selectionModel.SelectedIndices;
+                Verify.AreEqual(itemCount - 5, selectedIndices.Count);
+                Verify.AreEqual(14, selectedIndices[14].GetAt(0));
+                Verify.AreEqual(20, selectedIndices[15].GetAt(0));
+                Verify.AreEqual(itemCount - 1, selectedIndices[itemCount - 6].GetAt(0));
+            });
+        }
+
         private void Select(SelectionModel manager, int index, bool select)
         {
             Log.Comment((select ? "Selecting " : "DeSelecting ") + index);
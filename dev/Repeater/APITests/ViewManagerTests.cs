@@ -545,6 +545,58 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        // ViewManager keeps track of realized elements itself instead of walking the children of the
+        // repeater. Validate the element to index mapping stays in sync as elements get recycled and
+        // the collection changes underneath.
+        [TestMethod]
+        public void ValidateRealizedElementsTrackingAfterRecyclingAndCollectionChanges()
+        {
+            var data = new ObservableCollection<int>(Enumerable.Range(0, 100));
+            ItemsSourceView dataSource = null;
+            RunOnUIThread.Execute(() => dataSource = new ItemsSourceView(data));
+            ScrollViewer scrollViewer = null;
+            var repeater = SetupRepeater(dataSource, null /*layout*/, out scrollViewer);
+            var viewChangedEvent = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChangedEvent.Set();
+                    }
+                };
+
+                repeater.Layout = new StackLayout();
+                repeater.ElementPrepared += (sender, args) =>
+                {
+                    ((FrameworkElement)args.Element).Height = 20;
+                };
+                repeater.UpdateLayout();
+
+                scrollViewer.ChangeView(null, 1000.0, null, disableAnimation: true);
+            });
+
+            Verify.IsTrue(viewChangedEvent.WaitOne(DefaultWaitTime), "Waiting for ViewChanged.");
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsNull(repeater.TryGetElement(0));
+                ValidateRealizedElements(repeater);
+
+                data.Insert(50, -1);
+                data.RemoveAt(60);
+                repeater.UpdateLayout();
+                ValidateRealizedElements(repeater);
+
+                data.Clear();
+                repeater.UpdateLayout();
+                Verify.AreEqual(0, ValidateRealizedElements(repeater));
+            });
+        }
+
         [TestMethod]
         public void CanResetLayoutAfterUniqueIdReset()
         {
@@ -687,6 +739,24 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                     () => { ValidateCurrentFocus(repeater, 0 /*expectedIndex */, "3" /* expectedContent */); }
                 });
         }
+        private int ValidateRealizedElements(ItemsRepeater repeater)
+        {
+            int realizedCount = 0;
+            for (int i = 0; i < VisualTreeHelper.GetChildrenCount(repeater); ++i)
+            {
+                var element = (UIElement)VisualTreeHelper.GetChild(repeater, i);
+                int index = repeater.GetElementIndex(element);
+                if (index >= 0)
+                {
+                    Verify.AreSame(element, repeater.TryGetElement(index));
+                    ++realizedCount;
+                }
+            }
+
+            Log.Comment("Realized elements: " + realizedCount);
+            return realizedCount;
+        }
+
         private void MoveFocusToIndex(ItemsRepeater repeater, int index)
         {
             var element = repeater.TryGetElement(index) as Control;
@@ -50,6 +50,7 @@ using IRepeaterScrollingSurface = Microsoft.UI.Private.Controls.IRepeaterScrolli
 using ConfigurationChangedEventHandler = Microsoft.UI.Private.Controls.ConfigurationChangedEventHandler;
 using PostArrangeEventHandler = Microsoft.UI.Private.Controls.PostArrangeEventHandler;
 using ViewportChangedEventHandler = Microsoft.UI.Private.Controls.ViewportChangedEventHandler;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -586,6 +587,95 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void CanBiasCacheBufferTowardScrollDirection()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone5))
+            {
+                Log.Warning("Skipping since the realization window is only biased when using effective viewport.");
+                return;
+            }
+
+            const double itemHeight = 50;
+            var scroller = (Scroller)null;
+            var repeater = (ItemsRepeater)null;
+            var scrollCompletedEvent = new AutoResetEvent(false);
+            var maxDistanceAheadOfViewport = double.MinValue;
+            var isScrolling = false;
+
+            RunOnUIThread.Execute(() =>
+            {
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 1000),
+                    ItemTemplate = SharedHelpers.GetDataTemplate(@"<Border Height='50' />"),
+                    Layout = new StackLayout()
+                };
+
+                scroller = new Scroller
+                {
+                    Content = repeater,
+                    Width = 400,
+                    Height = 400
+                };
+
+                repeater.ElementPrepared += (sender, args) =>
+                {
+                    if (isScrolling)
+                    {
+                        var distance = args.Index * itemHeight - (scroller.VerticalOffset + scroller.Height);
+                        maxDistanceAheadOfViewport = Math.Max(maxDistanceAheadOfViewport, distance);
+                    }
+                };
+
+                scroller.ScrollCompleted += (Scroller sender, ScrollCompletedEventArgs args) =>
+                {
+                    scrollCompletedEvent.Set();
+                };
+
+                Content = scroller;
+            });
+
+            Log.Comment("Let the cache buffer reach its full size.");
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                RepeaterTestHooks.ResetRealizationBufferStats(repeater);
+                isScrolling = true;
+                scroller.ScrollTo(0.0, 3000.0, new ScrollOptions(AnimationMode.Enabled, SnapPointsMode.Ignore));
+            });
+            Verify.IsTrue(scrollCompletedEvent.WaitOne(DefaultWaitTimeInMS));
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                isScrolling = false;
+                var stats = RepeaterTestHooks.GetRealizationBufferStats(repeater);
+                var bufferPerSide = repeater.VerticalCacheLength * scroller.Height / 2;
+                Log.Comment($"Animated scroll: {stats.Hits} hits, {stats.Misses} misses, realized up to {maxDistanceAheadOfViewport} pixels ahead of the viewport.");
+
+                Log.Comment("Validate that we realized further ahead than the unbiased buffer allows.");
+                Verify.IsGreaterThan(maxDistanceAheadOfViewport, bufferPerSide);
+                Verify.IsGreaterThan(stats.Hits, 0);
+
+                RepeaterTestHooks.ResetRealizationBufferStats(repeater);
+                scroller.ScrollTo(0.0, 40000.0, new ScrollOptions(AnimationMode.Disabled, SnapPointsMode.Ignore));
+            });
+            Verify.IsTrue(scrollCompletedEvent.WaitOne(DefaultWaitTimeInMS));
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var stats = RepeaterTestHooks.GetRealizationBufferStats(repeater);
+                Log.Comment($"Jump: {stats.Hits} hits, {stats.Misses} misses.");
+
+                Log.Comment("Validate that jumping past the realization window realizes the new viewport from scratch.");
+                Verify.AreEqual(0, stats.Hits);
+                Verify.IsGreaterThan(stats.Misses, 0);
+            });
+        }
+
         [TestMethod]
         public void CanRegisterElementsWithScrollingSurfaces()
         {
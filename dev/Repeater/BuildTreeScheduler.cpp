@@ -7,58 +7,189 @@
 #include "BuildTreeScheduler.h"
 #include "RepeaterTestHooks.h"
 
-double BuildTreeScheduler::m_budgetInMs = 40.0;
 thread_local QPCTimer BuildTreeScheduler::m_timer{};
 thread_local std::vector<WorkInfo> BuildTreeScheduler::m_pendingWork{};
+thread_local std::vector<WorkInfo> BuildTreeScheduler::m_workRegisteredDuringFrame{};
+thread_local uint64_t BuildTreeScheduler::m_nextWorkSequence{ 0 };
+thread_local bool BuildTreeScheduler::m_isRunningFrame{ false };
 thread_local winrt::event_token BuildTreeScheduler::m_renderingToken{};
+thread_local double BuildTreeScheduler::m_frameIntervalInMs{ c_defaultFrameIntervalInMs };
+thread_local double BuildTreeScheduler::m_lastFrameStartInMs{ -1.0 };
+thread_local double BuildTreeScheduler::m_frameStartInMs{ 0.0 };
+thread_local double BuildTreeScheduler::m_budgetInMs{ c_defaultFrameIntervalInMs * c_budgetFrameFraction };
+thread_local BuildTreeSchedulerStats BuildTreeScheduler::m_lastFrameStats{};
+thread_local bool BuildTreeScheduler::m_useManualClock{ false };
+thread_local double BuildTreeScheduler::m_manualClockInMs{ 0.0 };
 
-void BuildTreeScheduler::RegisterWork(int priority, const std::function<void()>& workFunc)
+static bool WorkRunsAfter(const WorkInfo& lhs, const WorkInfo& rhs)
+{
+    return lhs.RunsAfter(rhs);
+}
+
+uint64_t BuildTreeScheduler::RegisterWork(int priority, WorkFunc&& workFunc)
 {
     MUX_ASSERT(priority >= 0);
-    MUX_ASSERT(workFunc != nullptr);
+    MUX_ASSERT(workFunc);
 
     QueueTick();
-    m_pendingWork.push_back(WorkInfo(priority, workFunc));
+    const auto workId = m_nextWorkSequence++;
+
+    if (m_isRunningFrame)
+    {
+        // Work registered by running work waits for the next frame, otherwise work that
+        // keeps re-registering itself could keep the frame going forever.
+        m_workRegisteredDuringFrame.emplace_back(priority, workId, std::move(workFunc));
+    }
+    else
+    {
+        m_pendingWork.emplace_back(priority, workId, std::move(workFunc));
+        std::push_heap(m_pendingWork.begin(), m_pendingWork.end(), WorkRunsAfter);
+    }
+
+    return workId;
+}
+
+void BuildTreeScheduler::CancelWork(uint64_t workId)
+{
+    const auto isWork = [workId](const WorkInfo& info) { return info.Sequence() == workId; };
+
+    auto it = std::find_if(m_pendingWork.begin(), m_pendingWork.end(), isWork);
+    if (it != m_pendingWork.end())
+    {
+        m_pendingWork.erase(it);
+        std::make_heap(m_pendingWork.begin(), m_pendingWork.end(), WorkRunsAfter);
+        return;
+    }
+
+    it = std::find_if(m_workRegisteredDuringFrame.begin(), m_workRegisteredDuringFrame.end(), isWork);
+    if (it != m_workRegisteredDuringFrame.end())
+    {
+        m_workRegisteredDuringFrame.erase(it);
+    }
 }
 
 bool BuildTreeScheduler::ShouldYield()
 {
-    return m_timer.DurationInMilliSeconds() > m_budgetInMs;
+    return NowInMs() - m_frameStartInMs > m_budgetInMs;
 }
 
-void BuildTreeScheduler::OnRendering(const winrt::IInspectable&, const winrt::IInspectable&)
+void BuildTreeScheduler::UseManualClock(bool enabled)
 {
-      bool budgetReached = ShouldYield();
-    if (!budgetReached && m_pendingWork.size() > 0)
+    m_useManualClock = enabled;
+    m_manualClockInMs = 0.0;
+    m_frameIntervalInMs = c_defaultFrameIntervalInMs;
+    m_budgetInMs = c_defaultFrameIntervalInMs * c_budgetFrameFraction;
+    m_lastFrameStartInMs = -1.0;
+    m_frameStartInMs = NowInMs();
+
+    if (enabled)
+    {
+        UnhookRendering();
+    }
+    else if (!m_pendingWork.empty())
     {
-        // Sort in descending order of priority and work from the end of the list to avoid moving around during erase.
-        std::sort(m_pendingWork.begin(), m_pendingWork.end(), [](const auto& lhs, const auto& rhs) { return lhs.Priority() > rhs.Priority(); });
-        int currentIndex = static_cast<int>(m_pendingWork.size()) - 1;
+        QueueTick();
+    }
+}
+
+void BuildTreeScheduler::AdvanceManualClock(double milliseconds)
+{
+    MUX_ASSERT(m_useManualClock);
+    m_manualClockInMs += milliseconds;
+}
+
+void BuildTreeScheduler::RunFrame()
+{
+    const double frameStartInMs = NowInMs();
+    UpdateBudget(frameStartInMs);
+    m_frameStartInMs = frameStartInMs;
 
-        do
+    int jobsRun = 0;
+    {
+        m_isRunningFrame = true;
+        auto scopeGuard = gsl::finally([]()
+            {
+                m_isRunningFrame = false;
+                for (auto& info : m_workRegisteredDuringFrame)
+                {
+                    m_pendingWork.push_back(std::move(info));
+                    std::push_heap(m_pendingWork.begin(), m_pendingWork.end(), WorkRunsAfter);
+                }
+                m_workRegisteredDuringFrame.clear();
+            });
+
+        // Always run at least one job so that work longer than the budget still makes progress.
+        while (!m_pendingWork.empty() && (jobsRun == 0 || !ShouldYield()))
         {
-            m_pendingWork[currentIndex].InvokeWorkFunc();
-            m_pendingWork.erase(m_pendingWork.begin() + currentIndex);
-        } while (--currentIndex >= 0 && !ShouldYield());
+            // Take the work out of the queue before invoking it since the work can cancel other work.
+            std::pop_heap(m_pendingWork.begin(), m_pendingWork.end(), WorkRunsAfter);
+            auto workFunc = m_pendingWork.back().TakeWorkFunc();
+            m_pendingWork.pop_back();
+
+            workFunc();
+            ++jobsRun;
+        }
     }
 
+    m_lastFrameStats.jobsRun = jobsRun;
+    m_lastFrameStats.timeUsedInMs = NowInMs() - frameStartInMs;
+    m_lastFrameStats.jobsDeferred = static_cast<int>(m_pendingWork.size());
+    m_lastFrameStats.budgetInMs = m_budgetInMs;
+
     if (m_pendingWork.empty())
     {
         // No more pending work, unhook from rendering event since being hooked up will case wux to try to 
         // call the event at 60 frames per second
-        winrt::Windows::UI::Xaml::Media::CompositionTarget::CompositionTarget::Rendering(m_renderingToken);
-        m_renderingToken.value = 0;
+        UnhookRendering();
         RepeaterTestHooks::NotifyBuildTreeCompleted();
     }
+}
 
-    // Reset the timer so it snaps the time just before rendering
-    m_timer.Reset();
+void BuildTreeScheduler::OnRendering(const winrt::IInspectable&, const winrt::IInspectable&)
+{
+    RunFrame();
 }
 
-void  BuildTreeScheduler::QueueTick()
+void BuildTreeScheduler::QueueTick()
 {
-    if (m_renderingToken.value == 0)
+    if (m_renderingToken.value == 0 && !m_useManualClock)
     {
         m_renderingToken = winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering(OnRendering);
     }
-}
\ No newline at end of file
+}
+
+void BuildTreeScheduler::UnhookRendering()
+{
+    if (m_renderingToken.value != 0)
+    {
+        winrt::Windows::UI::Xaml::Media::CompositionTarget::CompositionTarget::Rendering(m_renderingToken);
+        m_renderingToken.value = 0;
+    }
+
+    // The next interval spans the time we were not hooked up, it says nothing about the frame rate.
+    m_lastFrameStartInMs = -1.0;
+}
+
+void BuildTreeScheduler::UpdateBudget(double frameStartInMs)
+{
+    if (m_lastFrameStartInMs >= 0.0)
+    {
+        const double frameIntervalInMs = frameStartInMs - m_lastFrameStartInMs;
+        if (frameIntervalInMs >= c_minTrackedFrameIntervalInMs && frameIntervalInMs <= c_maxTrackedFrameIntervalInMs)
+        {
+            // Frames only ever get stretched by work (ours included), so follow shorter intervals right away
+            // and longer ones slowly. Otherwise a frame we overran would grow the budget and overrun the next one.
+            m_frameIntervalInMs = frameIntervalInMs < m_frameIntervalInMs ?
+                frameIntervalInMs :
+                m_frameIntervalInMs + (frameIntervalInMs - m_frameIntervalInMs) / 16.0;
+        }
+    }
+
+    m_lastFrameStartInMs = frameStartInMs;
+    m_budgetInMs = std::clamp(m_frameIntervalInMs * c_budgetFrameFraction, c_minBudgetInMs, c_maxBudgetInMs);
+}
+
+double BuildTreeScheduler::NowInMs()
+{
+    return m_useManualClock ? m_manualClockInMs : m_timer.PreciseDurationInMilliSeconds();
+}
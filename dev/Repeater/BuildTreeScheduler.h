@@ -3,35 +3,188 @@
 
 #pragma once
 
+// Move-only, type-erased callable for scheduled work. Callables small enough to fit in
+// c_inlineStorageSize (e.g. a lambda capturing this, or a weak reference and a couple of values)
+// are stored inline so that registering work does not allocate.
+class WorkFunc final
+{
+public:
+    WorkFunc() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, WorkFunc>>>
+    WorkFunc(F&& func)
+    {
+        using Func = std::decay_t<F>;
+        if constexpr (c_fitsInline<Func>)
+        {
+            new (m_storage) Func(std::forward<F>(func));
+            m_ops = &InlineOps<Func>::s_ops;
+        }
+        else
+        {
+            new (m_storage) Func*(new Func(std::forward<F>(func)));
+            m_ops = &HeapOps<Func>::s_ops;
+        }
+    }
+
+    WorkFunc(WorkFunc&& other) noexcept { MoveFrom(other); }
+
+    WorkFunc& operator=(WorkFunc&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    WorkFunc(const WorkFunc&) = delete;
+    WorkFunc& operator=(const WorkFunc&) = delete;
+
+    ~WorkFunc() { Reset(); }
+
+    explicit operator bool() const { return m_ops != nullptr; }
+    void operator()() { m_ops->invoke(m_storage); }
+
+    void Reset()
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    static constexpr size_t c_inlineStorageSize = 4 * sizeof(void*);
+
+    template <typename Func>
+    static constexpr bool c_fitsInline =
+        sizeof(Func) <= c_inlineStorageSize &&
+        alignof(Func) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Func>;
+
+    struct Ops
+    {
+        void (*invoke)(void* storage);
+        // Move constructs the callable into destination and destroys the one in source.
+        void (*relocate)(void* source, void* destination);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename Func>
+    struct InlineOps
+    {
+        static Func& Get(void* storage) { return *static_cast<Func*>(storage); }
+        static void Invoke(void* storage) { Get(storage)(); }
+        static void Relocate(void* source, void* destination) { new (destination) Func(std::move(Get(source))); Get(source).~Func(); }
+        static void Destroy(void* storage) { Get(storage).~Func(); }
+        static constexpr Ops s_ops{ Invoke, Relocate, Destroy };
+    };
+
+    template <typename Func>
+    struct HeapOps
+    {
+        static Func*& Get(void* storage) { return *static_cast<Func**>(storage); }
+        static void Invoke(void* storage) { (*Get(storage))(); }
+        static void Relocate(void* source, void* destination) { new (destination) Func*(Get(source)); }
+        static void Destroy(void* storage) { delete Get(storage); }
+        static constexpr Ops s_ops{ Invoke, Relocate, Destroy };
+    };
+
+    void MoveFrom(WorkFunc& other) noexcept
+    {
+        if (other.m_ops)
+        {
+            other.m_ops->relocate(other.m_storage, m_storage);
+            m_ops = std::exchange(other.m_ops, nullptr);
+        }
+    }
+
+    const Ops* m_ops{ nullptr };
+    alignas(std::max_align_t) unsigned char m_storage[c_inlineStorageSize];
+};
+
 struct WorkInfo
 {
-    WorkInfo(int priority, const std::function<void()>& workFunc) :
+    WorkInfo(int priority, uint64_t sequence, WorkFunc&& workFunc) :
         m_priority(priority),
-        m_workFunc(workFunc)
+        m_sequence(sequence),
+        m_workFunc(std::move(workFunc))
     {}
 
     int Priority() const { return m_priority; }
-    void InvokeWorkFunc() const { m_workFunc(); }
+    uint64_t Sequence() const { return m_sequence; }
+    WorkFunc TakeWorkFunc() { return std::move(m_workFunc); }
+
+    // Heap ordering: the lowest priority value runs first, and work with equal priority
+    // runs in the order it was registered.
+    bool RunsAfter(const WorkInfo& other) const
+    {
+        return m_priority != other.m_priority ? m_priority > other.m_priority : m_sequence > other.m_sequence;
+    }
 
 private:
     int m_priority;
-    std::function<void()> m_workFunc;
+    uint64_t m_sequence;
+    WorkFunc m_workFunc;
 };
 
-// High performance time management using QueryPerformanceCounter
+struct BuildTreeSchedulerStats
+{
+    int jobsRun{ 0 };
+    double timeUsedInMs{ 0.0 };
+    int jobsDeferred{ 0 };
+    double budgetInMs{ 0.0 };
+};
+
+// Runs deferred work (phasing, prewarming, ...) on CompositionTarget::Rendering in priority order,
+// within a per frame budget that follows the measured frame interval.
 class BuildTreeScheduler final
 {
 public:
-    static void RegisterWork(int priority, const std::function<void()>& workFunc);
+    // Returns an id that can be passed to CancelWork.
+    static uint64_t RegisterWork(int priority, WorkFunc&& workFunc);
+    static void CancelWork(uint64_t workId);
     static bool ShouldYield();
 
+    static BuildTreeSchedulerStats LastFrameStats() { return m_lastFrameStats; }
+
+    // Test hooks. While the manual clock is enabled the scheduler does not hook the Rendering event,
+    // time only moves through AdvanceManualClock and frames only run through RunFrame.
+    static void UseManualClock(bool enabled);
+    static void AdvanceManualClock(double milliseconds);
+    static void RunFrame();
+
 private:
     static void OnRendering(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     static void QueueTick();
+    static void UnhookRendering();
+    static void UpdateBudget(double frameStartInMs);
+    static double NowInMs();
 
-    static double m_budgetInMs;
+    // Fraction of the display frame interval the scheduler may use.
+    static constexpr double c_budgetFrameFraction = 0.5;
+    static constexpr double c_minBudgetInMs = 4.0;
+    static constexpr double c_maxBudgetInMs = 40.0;
+    // Intervals outside of this range are gaps between bursts of work or duplicate callbacks,
+    // not the display refresh interval.
+    static constexpr double c_minTrackedFrameIntervalInMs = 4.0;
+    static constexpr double c_maxTrackedFrameIntervalInMs = 100.0;
+    static constexpr double c_defaultFrameIntervalInMs = 1000.0 / 60.0;
 
     static thread_local QPCTimer m_timer;
-    static thread_local std::vector<WorkInfo> m_pendingWork;
+    static thread_local std::vector<WorkInfo> m_pendingWork; // Heap ordered by WorkInfo::RunsAfter.
+    static thread_local std::vector<WorkInfo> m_workRegisteredDuringFrame;
+    static thread_local uint64_t m_nextWorkSequence;
+    static thread_local bool m_isRunningFrame;
     static thread_local winrt::event_token m_renderingToken;
-};
\ No newline at end of file
+    static thread_local double m_frameIntervalInMs;
+    static thread_local double m_lastFrameStartInMs;
+    static thread_local double m_frameStartInMs;
+    static thread_local double m_budgetInMs;
+    static thread_local BuildTreeSchedulerStats m_lastFrameStats;
+    static thread_local bool m_useManualClock;
+    static thread_local double m_manualClockInMs;
+};
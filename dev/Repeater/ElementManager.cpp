@@ -36,6 +36,10 @@ void ElementManager::OnBeginMeasure(const ScrollOrientation& orientation)
                 // Note: We could optimize when the count becomes smaller, but keeping
                 // it always up to date is the simplest option for now.
                 m_realizedElementLayoutBounds.resize(count, winrt::Rect());
+                m_invalidLayoutBoundsCount = static_cast<int>(std::count_if(
+                    m_realizedElementLayoutBounds.begin(),
+                    m_realizedElementLayoutBounds.end(),
+                    [](const winrt::Rect& bounds) { return !IsValidLayoutBounds(bounds); }));
             }
         }
     }
@@ -98,6 +102,7 @@ void ElementManager::Insert(int realizedIndex, int dataIndex, const winrt::UIEle
     m_realizedElements.insert(m_realizedElements.begin() + realizedIndex, tracker_ref<winrt::UIElement>{ m_owner, element });
     // Set bounds to an invalid rect since we do not know it yet.
     m_realizedElementLayoutBounds.insert(m_realizedElementLayoutBounds.begin() + realizedIndex, winrt::Rect{ -1.f, -1.f, -1.f, -1.f });
+    m_invalidLayoutBoundsCount++;
 }
 
 void ElementManager::ClearRealizedRange(int realizedIndex, int count)
@@ -115,6 +120,15 @@ void ElementManager::ClearRealizedRange(int realizedIndex, int count)
     }
 
     int endIndex = realizedIndex + count;
+    if (m_invalidLayoutBoundsCount > 0)
+    {
+        m_invalidLayoutBoundsCount -= static_cast<int>(std::count_if(
+            m_realizedElementLayoutBounds.begin() + realizedIndex,
+            m_realizedElementLayoutBounds.begin() + endIndex,
+            [](const winrt::Rect& bounds) { return !IsValidLayoutBounds(bounds); }));
+    }
+
+    // Erasing at either end of a deque only touches the erased entries.
     m_realizedElements.erase(m_realizedElements.begin() + realizedIndex, m_realizedElements.begin() + endIndex);
     m_realizedElementLayoutBounds.erase(m_realizedElementLayoutBounds.begin() + realizedIndex, m_realizedElementLayoutBounds.begin() + endIndex);
 
@@ -162,7 +176,7 @@ winrt::Rect ElementManager::GetLayoutBoundsForDataIndex(int dataIndex) const
 void ElementManager::SetLayoutBoundsForDataIndex(int dataIndex, const winrt::Rect& bounds)
 {
     int realizedIndex = GetRealizedRangeIndexFromDataIndex(dataIndex);
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    SetLayoutBounds(realizedIndex, bounds);
 }
 
 
@@ -173,7 +187,20 @@ winrt::Rect ElementManager::GetLayoutBoundsForRealizedIndex(int realizedIndex) c
 
 void ElementManager::SetLayoutBoundsForRealizedIndex(int realizedIndex, const winrt::Rect& bounds)
 {
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    SetLayoutBounds(realizedIndex, bounds);
+}
+
+void ElementManager::SetLayoutBounds(int realizedIndex, const winrt::Rect& bounds)
+{
+    auto& currentBounds = m_realizedElementLayoutBounds[realizedIndex];
+    m_invalidLayoutBoundsCount += (IsValidLayoutBounds(currentBounds) ? 0 : -1) + (IsValidLayoutBounds(bounds) ? 0 : 1);
+    currentBounds = bounds;
+}
+
+/* static */
+bool ElementManager::IsValidLayoutBounds(const winrt::Rect& bounds)
+{
+    return bounds.Width >= 0 && bounds.Height >= 0;
 }
 
 
@@ -375,20 +402,84 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
     int frontCutoffIndex = -1;
     int backCutoffIndex = realizedRangeSize;
 
-    for (int i = 0;
-        i < realizedRangeSize &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
-        ++i)
+    if (m_invalidLayoutBoundsCount == 0)
     {
-        ++frontCutoffIndex;
-    }
+        // All the bounds are known. Layouts using the ElementManager lay elements out in lines
+        // in index order along the scroll orientation, so the near edges of the elements never
+        // decrease and the elements starting before or after the window can be found with a
+        // binary search. Far edges are not ordered: in a wrapping line a tall element can be
+        // followed by a short one.
+        const bool isVertical = orientation == ScrollOrientation::Vertical;
+        const float windowStart = isVertical ? window.Y : window.X;
+        const float windowEnd = isVertical ? window.Y + window.Height : window.X + window.Width;
+        const auto nearEdge = [isVertical](const winrt::Rect& bounds) { return isVertical ? bounds.Y : bounds.X; };
+
+        const int countStartingBeforeWindow = CountLeadingRealizedBounds(
+            [&nearEdge, windowStart](const winrt::Rect& bounds)
+        {
+            return nearEdge(bounds) < windowStart;
+        });
+
+        // Of the elements starting before the window, only the ones in the last line can reach into
+        // it since lines don't overlap. Like a walk from the front, keep everything from the first
+        // of them that intersects the window.
+        int countBeforeWindow = countStartingBeforeWindow;
+        if (countStartingBeforeWindow > 0)
+        {
+            const float lineStart = nearEdge(m_realizedElementLayoutBounds[countStartingBeforeWindow - 1]);
+            int lineFirstIndex = countStartingBeforeWindow - 1;
+            while (lineFirstIndex > 0 && nearEdge(m_realizedElementLayoutBounds[lineFirstIndex - 1]) == lineStart)
+            {
+                --lineFirstIndex;
+            }
+
+            for (int i = lineFirstIndex; i < countStartingBeforeWindow; ++i)
+            {
+                if (Intersects(window, m_realizedElementLayoutBounds[i], orientation))
+                {
+                    countBeforeWindow = i;
+                    break;
+                }
+            }
+        }
+
+        const int countAfterWindow = realizedRangeSize - CountLeadingRealizedBounds(
+            [&nearEdge, windowEnd](const winrt::Rect& bounds)
+        {
+            return nearEdge(bounds) <= windowEnd;
+        });
 
-    for (int i = realizedRangeSize - 1;
-        i >= 0 &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
-        --i)
+        if (countBeforeWindow + countAfterWindow >= realizedRangeSize)
+        {
+            // No element intersects the window.
+            frontCutoffIndex = realizedRangeSize - 1;
+            backCutoffIndex = 0;
+        }
+        else
+        {
+            frontCutoffIndex += countBeforeWindow;
+            backCutoffIndex -= countAfterWindow;
+        }
+    }
+    else
     {
-        --backCutoffIndex;
+        // Elements inserted by a collection change don't have bounds yet and break the
+        // ordering, walk in from both ends instead.
+        for (int i = 0;
+            i < realizedRangeSize &&
+            !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
+            ++i)
+        {
+            ++frontCutoffIndex;
+        }
+
+        for (int i = realizedRangeSize - 1;
+            i >= 0 &&
+            !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
+            --i)
+        {
+            --backCutoffIndex;
+        }
     }
 
     if (backCutoffIndex < realizedRangeSize - 1)
@@ -402,6 +493,30 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
     }
 }
 
+// Returns how many realized elements, starting from the first one, have bounds for which
+// predicate is true. predicate has to be true for a prefix of the realized range and
+// false for the rest of it.
+template <typename Predicate>
+int ElementManager::CountLeadingRealizedBounds(const Predicate& predicate) const
+{
+    int begin = 0;
+    int end = static_cast<int>(m_realizedElementLayoutBounds.size());
+    while (begin < end)
+    {
+        const int middle = begin + (end - begin) / 2;
+        if (predicate(m_realizedElementLayoutBounds[middle]))
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
 /* static */
 bool ElementManager::Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation)
 {
@@ -53,6 +53,11 @@ private:
 
     void DiscardElementsOutsideWindow(const winrt::Rect& window, const ScrollOrientation& orientation);
     static bool Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation);
+    template <typename Predicate>
+    int CountLeadingRealizedBounds(const Predicate& predicate) const;
+
+    void SetLayoutBounds(int realizedIndex, const winrt::Rect& bounds);
+    static bool IsValidLayoutBounds(const winrt::Rect& bounds);
 
     void OnItemsAdded(int index, int count);
     void OnItemsRemoved(int index, int count);
@@ -61,8 +66,14 @@ private:
 
     const ITrackerHandleManager* m_owner;
 
-    std::vector<tracker_ref<winrt::UIElement>> m_realizedElements;
-    std::vector<winrt::Rect> m_realizedElementLayoutBounds;
+    // Elements get realized and cleared at both ends of the realized range, so these
+    // are deques to keep that O(1) per element.
+    std::deque<tracker_ref<winrt::UIElement>> m_realizedElements;
+    std::deque<winrt::Rect> m_realizedElementLayoutBounds;
+    // Number of entries in m_realizedElementLayoutBounds that are still the invalid
+    // rect set by Insert. While there are none, the bounds are ordered along the
+    // scroll orientation and can be binary searched.
+    int m_invalidLayoutBoundsCount{ 0 };
     int m_firstRealizedDataIndex{ -1 };
     winrt::VirtualizingLayoutContext m_context{ nullptr };
 };
@@ -82,6 +82,12 @@ void FlowLayout::OnItemsChangedCore(
     winrt::IInspectable const& source,
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
+    auto& measuredSizeIndex = GetAsFlowState(context.LayoutState())->MeasuredSizeIndex();
+    if (measuredSizeIndex.Count() > 0)
+    {
+        measuredSizeIndex.OnItemsSourceChanged(args);
+    }
+
     GetFlowAlgorithm(context).OnItemsSourceChanged(source, args, context);
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
@@ -132,19 +138,34 @@ winrt::FlowLayoutAnchorInfo FlowLayout::GetAnchorForRealizationRect(
         double averageItemsPerLine = 0;
         const double averageLineSize = GetAverageLineInfo(availableSize, context, flowState, averageItemsPerLine) + LineSpacing();
         MUX_ASSERT(averageItemsPerLine != 0);
-
-        const double extentMajorSize = lastExtent.*MajorSize() == 0 ? (itemsCount / averageItemsPerLine) * averageLineSize : lastExtent.*MajorSize();
+        const auto measuredSizeIndex = GetMeasuredSizeIndex(context, flowState);
+        const double estimatedItemShare = measuredSizeIndex && measuredSizeIndex->MeasuredCount() > 0 ?
+            measuredSizeIndex->AverageMeasuredSize() :
+            averageLineSize / averageItemsPerLine;
+
+        const double estimatedMajorSize = measuredSizeIndex ?
+            measuredSizeIndex->OffsetOf(itemsCount, estimatedItemShare, 0.0) :
+            (itemsCount / averageItemsPerLine) * averageLineSize;
+        const double extentMajorSize = lastExtent.*MajorSize() == 0 ? estimatedMajorSize : lastExtent.*MajorSize();
         if (itemsCount > 0 &&
             realizationRect.*MajorSize() > 0 &&
             DoesRealizationWindowOverlapExtent(realizationRect, MinorMajorRect(lastExtent.*MinorStart(), lastExtent.*MajorStart(), availableSize.*Minor(), static_cast<float>(extentMajorSize))))
         {
             const double realizationWindowStartWithinExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-            const int lineIndex = std::max(0, (int)(realizationWindowStartWithinExtent / averageLineSize));
-            anchorIndex = (int)(lineIndex * averageItemsPerLine);
-
-            // Clamp it to be within valid range
-            anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
-            offset = lineIndex * averageLineSize + lastExtent.*MajorStart();
+            if (measuredSizeIndex)
+            {
+                anchorIndex = measuredSizeIndex->IndexAt(realizationWindowStartWithinExtent, estimatedItemShare, 0.0);
+                offset = measuredSizeIndex->OffsetOf(anchorIndex, estimatedItemShare, 0.0) + lastExtent.*MajorStart();
+            }
+            else
+            {
+                const int lineIndex = std::max(0, (int)(realizationWindowStartWithinExtent / averageLineSize));
+                anchorIndex = (int)(lineIndex * averageItemsPerLine);
+
+                // Clamp it to be within valid range
+                anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
+                offset = lineIndex * averageLineSize + lastExtent.*MajorStart();
+            }
         }
     }
 
@@ -167,8 +188,18 @@ winrt::FlowLayoutAnchorInfo FlowLayout::GetAnchorForTargetElement(
         auto flowState = GetAsFlowState(state);
         double averageItemsPerLine = 0;
         const double averageLineSize = GetAverageLineInfo(availableSize, context, flowState, averageItemsPerLine) + LineSpacing();
-        const int lineIndex = (int)(targetIndex / averageItemsPerLine);
-        offset = lineIndex * averageLineSize + flowState->FlowAlgorithm().LastExtent().*MajorStart();
+        if (const auto measuredSizeIndex = GetMeasuredSizeIndex(context, flowState))
+        {
+            const double estimatedItemShare = measuredSizeIndex->MeasuredCount() > 0 ?
+                measuredSizeIndex->AverageMeasuredSize() :
+                averageLineSize / averageItemsPerLine;
+            offset = measuredSizeIndex->OffsetOf(targetIndex, estimatedItemShare, 0.0) + flowState->FlowAlgorithm().LastExtent().*MajorStart();
+        }
+        else
+        {
+            const int lineIndex = (int)(targetIndex / averageItemsPerLine);
+            offset = lineIndex * averageLineSize + flowState->FlowAlgorithm().LastExtent().*MajorStart();
+        }
     }
 
     return { index, offset };
@@ -199,16 +230,33 @@ winrt::Rect FlowLayout::GetExtent(
         const double averageLineSize = GetAverageLineInfo(availableSize, context, flowState, averageItemsPerLine) + LineSpacing();
 
         MUX_ASSERT(averageItemsPerLine != 0);
+        const auto measuredSizeIndex = GetMeasuredSizeIndex(context, flowState);
+        const double estimatedItemShare = measuredSizeIndex && measuredSizeIndex->MeasuredCount() > 0 ?
+            measuredSizeIndex->AverageMeasuredSize() :
+            averageLineSize / averageItemsPerLine;
+
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            const int linesBeforeFirst = static_cast<int>(firstRealizedItemIndex / averageItemsPerLine);
-            const double extentMajorStart = firstRealizedLayoutBounds.*MajorStart() - linesBeforeFirst * averageLineSize;
-            extent.*MajorStart() = static_cast<float>(extentMajorStart);
-            const int remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            const int remainingLinesAfterLast = static_cast<int>((remainingItems / averageItemsPerLine));
-            const double extentMajorSize = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + remainingLinesAfterLast * averageLineSize;
-            extent.*MajorSize() = static_cast<float>(extentMajorSize);
+            if (measuredSizeIndex)
+            {
+                const double extentMajorStart = firstRealizedLayoutBounds.*MajorStart() - measuredSizeIndex->OffsetOf(firstRealizedItemIndex, estimatedItemShare, 0.0);
+                extent.*MajorStart() = static_cast<float>(extentMajorStart);
+                const double remainingSize =
+                    measuredSizeIndex->OffsetOf(itemsCount, estimatedItemShare, 0.0) -
+                    measuredSizeIndex->OffsetOf(lastRealizedItemIndex + 1, estimatedItemShare, 0.0);
+                extent.*MajorSize() = static_cast<float>(MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + remainingSize);
+            }
+            else
+            {
+                const int linesBeforeFirst = static_cast<int>(firstRealizedItemIndex / averageItemsPerLine);
+                const double extentMajorStart = firstRealizedLayoutBounds.*MajorStart() - linesBeforeFirst * averageLineSize;
+                extent.*MajorStart() = static_cast<float>(extentMajorStart);
+                const int remainingItems = itemsCount - lastRealizedItemIndex - 1;
+                const int remainingLinesAfterLast = static_cast<int>((remainingItems / averageItemsPerLine));
+                const double extentMajorSize = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + remainingLinesAfterLast * averageLineSize;
+                extent.*MajorSize() = static_cast<float>(extentMajorSize);
+            }
 
             // If the available size is infinite, we will have realized all the items in one line.
             // In that case, the extent in the non virtualizing direction should be based on the
@@ -224,9 +272,12 @@ winrt::Rect FlowLayout::GetExtent(
             auto minItemSpacing = MinItemSpacing();
             // We dont have anything realized. make an educated guess.
             int numLines = (int)std::ceil(itemsCount / averageItemsPerLine);
+            const double estimatedMajorSize = measuredSizeIndex ?
+                measuredSizeIndex->OffsetOf(itemsCount, estimatedItemShare, 0.0) :
+                numLines * averageLineSize;
             extent =
                 std::isfinite(availableSizeMinor) ?
-                MinorMajorRect(0, 0, availableSizeMinor, std::max(0.0f, static_cast<float>(numLines * averageLineSize - lineSpacing))) :
+                MinorMajorRect(0, 0, availableSizeMinor, std::max(0.0f, static_cast<float>(estimatedMajorSize - lineSpacing))) :
                 MinorMajorRect(
                     0,
                     0,
@@ -355,6 +406,20 @@ void FlowLayout::Algorithm_OnLineArranged(
     double lineSize,
     const winrt::VirtualizingLayoutContext & context)
 {
+    // Recorded here rather than in OnLineArranged so that it does not depend on derived layouts
+    // calling the base implementation.
+    if (countInLine > 0)
+    {
+        if (const auto measuredSizeIndex = GetMeasuredSizeIndex(context, GetAsFlowState(context.LayoutState())))
+        {
+            const double itemShare = (lineSize + LineSpacing()) / countInLine;
+            for (int index = startIndex; index < startIndex + countInLine; ++index)
+            {
+                measuredSizeIndex->SetSize(index, itemShare);
+            }
+        }
+    }
+
     return overridable().OnLineArranged(
         startIndex,
         countInLine,
@@ -388,6 +453,10 @@ void FlowLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventAr
     {
         m_lineAlignment = unbox_value<winrt::FlowLayoutLineAlignment>(args.NewValue());
     }
+    else if (property == s_IsMeasuredSizeIndexEnabledProperty)
+    {
+        m_isMeasuredSizeIndexEnabled = unbox_value<bool>(args.NewValue());
+    }
 
     InvalidateLayout();
 }
@@ -422,4 +491,23 @@ double FlowLayout::GetAverageLineInfo(
     return avgLineSize;
 }
 
+MeasuredSizeIndex* FlowLayout::GetMeasuredSizeIndex(
+    const winrt::VirtualizingLayoutContext& context,
+    const winrt::com_ptr<FlowLayoutState>& flowState)
+{
+    auto& measuredSizeIndex = flowState->MeasuredSizeIndex();
+    if (!m_isMeasuredSizeIndexEnabled)
+    {
+        if (measuredSizeIndex.Count() > 0)
+        {
+            measuredSizeIndex.Clear();
+        }
+
+        return nullptr;
+    }
+
+    measuredSizeIndex.Resize(context.ItemCount());
+    return &measuredSizeIndex;
+}
+
 #pragma endregion
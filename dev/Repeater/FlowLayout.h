@@ -123,6 +123,12 @@ private:
         const winrt::com_ptr<FlowLayoutState>& flowState,
         double& avgCountInLine);
 
+    // Returns the state's measured size index sized to the item count, or null when
+    // IsMeasuredSizeIndexEnabled is not set.
+    MeasuredSizeIndex* GetMeasuredSizeIndex(
+        const winrt::VirtualizingLayoutContext& context,
+        const winrt::com_ptr<FlowLayoutState>& flowState);
+
     winrt::com_ptr<FlowLayoutState> GetAsFlowState(const winrt::IInspectable& state)
     {
         return winrt::get_self<FlowLayoutState>(state.as<winrt::FlowLayoutState>())->get_strong();
@@ -157,6 +163,7 @@ private:
     double m_minRowSpacing{};
     double m_minColumnSpacing{};
     winrt::FlowLayoutLineAlignment m_lineAlignment{ winrt::FlowLayoutLineAlignment::Start };
+    bool m_isMeasuredSizeIndexEnabled{};
 
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration. 
@@ -6,6 +6,7 @@
 #include <ItemsRepeater.common.h>
 #include "FlowLayoutAlgorithm.h"
 #include "VirtualizingLayoutContext.h"
+#include "RepeaterLayoutMetrics.h"
 
 void FlowLayoutAlgorithm::InitializeForContext(
     const winrt::VirtualizingLayoutContext& context,
@@ -60,11 +61,18 @@ winrt::Size FlowLayoutAlgorithm::Measure(
     m_elementManager.OnBeginMeasure(orientation);
 
     int anchorIndex = GetAnchorIndex(availableSize, isWrapping, minItemSpacing, layoutId);
+    if (anchorIndex != m_lastAnchorIndex)
+    {
+        RepeaterLayoutMetrics::Increment(RepeaterLayoutCounter::AnchorChanges);
+        m_lastAnchorIndex = anchorIndex;
+    }
+
     Generate(GenerateDirection::Forward, anchorIndex, availableSize, minItemSpacing, lineSpacing, maxItemsPerLine, layoutId);
     Generate(GenerateDirection::Backward, anchorIndex, availableSize, minItemSpacing, lineSpacing, maxItemsPerLine, layoutId);
     if (isWrapping && IsReflowRequired())
     {
         REPEATER_TRACE_INFO(L"%*s: \tReflow Pass \n", winrt::get_self<VirtualizingLayoutContext>(context)->Indent(), layoutId.data());
+        RepeaterLayoutMetrics::Increment(RepeaterLayoutCounter::ReflowPasses);
         auto firstElementBounds = m_elementManager.GetLayoutBoundsForRealizedIndex(0);
         firstElementBounds.*MinorStart() = 0;
         m_elementManager.SetLayoutBoundsForRealizedIndex(0, firstElementBounds);
@@ -79,6 +87,108 @@ winrt::Size FlowLayoutAlgorithm::Measure(
     return winrt::Size{ m_lastExtent.Width, m_lastExtent.Height };
 }
 
+winrt::Size FlowLayoutAlgorithm::MeasureUniform(
+    const winrt::Size& availableSize,
+    const winrt::VirtualizingLayoutContext& context,
+    const winrt::Size& itemSize,
+    double minItemSpacing,
+    double lineSpacing,
+    unsigned int maxItemsPerLine,
+    bool measureElements,
+    const ScrollOrientation& orientation,
+    const wstring_view& layoutId)
+{
+    SetScrollOrientation(orientation);
+    m_scrollOrientationSameAsFlow = availableSize.*Minor() == std::numeric_limits<float>::infinity();
+
+    const float itemSizeMinor = itemSize.*Minor();
+    const float itemSizeMajor = itemSize.*Major();
+    const float lineStep = itemSizeMajor + static_cast<float>(lineSpacing);
+    if (!IsVirtualizingContext() || m_scrollOrientationSameAsFlow || !(lineStep > 0.0f))
+    {
+        // Lines can only be located arithmetically when they stack along the scroll orientation.
+        return Measure(availableSize, context, true /* isWrapping */, minItemSpacing, lineSpacing, maxItemsPerLine, orientation, layoutId);
+    }
+
+    const int itemCount = context.ItemCount();
+    const int itemsPerLine = GetUniformItemsPerLine(availableSize.*Minor(), itemSizeMinor, minItemSpacing, maxItemsPerLine, itemCount);
+    const int lineCount = (itemCount + itemsPerLine - 1) / itemsPerLine;
+    const float itemStepMinor = itemSizeMinor + static_cast<float>(minItemSpacing);
+
+    // A line is inside the window if it starts before the window ends and ends after the
+    // window starts, which is the same test Generate uses to stop realizing.
+    const auto realizationRect = RealizationRect();
+    const double windowStart = realizationRect.*MajorStart();
+    const double windowEnd = MajorEnd(realizationRect);
+    const double firstLine = std::max(0.0, std::floor((windowStart - itemSizeMajor) / lineStep) + 1);
+    const double lastLine = std::min(lineCount - 1.0, std::ceil(windowEnd / lineStep) - 1);
+
+    int firstIndex = -1;
+    int lastIndex = -1;
+    if (itemCount > 0 && firstLine <= lastLine)
+    {
+        firstIndex = static_cast<int>(firstLine) * itemsPerLine;
+        lastIndex = std::min(itemCount - 1, (static_cast<int>(lastLine) + 1) * itemsPerLine - 1);
+    }
+
+    // An anchor outside of the window (e.g. from StartBringIntoView) moves the window onto
+    // its line. The viewport will follow it on the next pass.
+    const int suggestedAnchorIndex = context.RecommendedAnchorIndex();
+    if (suggestedAnchorIndex >= 0 && suggestedAnchorIndex < itemCount &&
+        (firstIndex == -1 || suggestedAnchorIndex < firstIndex || suggestedAnchorIndex > lastIndex))
+    {
+        const int windowLineCount = firstIndex == -1 ? 1 : static_cast<int>(lastLine - firstLine) + 1;
+        const int anchorLine = suggestedAnchorIndex / itemsPerLine;
+        firstIndex = anchorLine * itemsPerLine;
+        lastIndex = std::min(itemCount - 1, (anchorLine + windowLineCount) * itemsPerLine - 1);
+    }
+
+    REPEATER_TRACE_INFO(L"%*s: \tMeasureUniform Realization(%.0f,%.0f,%.0f,%.0f) Range [%d, %d] \n",
+        winrt::get_self<VirtualizingLayoutContext>(context)->Indent(),
+        layoutId.data(),
+        realizationRect.X, realizationRect.Y, realizationRect.Width, realizationRect.Height,
+        firstIndex, lastIndex);
+
+    EnsureUniformRealizedRange(firstIndex, lastIndex, layoutId);
+
+    // Elements that were realized in an earlier pass have already been measured at this size.
+    // When the items are fixed size, new elements are not measured either; Arrange measures
+    // them at the arranged size, which is the same size.
+    const bool itemSizeChanged = itemSize != m_lastUniformItemSize;
+    const bool shouldMeasure = measureElements || itemSizeChanged;
+    for (int index = firstIndex; index != -1 && index <= lastIndex; ++index)
+    {
+        const int line = index / itemsPerLine;
+        const int indexInLine = index - line * itemsPerLine;
+        if (shouldMeasure)
+        {
+            m_elementManager.GetRealizedElement(index).Measure(itemSize);
+        }
+
+        m_elementManager.SetLayoutBoundsForDataIndex(index, MinorMajorRect(
+            indexInLine * itemStepMinor,
+            line * lineStep,
+            itemSizeMinor,
+            itemSizeMajor));
+    }
+
+    m_lastUniformItemSize = itemSize;
+    m_firstRealizedDataIndexInsideRealizationWindow = firstIndex;
+    m_lastRealizedDataIndexInsideRealizationWindow = lastIndex;
+    RaiseLineArranged();
+    m_collectionChangePending = false;
+    m_lastAvailableSize = availableSize;
+    m_lastItemSpacing = minItemSpacing;
+    m_lastExtent = MinorMajorRect(
+        0.0f,
+        0.0f,
+        availableSize.*Minor(),
+        std::max(0.0f, lineCount * lineStep - static_cast<float>(lineSpacing)));
+    SetLayoutOrigin();
+
+    return winrt::Size{ m_lastExtent.Width, m_lastExtent.Height };
+}
+
 winrt::Size FlowLayoutAlgorithm::Arrange(
     const winrt::Size& finalSize,
     const winrt::VirtualizingLayoutContext& context,
@@ -134,6 +244,7 @@ winrt::Size FlowLayoutAlgorithm::MeasureElement(
 {
     auto measureSize = m_algorithmCallbacks->Algorithm_GetMeasureSize(index, availableSize, context);
     element.Measure(measureSize);
+    RepeaterLayoutMetrics::Increment(RepeaterLayoutCounter::ElementsMeasured);
     auto provisionalArrangeSize = m_algorithmCallbacks->Algorithm_GetProvisionalArrangeSize(index, measureSize, element.DesiredSize(), context);
     m_algorithmCallbacks->Algorithm_OnElementMeasured(element, index, availableSize, measureSize, element.DesiredSize(), provisionalArrangeSize, context);
 
@@ -286,6 +397,7 @@ void FlowLayoutAlgorithm::Generate(
     unsigned int maxItemsPerLine,
     const wstring_view& layoutId)
 {
+    RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::Generate);
     if (anchorIndex != -1)
     {
         int step = (direction == GenerateDirection::Forward) ? 1 : -1;
@@ -513,6 +625,76 @@ winrt::Rect FlowLayoutAlgorithm::EstimateExtent(const winrt::Size& availableSize
     return extent;
 }
 
+void FlowLayoutAlgorithm::EnsureUniformRealizedRange(int firstIndex, int lastIndex, const wstring_view& layoutId)
+{
+    const int realizedCount = m_elementManager.GetRealizedElementCount();
+    const int firstRealizedIndex = realizedCount > 0 ? m_elementManager.GetDataIndexFromRealizedRangeIndex(0) : -1;
+    const int lastRealizedIndex = realizedCount > 0 ? firstRealizedIndex + realizedCount - 1 : -1;
+
+    if (firstIndex == -1 || realizedCount == 0 || lastRealizedIndex < firstIndex || firstRealizedIndex > lastIndex)
+    {
+        // Nothing to keep. Recycle everything before realizing so the new range can reuse the elements.
+        m_elementManager.ClearRealizedRange();
+        for (int index = firstIndex; index != -1 && index <= lastIndex; ++index)
+        {
+            m_elementManager.EnsureElementRealized(true /* forward */, index, layoutId);
+        }
+    }
+    else
+    {
+        // Trim what left the window first so that those elements can be reused at the other end.
+        if (lastRealizedIndex > lastIndex)
+        {
+            m_elementManager.DiscardElementsOutsideWindow(true /* forward */, lastIndex + 1);
+        }
+
+        if (firstRealizedIndex < firstIndex)
+        {
+            m_elementManager.DiscardElementsOutsideWindow(false /* forward */, firstIndex - 1);
+        }
+
+        for (int index = firstRealizedIndex - 1; index >= firstIndex; --index)
+        {
+            m_elementManager.EnsureElementRealized(false /* forward */, index, layoutId);
+        }
+
+        for (int index = lastRealizedIndex + 1; index <= lastIndex; ++index)
+        {
+            m_elementManager.EnsureElementRealized(true /* forward */, index, layoutId);
+        }
+    }
+}
+
+/* static */
+int FlowLayoutAlgorithm::GetUniformItemsPerLine(
+    float availableSizeMinor,
+    float itemSizeMinor,
+    double minItemSpacing,
+    unsigned int maxItemsPerLine,
+    int itemCount)
+{
+    const double itemStepMinor = itemSizeMinor + minItemSpacing;
+    const double maxItemsInLine = std::min(static_cast<double>(std::max(1u, maxItemsPerLine)), static_cast<double>(std::max(1, itemCount)));
+    double itemsPerLine = maxItemsInLine;
+    if (itemStepMinor > 0)
+    {
+        // Same rule as Generate: an item stays on the line as long as it ends within the available size.
+        itemsPerLine = std::floor((availableSizeMinor + minItemSpacing) / itemStepMinor);
+        if (itemsPerLine > 1 && itemsPerLine * itemStepMinor - minItemSpacing > availableSizeMinor)
+        {
+            itemsPerLine--;
+        }
+        else if ((itemsPerLine + 1) * itemStepMinor - minItemSpacing <= availableSizeMinor)
+        {
+            itemsPerLine++;
+        }
+
+        itemsPerLine = std::min(maxItemsInLine, std::max(1.0, itemsPerLine));
+    }
+
+    return static_cast<int>(itemsPerLine);
+}
+
 void FlowLayoutAlgorithm::RaiseLineArranged()
 {
     auto realizationRect = RealizationRect();
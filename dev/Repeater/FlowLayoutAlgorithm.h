@@ -42,6 +42,19 @@ public:
         unsigned int maxItemsPerLine,
         const ScrollOrientation& orientation,
         const wstring_view& layoutId);
+    // Measure for layouts where every item has the same size. The line and position of any
+    // index are computed directly, so only the items inside the realization window get
+    // realized, no matter how far the window moved since the last pass.
+    winrt::Size MeasureUniform(
+        const winrt::Size& availableSize,
+        const winrt::VirtualizingLayoutContext& context,
+        const winrt::Size& itemSize,
+        double minItemSpacing,
+        double lineSpacing,
+        unsigned int maxItemsPerLine,
+        bool measureElements,
+        const ScrollOrientation& orientation,
+        const wstring_view& layoutId);
     winrt::Size Arrange(
         const winrt::Size& finalSize,
         const winrt::VirtualizingLayoutContext& context,
@@ -94,6 +107,13 @@ private:
         int index,
         GenerateDirection direction);
     winrt::Rect EstimateExtent(const winrt::Size& availableSize, const wstring_view& layoutId);
+    void EnsureUniformRealizedRange(int firstIndex, int lastIndex, const wstring_view& layoutId);
+    static int GetUniformItemsPerLine(
+        float availableSizeMinor,
+        float itemSizeMinor,
+        double minItemSpacing,
+        unsigned int maxItemsPerLine,
+        int itemCount);
     void RaiseLineArranged();
 #pragma endregion
 
@@ -133,6 +153,11 @@ private:
     winrt::Rect m_lastExtent{};
     int m_firstRealizedDataIndexInsideRealizationWindow{ -1 };
     int m_lastRealizedDataIndexInsideRealizationWindow{ -1 };
+    // Anchor picked by the previous measure pass, used to count anchor changes.
+    int m_lastAnchorIndex{ -1 };
+    // Item size used by the last MeasureUniform pass. Elements that stay realized only need
+    // to be measured again when it changes.
+    winrt::Size m_lastUniformItemSize{ -1.0f, -1.0f };
 
     // If the scroll orientation is the same as the folow orientation
     // we will only have one line since we will never wrap. In that case
@@ -5,6 +5,7 @@
 
 #include "FlowLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "MeasuredSizeIndex.h"
 
 class FlowLayoutState :
     public ReferenceTracker<FlowLayoutState, winrt::implementation::FlowLayoutStateT, winrt::composing>
@@ -20,6 +21,10 @@ public:
     double TotalLineSize() const { return m_totalLineSize; }
     int TotalLinesMeasured() const { return m_totalLinesMeasured; }
     double TotalItemsPerLine() const { return m_totalItemsPerLine; }
+    // Only populated when FlowLayout.IsMeasuredSizeIndexEnabled is set. Every item in an arranged
+    // line holds an equal share of the line size (including line spacing), so the offset of the
+    // first item in a line is exactly the sum of the lines before it.
+    ::MeasuredSizeIndex& MeasuredSizeIndex() { return m_measuredSizeIndex; }
 
     winrt::Size SpecialElementDesiredSize() const { return m_specialElementDesiredSize; }
     void SpecialElementDesiredSize(winrt::Size value) { m_specialElementDesiredSize = value; }
@@ -32,5 +37,6 @@ private:
     int m_totalLinesMeasured{};
     double m_totalItemsPerLine{};
     winrt::Size m_specialElementDesiredSize{};
+    ::MeasuredSizeIndex m_measuredSizeIndex{};
     static const int BufferSize = 100;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "ItemTemplateWrapper.h"
 #include "RecyclePool.h"
 #include "ItemsRepeater.common.h"
+#include "RepeaterLayoutMetrics.h"
 
 ItemTemplateWrapper::ItemTemplateWrapper(winrt::DataTemplate const& dataTemplate)
 {
@@ -53,7 +54,10 @@ winrt::UIElement ItemTemplateWrapper::GetElement(winrt::ElementFactoryGetArgs co
     if (!element)
     {
         // no element was found in recycle pool, create a new element
-        element = selectedTemplate.LoadContent().as<winrt::FrameworkElement>();
+        {
+            RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::TemplateInstantiation);
+            element = selectedTemplate.LoadContent().as<winrt::FrameworkElement>();
+        }
 
         // Template returned null, so insert empty element to render nothing
         if (!element) {
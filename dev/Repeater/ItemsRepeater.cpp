@@ -11,6 +11,7 @@
 #include "RepeaterAutomationPeer.h"
 #include "ViewportManagerWithPlatformFeatures.h"
 #include "ViewportManagerDownlevel.h"
+#include "RepeaterLayoutMetrics.h"
 #include "RuntimeProfiler.h"
 #include "ItemTemplateWrapper.h"
 
@@ -98,6 +99,8 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
 
     m_viewportManager->OnOwnerMeasuring();
 
+    MUX_TRACE_EVENT(RepeaterMeasureBegin, this, 0, 0, availableSize.Width, availableSize.Height);
+    RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::Measure);
     m_isLayoutInProgress = true;
     auto layoutInProgress = gsl::finally([this]()
     {
@@ -129,25 +132,30 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
         }
 
         // Clear auto recycle candidate elements that have not been kept alive by layout - i.e layout did not
-        // call GetElementAt(index).
-        auto children = Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+        // call GetElementAt(index). Clearing swap-removes from the realized elements, so walk them backwards.
+        const auto& realizedElements = m_viewManager.GetRealizedElements();
+        for (size_t i = realizedElements.size(); i-- > 0;)
         {
-            auto element = children.GetAt(i);
-            auto virtInfo = GetVirtualizationInfo(element);
+            if (i >= realizedElements.size())
+            {
+                continue;
+            }
+
+            auto virtInfo = realizedElements[i].VirtualizationInfo();
 
             if (virtInfo->Owner() == ElementOwner::Layout &&
                 virtInfo->AutoRecycleCandidate() &&
                 !virtInfo->KeepAlive())
             {
                 REPEATER_TRACE_INFO(L"AutoClear - %d \n", virtInfo->Index());
-                ClearElementImpl(element);
+                ClearElementImpl(realizedElements[i].Element());
             }
         }
     }
 
     m_viewportManager->SetLayoutExtent(extent);
     m_lastAvailableSize = availableSize;
+    MUX_TRACE_EVENT(RepeaterMeasureEnd, this, static_cast<int32_t>(m_viewManager.GetRealizedElements().size()), 0, desiredSize.Width, desiredSize.Height);
     return desiredSize;
 }
 
@@ -163,6 +171,7 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
         throw winrt::hresult_error(E_FAIL, L"Cannot run layout in the middle of a collection change.");
     }
 
+    MUX_TRACE_EVENT(RepeaterArrangeBegin, this, 0, 0, finalSize.Width, finalSize.Height);
     m_isLayoutInProgress = true;
     auto layoutInProgress = gsl::finally([this]()
     {
@@ -181,15 +190,20 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
     // off screen.
     m_viewManager.OnOwnerArranged();
 
-    auto children = Children();
-    for (unsigned i = 0u; i < children.Size(); ++i)
+    // Containers waiting in the recycle pool were tossed away when they got cleared, so only
+    // the elements cleared since the last arrange and the realized elements need a visit.
+    int touchedCount = 0;
+    const auto owner = static_cast<winrt::DependencyObject>(*this);
+    for (const auto& elementInfo : m_viewManager.TakeClearedElements())
     {
-        auto element = children.GetAt(i);
-        auto virtInfo = GetVirtualizationInfo(element);
+        auto element = elementInfo.Element();
+        auto virtInfo = elementInfo.VirtualizationInfo();
         virtInfo->KeepAlive(false);
+        ++touchedCount;
 
-        if (virtInfo->Owner() == ElementOwner::ElementFactory ||
-            virtInfo->Owner() == ElementOwner::PinnedPool)
+        if ((virtInfo->Owner() == ElementOwner::ElementFactory ||
+            virtInfo->Owner() == ElementOwner::PinnedPool) &&
+            CachedVisualTreeHelpers::GetParent(element) == owner)
         {
             // Toss it away. And arrange it with size 0 so that XYFocus won't use it.
             element.Arrange(winrt::Rect{
@@ -198,20 +212,48 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
                 0.0f,
                 0.0f });
         }
-        else
+    }
+
+    const auto visibleWindow = VisibleWindow();
+    for (const auto& elementInfo : m_viewManager.GetRealizedElements())
+    {
+        auto element = elementInfo.Element();
+        auto virtInfo = elementInfo.VirtualizationInfo();
+        virtInfo->KeepAlive(false);
+        ++touchedCount;
+
+        if (virtInfo->Owner() == ElementOwner::Layout)
         {
             const auto newBounds = CachedVisualTreeHelpers::GetLayoutSlot(element.as<winrt::FrameworkElement>());
+            const bool wasArranged = virtInfo->ArrangeBounds() != ItemsRepeater::InvalidRect;
 
-            if (virtInfo->ArrangeBounds() != ItemsRepeater::InvalidRect &&
+            if (wasArranged &&
                 newBounds != virtInfo->ArrangeBounds())
             {
                 m_animationManager.OnElementBoundsChanged(element, virtInfo->ArrangeBounds(), newBounds);
             }
 
             virtInfo->ArrangeBounds(newBounds);
+
+            const bool isInVisibleWindow = SharedHelpers::DoRectsIntersect(visibleWindow, newBounds);
+            if (isInVisibleWindow && !virtInfo->IsInVisibleWindow())
+            {
+                if (wasArranged)
+                {
+                    ++m_realizationBufferHits;
+                }
+                else
+                {
+                    ++m_realizationBufferMisses;
+                }
+            }
+            virtInfo->IsInVisibleWindow(isInVisibleWindow);
         }
     }
 
+    REPEATER_TRACE_INFO(L"%*s: \tArrange touched %d elements. \n", Indent(), L"", touchedCount);
+    MUX_TRACE_EVENT(RepeaterArrangeEnd, this, touchedCount);
+
     m_viewportManager->OnOwnerArranged();
     m_animationManager.OnOwnerArranged();
 
@@ -275,6 +317,19 @@ void ItemsRepeater::ClearElementImpl(const winrt::UIElement& element)
     m_viewportManager->OnElementCleared(element);
 }
 
+void ItemsRepeater::ClearAllRealizedElements()
+{
+    // Clearing an element swap-removes it from the realized elements, so walk them backwards.
+    const auto& realizedElements = m_viewManager.GetRealizedElements();
+    for (size_t i = realizedElements.size(); i-- > 0;)
+    {
+        if (i < realizedElements.size())
+        {
+            ClearElementImpl(realizedElements[i].Element());
+        }
+    }
+}
+
 int ItemsRepeater::GetElementIndexImpl(const winrt::UIElement& element)
 {
     auto virtInfo = TryGetVirtualizationInfo(element);
@@ -283,20 +338,7 @@ int ItemsRepeater::GetElementIndexImpl(const winrt::UIElement& element)
 
 winrt::UIElement ItemsRepeater::GetElementFromIndexImpl(int index)
 {
-    winrt::UIElement result = nullptr;
-
-    auto children = Children();
-    for (unsigned i = 0u; i < children.Size() && !result; ++i)
-    {
-        auto element = children.GetAt(i);
-        auto virtInfo = TryGetVirtualizationInfo(element);
-        if (virtInfo && virtInfo->IsRealized() && virtInfo->Index() == index)
-        {
-            result = element;
-        }
-    }
-
-    return result;
+    return m_viewManager.TryGetRealizedElement(index);
 }
 
 winrt::UIElement ItemsRepeater::GetOrCreateElementImpl(int index)
@@ -537,13 +579,7 @@ void ItemsRepeater::OnDataSourcePropertyChanged(const winrt::ItemsSourceView& ol
         {
             // Walk through all the elements and make sure they are cleared for
             // non-virtualizing layouts.
-            for (const auto& element: Children())
-            {
-                if (GetVirtualizationInfo(element)->IsRealized())
-                {
-                    ClearElementImpl(element);
-                }
-            }
+            ClearAllRealizedElements();
         }
 
         InvalidateMeasure();
@@ -584,15 +620,7 @@ void ItemsRepeater::OnItemTemplateChanged(const winrt::IElementFactory& oldValue
         {
             // Walk through all the elements and make sure they are cleared for
             // non-virtualizing layouts.
-            auto children = Children();
-            for (unsigned i = 0u; i < children.Size(); ++i)
-            {
-                auto element = children.GetAt(i);
-                if (GetVirtualizationInfo(element)->IsRealized())
-                {
-                    ClearElementImpl(element);
-                }
-            }
+            ClearAllRealizedElements();
         }
     }
 
@@ -647,15 +675,7 @@ void ItemsRepeater::OnLayoutChanged(const winrt::Layout& oldValue, const winrt::
         m_arrangeInvalidated.revoke();
         
         // Walk through all the elements and make sure they are cleared
-        auto children = Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
-        {
-            auto element = children.GetAt(i);
-            if (GetVirtualizationInfo(element)->IsRealized())
-            {
-                ClearElementImpl(element);
-            }
-        }
+        ClearAllRealizedElements();
 
         m_layoutState.set(nullptr);
     }
@@ -92,6 +92,12 @@ public:
     winrt::Point LayoutOrigin() const { return m_layoutOrigin; }
     void LayoutOrigin(winrt::Point value) { m_layoutOrigin = value; }
 
+    // Elements that became visible after having been realized (and arranged) in the realization buffer
+    // are hits, elements that had to be realized in the same pass they became visible in are misses.
+    int RealizationBufferHits() const { return m_realizationBufferHits; }
+    int RealizationBufferMisses() const { return m_realizationBufferMisses; }
+    void ResetRealizationBufferStats() { m_realizationBufferHits = 0; m_realizationBufferMisses = 0; }
+
     // Pinning APIs
     void PinElement(winrt::UIElement const& element);
     void UnpinElement(winrt::UIElement const& element);
@@ -130,6 +136,8 @@ private:
     void InvalidateMeasureForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
     void InvalidateArrangeForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
 
+    void ClearAllRealizedElements();
+
     winrt::VirtualizingLayoutContext GetLayoutContext();
     bool IsProcessingCollectionChange() const { return m_processingItemsSourceChange != nullptr; }
 
@@ -154,6 +162,9 @@ private:
     // when it gets measured. It should not be used outside of measure.
     winrt::Point m_layoutOrigin{};
 
+    int m_realizationBufferHits{};
+    int m_realizationBufferMisses{};
+
     // Event revokers
     winrt::ItemsSourceView::CollectionChanged_revoker m_itemsSourceViewChanged{};
     winrt::Layout::MeasureInvalidated_revoker m_measureInvalidated{};
@@ -0,0 +1,199 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "MeasuredSizeIndex.h"
+
+void MeasuredSizeIndex::Clear()
+{
+    // Release the memory, the index can be large for big collections.
+    std::vector<double>().swap(m_sizes);
+    std::vector<double>().swap(m_sizeTree);
+    std::vector<int>().swap(m_countTree);
+    m_measuredSize = 0.0;
+    m_measuredCount = 0;
+    m_isTreeValid = false;
+}
+
+void MeasuredSizeIndex::Resize(int count)
+{
+    MUX_ASSERT(count >= 0);
+    if (count < Count())
+    {
+        Remove(count, Count() - count);
+    }
+    else if (count > Count())
+    {
+        Insert(Count(), count - Count());
+    }
+}
+
+void MeasuredSizeIndex::Insert(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && index <= Count());
+    m_sizes.insert(m_sizes.begin() + index, count, c_unmeasured);
+    m_isTreeValid = false;
+}
+
+void MeasuredSizeIndex::Remove(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && index + count <= Count());
+    Invalidate(index, count);
+    m_sizes.erase(m_sizes.begin() + index, m_sizes.begin() + index + count);
+    m_isTreeValid = false;
+}
+
+void MeasuredSizeIndex::Invalidate(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && index + count <= Count());
+    for (int i = index; i < index + count; ++i)
+    {
+        if (IsMeasured(i))
+        {
+            m_measuredSize -= m_sizes[i];
+            --m_measuredCount;
+            m_sizes[i] = c_unmeasured;
+        }
+    }
+
+    m_isTreeValid = false;
+}
+
+void MeasuredSizeIndex::OnItemsSourceChanged(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+        Insert(args.NewStartingIndex(), args.NewItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Replace:
+        if (args.OldItems().Size() == args.NewItems().Size() && args.OldStartingIndex() == args.NewStartingIndex())
+        {
+            Invalidate(args.OldStartingIndex(), args.OldItems().Size());
+        }
+        else
+        {
+            Remove(args.OldStartingIndex(), args.OldItems().Size());
+            Insert(args.NewStartingIndex(), args.NewItems().Size());
+        }
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Remove:
+        Remove(args.OldStartingIndex(), args.OldItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Move:
+        Remove(args.OldStartingIndex(), args.OldItems().Size());
+        Insert(args.NewStartingIndex(), args.NewItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Reset:
+        Clear();
+        break;
+    }
+}
+
+void MeasuredSizeIndex::SetSize(int index, double size)
+{
+    MUX_ASSERT(index >= 0 && index < Count());
+    MUX_ASSERT(size >= 0.0);
+
+    const bool wasMeasured = IsMeasured(index);
+    const double sizeDelta = size - (wasMeasured ? m_sizes[index] : 0.0);
+    const int countDelta = wasMeasured ? 0 : 1;
+    m_sizes[index] = size;
+    m_measuredSize += sizeDelta;
+    m_measuredCount += countDelta;
+
+    if (m_isTreeValid)
+    {
+        const int count = Count();
+        for (int i = index + 1; i <= count; i += i & -i)
+        {
+            m_sizeTree[i] += sizeDelta;
+            m_countTree[i] += countDelta;
+        }
+    }
+}
+
+double MeasuredSizeIndex::OffsetOf(int index, double estimatedSize, double spacing) const
+{
+    MUX_ASSERT(index >= 0 && index <= Count());
+    EnsureTree();
+
+    double measuredSize = 0.0;
+    int measuredCount = 0;
+    for (int i = index; i > 0; i -= i & -i)
+    {
+        measuredSize += m_sizeTree[i];
+        measuredCount += m_countTree[i];
+    }
+
+    return measuredSize + (index - measuredCount) * estimatedSize + index * spacing;
+}
+
+int MeasuredSizeIndex::IndexAt(double offset, double estimatedSize, double spacing) const
+{
+    const int count = Count();
+    if (count == 0)
+    {
+        return -1;
+    }
+
+    EnsureTree();
+
+    // Walk down the tree looking for the number of items that end at or before offset.
+    int position = 0;
+    double remaining = offset;
+    int step = 1;
+    while (step * 2 <= count)
+    {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2)
+    {
+        const int next = position + step;
+        if (next <= count)
+        {
+            // Node next covers the step items after position.
+            const double nodeSize = m_sizeTree[next] + (step - m_countTree[next]) * estimatedSize + step * spacing;
+            if (nodeSize <= remaining)
+            {
+                position = next;
+                remaining -= nodeSize;
+            }
+        }
+    }
+
+    return std::min(position, count - 1);
+}
+
+void MeasuredSizeIndex::EnsureTree() const
+{
+    if (!m_isTreeValid)
+    {
+        const int count = Count();
+        m_sizeTree.assign(count + 1, 0.0);
+        m_countTree.assign(count + 1, 0);
+        for (int i = 1; i <= count; ++i)
+        {
+            if (IsMeasured(i - 1))
+            {
+                m_sizeTree[i] += m_sizes[i - 1];
+                m_countTree[i] += 1;
+            }
+
+            const int parent = i + (i & -i);
+            if (parent <= count)
+            {
+                m_sizeTree[parent] += m_sizeTree[i];
+                m_countTree[parent] += m_countTree[i];
+            }
+        }
+
+        m_isTreeValid = true;
+    }
+}
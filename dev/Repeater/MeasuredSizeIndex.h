@@ -0,0 +1,48 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Sizes of items along the virtualizing direction, indexed by a Fenwick tree so that the offset
+// of an item and the item at an offset are found in O(log n). Items that have not been measured
+// yet count as the estimated size passed in by the caller, and every item is followed by spacing.
+class MeasuredSizeIndex final
+{
+public:
+    int Count() const { return static_cast<int>(m_sizes.size()); }
+    int MeasuredCount() const { return m_measuredCount; }
+    // Average size of the measured items, 0 if nothing was measured yet.
+    double AverageMeasuredSize() const { return m_measuredCount > 0 ? m_measuredSize / m_measuredCount : 0.0; }
+
+    void Clear();
+    // Keeps the sizes of existing items, new items are not measured.
+    void Resize(int count);
+    void Insert(int index, int count);
+    void Remove(int index, int count);
+    void Invalidate(int index, int count);
+    void OnItemsSourceChanged(const winrt::NotifyCollectionChangedEventArgs& args);
+
+    void SetSize(int index, double size);
+    bool IsMeasured(int index) const { return m_sizes[index] >= 0.0; }
+
+    // Distance from the start of the first item to the start of the item at index.
+    // index can be Count() to get the total size including the trailing spacing.
+    double OffsetOf(int index, double estimatedSize, double spacing) const;
+    // Index of the item that contains offset, clamped to the valid range. -1 if there are no items.
+    int IndexAt(double offset, double estimatedSize, double spacing) const;
+
+private:
+    void EnsureTree() const;
+
+    static constexpr double c_unmeasured = -1.0;
+
+    std::vector<double> m_sizes{};
+    double m_measuredSize{};
+    int m_measuredCount{};
+
+    // 1-based Fenwick trees over the measured sizes and over the number of measured items.
+    // They are rebuilt in O(n) after collection changes and updated in O(log n) otherwise.
+    mutable std::vector<double> m_sizeTree{};
+    mutable std::vector<int> m_countTree{};
+    mutable bool m_isTreeValid{ false };
+};
@@ -9,6 +9,7 @@
 #include "VirtualizationInfo.h"
 #include "ItemsRepeater.h"
 #include "Phaser.h"
+#include "RepeaterLayoutMetrics.h"
 
 Phaser::Phaser(ItemsRepeater* owner) :
     m_owner(owner)
@@ -16,6 +17,23 @@ Phaser::Phaser(ItemsRepeater* owner) :
     // ItemsRepeater is not fully constructed yet. Don't interact with it.
 }
 
+Phaser::~Phaser()
+{
+    // The scheduled callback captures this.
+    if (m_registeredForCallback)
+    {
+        BuildTreeScheduler::CancelWork(m_callbackWorkId);
+    }
+
+    for (auto& pendingElement : m_nodes)
+    {
+        if (pendingElement.virtInfo)
+        {
+            pendingElement.virtInfo->PhasingSlot(-1);
+        }
+    }
+}
+
 void Phaser::PhaseElement(
     const winrt::UIElement& element,
     const winrt::com_ptr<VirtualizationInfo>& virtInfo)
@@ -62,9 +80,33 @@ void Phaser::PhaseElement(
 
     if (shouldPhase)
     {
-        // Insert at the top since we remove from bottom during DoPhasedWorkCallback. This keeps the ordering of items
-        // the same as the order in which items are realized.
-        m_pendingElements.insert(m_pendingElements.begin(), ElementInfo(element, virtInfo));
+        if (virtInfo->PhasingSlot() != -1)
+        {
+            RemoveNode(virtInfo->PhasingSlot());
+        }
+
+        int node = m_firstFreeNode;
+        if (node != -1)
+        {
+            m_firstFreeNode = m_nodes[node].next;
+        }
+        else
+        {
+            node = static_cast<int>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        auto& pendingElement = m_nodes[node];
+        pendingElement.element = element;
+        pendingElement.virtInfo = virtInfo.get();
+        pendingElement.phase = nextPhase;
+        pendingElement.inVisibleWindow = SharedHelpers::DoRectsIntersect(m_visibleWindow, virtInfo->ArrangeBounds());
+        virtInfo->PhasingSlot(node);
+        m_pendingCount++;
+
+        // Appending keeps the ordering of items within a phase the same as the order in which items are realized.
+        LinkNode(node, false /* atFront */);
+        m_unclassifiedNodes.push_back(node);
         RegisterForCallback();
     }
 }
@@ -73,14 +115,9 @@ void Phaser::StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<V
 {
     // We need to remove the element from the pending elements list. We cannot just change the phase to -1
     // since it will get updated when the element gets recycled.
-    if (virtInfo->DataTemplateComponent())
+    if (virtInfo->PhasingSlot() != -1)
     {
-        auto it = std::find_if(m_pendingElements.begin(), m_pendingElements.end(), [&element](const ElementInfo& info) { return info.Element() == element; });
-
-        if (it != m_pendingElements.end())
-        {
-            m_pendingElements.erase(it);
-        }
+        RemoveNode(virtInfo->PhasingSlot());
     }
 
     // Clean Phasing information for this item.
@@ -91,17 +128,16 @@ void Phaser::DoPhasedWorkCallback()
 {
     MarkCallbackRecieved();
 
-    if (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield())
+    if (m_pendingCount > 0 && !BuildTreeScheduler::ShouldYield())
     {
-        const auto visibleWindow = m_owner->VisibleWindow();
-        SortElements(visibleWindow);
-        int currentIndex = static_cast<int>(m_pendingElements.size()) - 1;
+        RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::PhaserPass);
+        UpdateVisibleWindow(m_owner->VisibleWindow());
         do
         {
-            auto info = m_pendingElements[currentIndex];
-            auto element = info.Element();
-            auto virtInfo = info.VirtInfo();
-            auto dataIndex = virtInfo->Index();
+            // Highest phase first, elements in the visible window before the others.
+            const int node = NextPendingElement();
+            auto element = m_nodes[node].element;
+            auto virtInfo = m_nodes[node].virtInfo;
 
             int currentPhase = virtInfo->Phase();
             if (currentPhase > 0)
@@ -113,52 +149,33 @@ void Phaser::DoPhasedWorkCallback()
                 auto previousAvailableSize = winrt::LayoutInformation::GetAvailableSize(element);
                 element.Measure(previousAvailableSize);
 
-                if (nextPhase > 0)
+                // Measuring can stop phasing of the element, in which case its node is already gone.
+                if (virtInfo->PhasingSlot() == node)
                 {
-                    virtInfo->Phase(nextPhase);
-                    // If we are the first item or 
-                    // If the current items phase is higher than the next items phase, then move to the next item.
-                    if (currentIndex == 0 ||
-                        virtInfo->Phase() > m_pendingElements[currentIndex - 1].VirtInfo()->Phase())
+                    if (nextPhase > 0)
                     {
-                        currentIndex--;
+                        virtInfo->Phase(nextPhase);
+
+                        // Move to the bucket of the next phase. That bucket gets processed before this one, and putting
+                        // the item first keeps working on it until it is done.
+                        UnlinkNode(node);
+                        m_nodes[node].phase = nextPhase;
+                        LinkNode(node, true /* atFront */);
+                    }
+                    else
+                    {
+                        RemoveNode(node);
                     }
-                }
-                else
-                {
-                    m_pendingElements.erase(m_pendingElements.begin() + currentIndex);
-                    currentIndex--;
                 }
             }
             else
             {
                 throw winrt::hresult_error(E_FAIL, L"Cleared element found in pending list which is not expected");
             }
-
-            auto pendingCount = static_cast<int>(m_pendingElements.size());
-            if (currentIndex == -1)
-            {
-                // Reached the top, start from the bottom again
-                currentIndex = pendingCount - 1;
-            }
-            else if (currentIndex > -1 && currentIndex < pendingCount - 1)
-            {
-                // If the next element is oustide the visible window and there are elements in the visible window
-                // go back to the visible window.
-                bool nextItemIsVisible = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[currentIndex].VirtInfo()->ArrangeBounds());
-                if (!nextItemIsVisible)
-                {
-                    bool haveVisibleItems = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[pendingCount - 1].VirtInfo()->ArrangeBounds());
-                    if (haveVisibleItems)
-                    {
-                        currentIndex = pendingCount - 1;
-                    }
-                }
-            }
-        } while (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield());
+        } while (m_pendingCount > 0 && !BuildTreeScheduler::ShouldYield());
     }
 
-    if (!m_pendingElements.empty())
+    if (m_pendingCount > 0)
     {
         RegisterForCallback();
     }
@@ -168,10 +185,10 @@ void Phaser::RegisterForCallback()
 {
     if (!m_registeredForCallback)
     {
-        MUX_ASSERT(!m_pendingElements.empty());
+        MUX_ASSERT(m_pendingCount > 0);
         m_registeredForCallback = true;
-        BuildTreeScheduler::RegisterWork(
-            m_pendingElements[m_pendingElements.size() - 1].VirtInfo()->Phase(), // Use the phase of the last one in the sorted list
+        m_callbackWorkId = BuildTreeScheduler::RegisterWork(
+            m_nodes[NextPendingElement()].phase, // Use the phase of the element we will process next
             [this]()
         {
             DoPhasedWorkCallback();
@@ -194,34 +211,147 @@ void Phaser::ValidatePhaseOrdering(int currentPhase, int nextPhase)
     }
 }
 
-void Phaser::SortElements(const winrt::Rect& visibleWindow)
+void Phaser::UpdateVisibleWindow(const winrt::Rect& visibleWindow)
 {
-    // Sort in descending order (inVisibleWindow, phase)
-    std::sort(
-        m_pendingElements.begin(),
-        m_pendingElements.end(),
-        [visibleWindow](const auto& lhs, const auto& rhs)
-    {
-        const auto lhsBounds = lhs.VirtInfo()->ArrangeBounds();
-        const auto lhsIntersects = SharedHelpers::DoRectsIntersect(lhsBounds, visibleWindow);
-        const auto rhsBounds = rhs.VirtInfo()->ArrangeBounds();
-        const auto rhsIntersects = SharedHelpers::DoRectsIntersect(rhsBounds, visibleWindow);
-
-        if ((lhsIntersects && rhsIntersects) ||
-            (!lhsIntersects && !rhsIntersects))
-        {
-            // Both are in the visible window or both are not
-            return lhs.VirtInfo()->Phase() < rhs.VirtInfo()->Phase();
+    if (visibleWindow != m_visibleWindow)
+    {
+        // Any pending element may have moved in or out of view, classify all of them again.
+        m_visibleWindow = visibleWindow;
+        for (int node = 0; node < static_cast<int>(m_nodes.size()); ++node)
+        {
+            if (m_nodes[node].virtInfo)
+            {
+                UpdateIsInVisibleWindow(node);
+            }
         }
-        else if (lhsIntersects)
+    }
+    else
+    {
+        for (const int node : m_unclassifiedNodes)
         {
-            // Left is in visible window
-            return false;
+            // The node may have been removed or reused since, checking it again is harmless.
+            if (node < static_cast<int>(m_nodes.size()) && m_nodes[node].virtInfo)
+            {
+                UpdateIsInVisibleWindow(node);
+            }
+        }
+    }
+
+    m_unclassifiedNodes.clear();
+}
+
+void Phaser::UpdateIsInVisibleWindow(int node)
+{
+    const bool inVisibleWindow = SharedHelpers::DoRectsIntersect(m_visibleWindow, m_nodes[node].virtInfo->ArrangeBounds());
+    if (inVisibleWindow != m_nodes[node].inVisibleWindow)
+    {
+        UnlinkNode(node);
+        m_nodes[node].inVisibleWindow = inVisibleWindow;
+        LinkNode(node, false /* atFront */);
+    }
+}
+
+int Phaser::NextPendingElement() const
+{
+    MUX_ASSERT(m_pendingCount > 0);
+
+    // Phases are small numbers set through x:Phase, so there are only a few buckets to look at.
+    for (auto* buckets : { &m_visibleBuckets, &m_outOfViewBuckets })
+    {
+        for (auto bucket = buckets->rbegin(); bucket != buckets->rend(); ++bucket)
+        {
+            if (bucket->first != -1)
+            {
+                return bucket->first;
+            }
+        }
+    }
+
+    throw winrt::hresult_error(E_FAIL, L"Pending element count is out of sync with the phase buckets.");
+}
+
+void Phaser::LinkNode(int node, bool atFront)
+{
+    auto& pendingElement = m_nodes[node];
+    auto& bucket = GetBucket(pendingElement.phase, pendingElement.inVisibleWindow);
+
+    if (atFront)
+    {
+        pendingElement.previous = -1;
+        pendingElement.next = bucket.first;
+        if (bucket.first != -1)
+        {
+            m_nodes[bucket.first].previous = node;
+        }
+        else
+        {
+            bucket.last = node;
+        }
+        bucket.first = node;
+    }
+    else
+    {
+        pendingElement.previous = bucket.last;
+        pendingElement.next = -1;
+        if (bucket.last != -1)
+        {
+            m_nodes[bucket.last].next = node;
         }
         else
         {
-            return true;
+            bucket.first = node;
         }
+        bucket.last = node;
+    }
+}
+
+void Phaser::UnlinkNode(int node)
+{
+    auto& pendingElement = m_nodes[node];
+    auto& bucket = GetBucket(pendingElement.phase, pendingElement.inVisibleWindow);
+
+    if (pendingElement.previous != -1)
+    {
+        m_nodes[pendingElement.previous].next = pendingElement.next;
     }
-    );
-}
\ No newline at end of file
+    else
+    {
+        bucket.first = pendingElement.next;
+    }
+
+    if (pendingElement.next != -1)
+    {
+        m_nodes[pendingElement.next].previous = pendingElement.previous;
+    }
+    else
+    {
+        bucket.last = pendingElement.previous;
+    }
+
+    pendingElement.previous = -1;
+    pendingElement.next = -1;
+}
+
+void Phaser::RemoveNode(int node)
+{
+    UnlinkNode(node);
+
+    auto& pendingElement = m_nodes[node];
+    pendingElement.virtInfo->PhasingSlot(-1);
+    pendingElement.virtInfo = nullptr;
+    pendingElement.element = nullptr;
+    pendingElement.next = m_firstFreeNode;
+    m_firstFreeNode = node;
+    m_pendingCount--;
+}
+
+Phaser::PhaseBucket& Phaser::GetBucket(int phase, bool inVisibleWindow)
+{
+    MUX_ASSERT(phase > 0);
+    auto& buckets = inVisibleWindow ? m_visibleBuckets : m_outOfViewBuckets;
+    if (phase >= static_cast<int>(buckets.size()))
+    {
+        buckets.resize(phase + 1);
+    }
+    return buckets[phase];
+}
@@ -5,35 +5,56 @@
 
 class ItemsRepeater;
 
-struct ElementInfo
-{
-    ElementInfo(const winrt::UIElement&  element, const winrt::com_ptr<VirtualizationInfo>& virtInfo) :
-        m_element(std::move(element)),
-        m_virtInfo(virtInfo)
-    {}
-
-    winrt::UIElement Element() const { return m_element; }
-    winrt::com_ptr<VirtualizationInfo> VirtInfo() const { return m_virtInfo; }
-private:
-    winrt::UIElement m_element{ nullptr };
-    winrt::com_ptr<VirtualizationInfo> m_virtInfo{ nullptr };
-};
-
 class Phaser final
 {
 public:
     Phaser(ItemsRepeater* owner);
+    ~Phaser();
     void PhaseElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
     void StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
 private:
+    // An element waiting for its next phase. Nodes are linked into the bucket of their phase and get reused
+    // through a free list. The element's VirtualizationInfo knows its node through PhasingSlot.
+    struct PendingElement
+    {
+        winrt::UIElement element{ nullptr };
+        VirtualizationInfo* virtInfo{ nullptr };
+        int phase{ 0 };
+        bool inVisibleWindow{ false };
+        int previous{ -1 };
+        int next{ -1 };
+    };
+
+    // The pending elements of one phase, oldest first.
+    struct PhaseBucket
+    {
+        int first{ -1 };
+        int last{ -1 };
+    };
+
     void DoPhasedWorkCallback();
     void RegisterForCallback();
     void MarkCallbackRecieved();
-    void SortElements(const winrt::Rect& visibleWindow);
+    void UpdateVisibleWindow(const winrt::Rect& visibleWindow);
+    void UpdateIsInVisibleWindow(int node);
+    int NextPendingElement() const;
+    void LinkNode(int node, bool atFront);
+    void UnlinkNode(int node);
+    void RemoveNode(int node);
+    PhaseBucket& GetBucket(int phase, bool inVisibleWindow);
     static void ValidatePhaseOrdering(int currentPhase, int nextPhase);
 
     ItemsRepeater* m_owner{ nullptr };
-    std::vector<ElementInfo> m_pendingElements{};
+    std::vector<PendingElement> m_nodes{};
+    int m_firstFreeNode{ -1 };
+    int m_pendingCount{ 0 };
+    // Indexed by phase. Elements in the visible window get their phases processed first.
+    std::vector<PhaseBucket> m_visibleBuckets{};
+    std::vector<PhaseBucket> m_outOfViewBuckets{};
+    // Elements added since the last callback, they were likely not arranged yet when they got added.
+    std::vector<int> m_unclassifiedNodes{};
+    winrt::Rect m_visibleWindow{};
     bool m_registeredForCallback{ false };
+    uint64_t m_callbackWorkId{ 0 };
 };
@@ -5,6 +5,11 @@
 #include <common.h>
 #include "ItemsRepeater.common.h"
 #include "RecyclePool.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+
+// Trimming runs after phasing so that it does not delay content from showing up.
+static constexpr int c_trimWorkPriority = std::numeric_limits<int>::max() - 1;
 
 #pragma region IRecyclePool
 
@@ -45,23 +50,18 @@ void RecyclePool::PutElementCore(
     winrt::hstring const& key,
     winrt::UIElement const& owner)
 {
+    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(owner);
 
-    const auto& winrtKey = key;
-    auto iterator = m_elements.find(winrtKey);
-    const auto& winrtOwner = owner;
-    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(winrtOwner);
-
-    ElementInfo elementInfo{ this /* refManager */, element, winrtOwnerAsPanel };
+    auto& elements = m_elements[key];
+    elements.emplace_back(this /* refManager */, element, winrtOwnerAsPanel);
 
-    if (iterator != m_elements.end())
-    {
-        iterator->second.emplace_back(std::move(elementInfo));
-    }
-    else
+    // Elements are usually put in the pool while the owner is in the middle of layout, so
+    // evicting here would change the owner's Children while it is being measured or arranged.
+    // Trim on the next BuildTreeScheduler pass instead. Until then TryGetElement hands out the
+    // most recently used elements, which are the ones the trim keeps.
+    if (static_cast<int>(elements.size()) > GetMaxElements(key))
     {
-        std::vector<ElementInfo> pool;
-        pool.emplace_back(elementInfo);
-        m_elements.emplace(winrtKey, std::move(pool));
+        ScheduleTrim();
     }
 }
 
@@ -77,18 +77,19 @@ winrt::UIElement RecyclePool::TryGetElementCore(
         {
             ElementInfo elementInfo{ this /* refManager */, nullptr, nullptr };
             // Prefer an element from the same owner or with no owner so that we don't incur
-            // the enter/leave cost during recycling.
+            // the enter/leave cost during recycling. Search from the most recently used end
+            // so that the least recently used elements are the ones that get trimmed.
             // TODO: prioritize elements with the same owner to those without an owner.
             const auto& winrtOwner = owner;
             auto iter = std::find_if(
-                elements.begin(),
-                elements.end(),
+                elements.rbegin(),
+                elements.rend(),
                 [&winrtOwner](const ElementInfo& elemInfo) { return elemInfo.Owner() == winrtOwner || !elemInfo.Owner(); });
 
-            if (iter != elements.end())
+            if (iter != elements.rend())
             {
                 elementInfo = *iter;
-                elements.erase(iter);
+                elements.erase(std::next(iter).base());
             }
             else
             {
@@ -100,30 +101,133 @@ winrt::UIElement RecyclePool::TryGetElementCore(
             if (elementInfo.Owner() && elementInfo.Owner() != ownerAsPanel)
             {
                 // Element is still under its parent. remove it from its parent.
-                auto panel = elementInfo.Owner();
-                if (panel)
+                if (!RemoveFromOwner(elementInfo))
                 {
-                    unsigned int childIndex = 0;
-                    bool found = panel.Children().IndexOf(elementInfo.Element(), childIndex);
-                    if (!found)
-                    {
-                        throw winrt::hresult_error(E_FAIL, L"ItemsRepeater's child not found in its Children collection.");
-                    }
-
-                    panel.Children().RemoveAt(childIndex);
+                    throw winrt::hresult_error(E_FAIL, L"ItemsRepeater's child not found in its Children collection.");
                 }
             }
 
+            m_hitCount++;
             return elementInfo.Element();
         }
     }
 
+    m_missCount++;
     return nullptr;
 }
 
+#pragma endregion
+
+#pragma region IRecyclePool limits and statistics
+
+int RecyclePool::MaxElementsPerKey()
+{
+    return m_maxElementsPerKey;
+}
+
+void RecyclePool::MaxElementsPerKey(int value)
+{
+    if (value < 0)
+    {
+        throw winrt::hresult_invalid_argument(L"MaxElementsPerKey cannot be negative.");
+    }
+
+    m_maxElementsPerKey = value;
+    for (auto& entry : m_elements)
+    {
+        TrimElements(entry.second, GetMaxElements(entry.first));
+    }
+}
+
+void RecyclePool::SetMaxElementsForKey(winrt::hstring const& key, int maxElements)
+{
+    if (maxElements < 0)
+    {
+        throw winrt::hresult_invalid_argument(L"maxElements cannot be negative.");
+    }
+
+    m_maxElementsForKey[key] = maxElements;
+
+    auto iterator = m_elements.find(key);
+    if (iterator != m_elements.end())
+    {
+        TrimElements(iterator->second, maxElements);
+    }
+}
+
+int RecyclePool::GetElementCount(winrt::hstring const& key)
+{
+    auto iterator = m_elements.find(key);
+    return iterator != m_elements.end() ? static_cast<int>(iterator->second.size()) : 0;
+}
 
 #pragma endregion
 
+void RecyclePool::ScheduleTrim()
+{
+    if (!m_isTrimScheduled)
+    {
+        m_isTrimScheduled = true;
+        auto weakThis = get_weak();
+        BuildTreeScheduler::RegisterWork(
+            c_trimWorkPriority,
+            [weakThis]()
+        {
+            if (auto strongThis = weakThis.get())
+            {
+                strongThis->m_isTrimScheduled = false;
+                for (auto& entry : strongThis->m_elements)
+                {
+                    strongThis->TrimElements(entry.second, strongThis->GetMaxElements(entry.first));
+                }
+            }
+        });
+    }
+}
+
+int RecyclePool::GetMaxElements(const winrt::hstring& key) const
+{
+    auto iterator = m_maxElementsForKey.find(key);
+    return iterator != m_maxElementsForKey.end() ? iterator->second : m_maxElementsPerKey;
+}
+
+void RecyclePool::TrimElements(std::vector<ElementInfo>& elements, int maxElements)
+{
+    const int excess = static_cast<int>(elements.size()) - maxElements;
+    if (excess > 0)
+    {
+        // Evict the least recently used elements. An evicted element that is still parented
+        // to its owner (e.g. an ItemsRepeater keeps recycled elements as children) has to be
+        // removed from it as well, otherwise the owner would keep it alive.
+        const auto evictEnd = elements.begin() + excess;
+        for (auto it = elements.begin(); it != evictEnd; ++it)
+        {
+            RemoveFromOwner(*it);
+        }
+
+        elements.erase(elements.begin(), evictEnd);
+        m_evictionCount += excess;
+    }
+}
+
+/* static */
+bool RecyclePool::RemoveFromOwner(const ElementInfo& elementInfo)
+{
+    if (auto panel = elementInfo.Owner())
+    {
+        unsigned int childIndex = 0;
+        if (panel.Children().IndexOf(elementInfo.Element(), childIndex))
+        {
+            panel.Children().RemoveAt(childIndex);
+            return true;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
 winrt::Panel RecyclePool::EnsureOwnerIsPanelOrNull(const winrt::UIElement& owner)
 {
     winrt::Panel ownerAsPanel = nullptr;
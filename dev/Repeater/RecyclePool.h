@@ -34,6 +34,17 @@ public:
         winrt::UIElement const& owner);
 #pragma endregion
 
+#pragma region IRecyclePool limits and statistics
+    int MaxElementsPerKey();
+    void MaxElementsPerKey(int value);
+    void SetMaxElementsForKey(winrt::hstring const& key, int maxElements);
+    int GetElementCount(winrt::hstring const& key);
+
+    unsigned int HitCount() { return m_hitCount; }
+    unsigned int MissCount() { return m_missCount; }
+    unsigned int EvictionCount() { return m_evictionCount; }
+#pragma endregion
+
 #pragma region IRecyclePoolStatics 
     static winrt::DependencyProperty ReuseKeyProperty() { return s_reuseKeyProperty; }
     static winrt::hstring GetReuseKey(winrt::UIElement const& element);
@@ -70,5 +81,22 @@ private:
         tracker_ref<winrt::Panel> m_owner;
     };
 
-    std::map<winrt::hstring /*key*/, std::vector<ElementInfo>> m_elements;
+    void ScheduleTrim();
+    int GetMaxElements(const winrt::hstring& key) const;
+    void TrimElements(std::vector<ElementInfo>& elements, int maxElements);
+    static bool RemoveFromOwner(const ElementInfo& elementInfo);
+
+    // Elements for a key are kept in the order they were put in the pool, so the
+    // least recently used ones are at the front.
+    std::unordered_map<winrt::hstring /*key*/, std::vector<ElementInfo>> m_elements;
+
+    // By default a key can hold any number of elements.
+    int m_maxElementsPerKey{ std::numeric_limits<int>::max() };
+    std::unordered_map<winrt::hstring /*key*/, int> m_maxElementsForKey;
+
+    unsigned int m_hitCount{ 0 };
+    unsigned int m_missCount{ 0 };
+    unsigned int m_evictionCount{ 0 };
+
+    bool m_isTrimScheduled{ false };
 };
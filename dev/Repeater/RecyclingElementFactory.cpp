@@ -9,6 +9,12 @@
 #include "RecyclingElementFactory.h"
 #include "ItemsRepeater.h"
 #include "RecyclePool.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "RepeaterLayoutMetrics.h"
+
+// Prewarming only runs once all other scheduled work (e.g. phasing) is done.
+static constexpr int c_prewarmWorkPriority = std::numeric_limits<int>::max();
 
 CppWinRTActivatableClassWithBasicFactory(RecyclingElementFactory);
 
@@ -49,8 +55,69 @@ void RecyclingElementFactory::SelectTemplateKey(winrt::event_token const& token)
     m_selectTemplateKeyEventSource.remove(token);
 }
 
+// Creates count elements from the template with the given key and puts them in the recycle pool
+// so that later GetElement calls don't have to create them. The elements are created as
+// scheduled work in between frames, a few at a time within the frame budget.
+void RecyclingElementFactory::PrewarmElements(winrt::hstring const& templateKey, int count)
+{
+    if (!m_recyclePool)
+    {
+        throw winrt::hresult_error(E_FAIL, L"RecyclePool property cannot be null.");
+    }
+
+    if (!m_templates || !m_templates.get().HasKey(templateKey))
+    {
+        std::wstring message = L"No templates of key " + std::wstring(templateKey.data()) + L" were found in the templates collection.";
+        throw winrt::hresult_error(E_FAIL, message.c_str());
+    }
+
+    if (count > 0)
+    {
+        RegisterPrewarmWork(templateKey, count);
+    }
+}
+
 #pragma endregion
 
+void RecyclingElementFactory::RegisterPrewarmWork(winrt::hstring const& templateKey, int count)
+{
+    auto weakThis = get_weak();
+    BuildTreeScheduler::RegisterWork(
+        c_prewarmWorkPriority,
+        [weakThis, templateKey, count]()
+    {
+        if (auto strongThis = weakThis.get())
+        {
+            strongThis->DoPrewarmWork(templateKey, count);
+        }
+    });
+}
+
+void RecyclingElementFactory::DoPrewarmWork(winrt::hstring const& templateKey, int count)
+{
+    // The templates or the pool could have changed since the work was registered.
+    auto recyclePool = m_recyclePool.get();
+    auto templates = m_templates.get();
+    if (!recyclePool || !templates || !templates.HasKey(templateKey))
+    {
+        return;
+    }
+
+    auto dataTemplate = templates.Lookup(templateKey);
+    int remaining = count;
+    do
+    {
+        auto element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+        RecyclePool::SetReuseKey(element, templateKey);
+        recyclePool.PutElement(element, templateKey);
+    } while (--remaining > 0 && !BuildTreeScheduler::ShouldYield());
+
+    if (remaining > 0)
+    {
+        RegisterPrewarmWork(templateKey, remaining);
+    }
+}
+
 #pragma region IRecyclingElementFactoryOverrides
 
 winrt::hstring RecyclingElementFactory::OnSelectTemplateKeyCore(
@@ -116,7 +183,10 @@ winrt::UIElement RecyclingElementFactory::GetElementCore(winrt::ElementFactoryGe
         }
 
         auto dataTemplate = m_templates.get().Lookup(templateKey);
-        element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+        {
+            RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::TemplateInstantiation);
+            element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+        }
 
         // Associate ReuseKey with element
         RecyclePool::SetReuseKey(element, templateKey);
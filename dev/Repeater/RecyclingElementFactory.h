@@ -21,6 +21,8 @@ public:
 
     winrt::event_token SelectTemplateKey(winrt::TypedEventHandler<winrt::RecyclingElementFactory, winrt::SelectTemplateEventArgs> const& value);
     void SelectTemplateKey(winrt::event_token const& token);
+
+    void PrewarmElements(winrt::hstring const& templateKey, int count);
 #pragma endregion
 
 #pragma region IRecyclingElementFactoryOverrides
@@ -33,6 +35,9 @@ public:
 #pragma endregion
 
 private:
+    void RegisterPrewarmWork(winrt::hstring const& templateKey, int count);
+    void DoPrewarmWork(winrt::hstring const& templateKey, int count);
+
     tracker_ref<winrt::RecyclePool> m_recyclePool{ this };
     tracker_ref<winrt::IMap<winrt::hstring, winrt::DataTemplate>> m_templates{ this };
     tracker_ref<winrt::SelectTemplateEventArgs> m_args{ this };
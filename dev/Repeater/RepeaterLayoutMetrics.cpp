@@ -0,0 +1,40 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "RepeaterLayoutMetrics.h"
+
+thread_local bool RepeaterLayoutMetrics::s_isEnabled{ false };
+thread_local std::array<int, static_cast<size_t>(RepeaterLayoutCounter::Count)> RepeaterLayoutMetrics::s_counters{};
+thread_local std::array<RepeaterLayoutMetrics::SpanTicks, static_cast<size_t>(RepeaterLayoutSpan::Count)> RepeaterLayoutMetrics::s_spans{};
+
+/* static */
+void RepeaterLayoutMetrics::Reset()
+{
+    s_counters.fill(0);
+    s_spans.fill({});
+}
+
+/* static */
+RepeaterLayoutSpanStats RepeaterLayoutMetrics::SpanStats(RepeaterLayoutSpan span)
+{
+    static const double s_ticksPerMs = []()
+    {
+        LARGE_INTEGER frequency{};
+        QueryPerformanceFrequency(&frequency);
+        return static_cast<double>(frequency.QuadPart) / 1000.0;
+    }();
+
+    const auto& ticks = s_spans[static_cast<size_t>(span)];
+    return { ticks.count, static_cast<double>(ticks.total) / s_ticksPerMs, static_cast<double>(ticks.max) / s_ticksPerMs };
+}
+
+/* static */
+void RepeaterLayoutMetrics::AddSpan(RepeaterLayoutSpan span, int64_t ticks)
+{
+    auto& spanTicks = s_spans[static_cast<size_t>(span)];
+    ++spanTicks.count;
+    spanTicks.total += ticks;
+    spanTicks.max = std::max(spanTicks.max, ticks);
+}
@@ -0,0 +1,107 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Keep in sync with RepeaterLayoutSpan in RepeaterTestHooks.idl.
+enum class RepeaterLayoutSpan
+{
+    Measure = 0,
+    Generate = 1,
+    GetElementFromElementFactory = 2,
+    GetElementFromPinnedPool = 3,
+    GetElementFromUniqueIdResetPool = 4,
+    TemplateInstantiation = 5,
+    PhaserPass = 6,
+    Count
+};
+
+enum class RepeaterLayoutCounter
+{
+    // Elements handed out by the element factory, whether they were created or reused.
+    ElementsRealized,
+    // The subset of ElementsRealized that came out of a recycle pool instead of being created.
+    ElementsRecycled,
+    ElementsMeasured,
+    ReflowPasses,
+    AnchorChanges,
+    Count
+};
+
+struct RepeaterLayoutSpanStats
+{
+    int count{ 0 };
+    double totalInMs{ 0.0 };
+    double maxInMs{ 0.0 };
+};
+
+// Per thread timing spans and counters for the ItemsRepeater layout pipeline. Spans are inclusive,
+// for example Measure includes the Generate and GetElement spans that run during it.
+// Nothing is recorded unless it is enabled.
+class RepeaterLayoutMetrics final
+{
+public:
+    static bool IsEnabled() { return s_isEnabled; }
+    static void IsEnabled(bool value) { s_isEnabled = value; }
+    static void Reset();
+
+    static void Increment(RepeaterLayoutCounter counter)
+    {
+        if (s_isEnabled)
+        {
+            ++s_counters[static_cast<size_t>(counter)];
+        }
+    }
+
+    static int Counter(RepeaterLayoutCounter counter) { return s_counters[static_cast<size_t>(counter)]; }
+    static RepeaterLayoutSpanStats SpanStats(RepeaterLayoutSpan span);
+
+private:
+    friend class RepeaterLayoutTimingSpan;
+
+    struct SpanTicks
+    {
+        int count{ 0 };
+        int64_t total{ 0 };
+        int64_t max{ 0 };
+    };
+
+    static void AddSpan(RepeaterLayoutSpan span, int64_t ticks);
+
+    static thread_local bool s_isEnabled;
+    static thread_local std::array<int, static_cast<size_t>(RepeaterLayoutCounter::Count)> s_counters;
+    static thread_local std::array<SpanTicks, static_cast<size_t>(RepeaterLayoutSpan::Count)> s_spans;
+};
+
+// Adds the time spent in the enclosing scope to a RepeaterLayoutMetrics span.
+class RepeaterLayoutTimingSpan final
+{
+public:
+    explicit RepeaterLayoutTimingSpan(RepeaterLayoutSpan span) :
+        m_span(span),
+        m_isTiming(RepeaterLayoutMetrics::IsEnabled())
+    {
+        if (m_isTiming)
+        {
+            QueryPerformanceCounter(&m_start);
+        }
+    }
+
+    ~RepeaterLayoutTimingSpan()
+    {
+        if (m_isTiming)
+        {
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            RepeaterLayoutMetrics::AddSpan(m_span, now.QuadPart - m_start.QuadPart);
+        }
+    }
+
+    RepeaterLayoutTimingSpan(const RepeaterLayoutTimingSpan&) = delete;
+    RepeaterLayoutTimingSpan& operator=(const RepeaterLayoutTimingSpan&) = delete;
+
+private:
+    RepeaterLayoutSpan m_span;
+    bool m_isTiming;
+    LARGE_INTEGER m_start{};
+};
@@ -7,6 +7,10 @@
 #include "layout.h"
 #include "ElementFactoryGetArgs.h"
 #include "ElementFactoryRecycleArgs.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "ItemsRepeater.h"
+#include "RepeaterLayoutMetrics.h"
 
 
 winrt::event_token RepeaterTestHooks::BuildTreeCompletedImpl(
@@ -67,4 +71,89 @@ void RepeaterTestHooks::SetLayoutId(winrt::IInspectable const& layout, const hst
     {
         instance->LayoutId(id);
     }
-}
\ No newline at end of file
+}
+
+/* static */
+uint64_t RepeaterTestHooks::RegisterBuildTreeWork(int priority, winrt::TypedEventHandler<winrt::IInspectable, winrt::IInspectable> const& work)
+{
+    return BuildTreeScheduler::RegisterWork(
+        priority,
+        [work]()
+    {
+        work(nullptr, nullptr);
+    });
+}
+
+/* static */
+void RepeaterTestHooks::CancelBuildTreeWork(uint64_t workId)
+{
+    BuildTreeScheduler::CancelWork(workId);
+}
+
+/* static */
+void RepeaterTestHooks::SetBuildTreeSchedulerManualClock(bool enabled)
+{
+    BuildTreeScheduler::UseManualClock(enabled);
+}
+
+/* static */
+void RepeaterTestHooks::AdvanceBuildTreeSchedulerManualClock(double milliseconds)
+{
+    BuildTreeScheduler::AdvanceManualClock(milliseconds);
+}
+
+/* static */
+void RepeaterTestHooks::RunBuildTreeSchedulerFrame()
+{
+    BuildTreeScheduler::RunFrame();
+}
+
+/* static */
+winrt::BuildTreeSchedulerFrameStats RepeaterTestHooks::GetBuildTreeSchedulerLastFrameStats()
+{
+    const auto stats = BuildTreeScheduler::LastFrameStats();
+    return { stats.jobsRun, stats.timeUsedInMs, stats.jobsDeferred, stats.budgetInMs };
+}
+
+/* static */
+winrt::RealizationBufferStats RepeaterTestHooks::GetRealizationBufferStats(winrt::ItemsRepeater const& repeater)
+{
+    const auto instance = winrt::get_self<ItemsRepeater>(repeater);
+    return { instance->RealizationBufferHits(), instance->RealizationBufferMisses() };
+}
+
+/* static */
+void RepeaterTestHooks::ResetRealizationBufferStats(winrt::ItemsRepeater const& repeater)
+{
+    winrt::get_self<ItemsRepeater>(repeater)->ResetRealizationBufferStats();
+}
+
+/* static */
+void RepeaterTestHooks::SetLayoutMetricsEnabled(bool enabled)
+{
+    RepeaterLayoutMetrics::IsEnabled(enabled);
+}
+
+/* static */
+void RepeaterTestHooks::ResetLayoutMetrics()
+{
+    RepeaterLayoutMetrics::Reset();
+}
+
+/* static */
+winrt::RepeaterLayoutSpanStats RepeaterTestHooks::GetLayoutSpanStats(winrt::RepeaterLayoutSpan const& span)
+{
+    const auto stats = RepeaterLayoutMetrics::SpanStats(static_cast<::RepeaterLayoutSpan>(span));
+    return { stats.count, stats.totalInMs, stats.maxInMs };
+}
+
+/* static */
+winrt::RepeaterLayoutCounters RepeaterTestHooks::GetLayoutCounters()
+{
+    return {
+        RepeaterLayoutMetrics::Counter(RepeaterLayoutCounter::ElementsRealized),
+        RepeaterLayoutMetrics::Counter(RepeaterLayoutCounter::ElementsRecycled),
+        RepeaterLayoutMetrics::Counter(RepeaterLayoutCounter::ElementsMeasured),
+        RepeaterLayoutMetrics::Counter(RepeaterLayoutCounter::ReflowPasses),
+        RepeaterLayoutMetrics::Counter(RepeaterLayoutCounter::AnchorChanges) };
+}
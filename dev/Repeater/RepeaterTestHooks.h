@@ -30,6 +30,21 @@ public:
     static hstring GetLayoutId(winrt::IInspectable const& layout);
     static void SetLayoutId(winrt::IInspectable const& layout, const hstring& id);
 
+    static uint64_t RegisterBuildTreeWork(int priority, winrt::TypedEventHandler<winrt::IInspectable, winrt::IInspectable> const& work);
+    static void CancelBuildTreeWork(uint64_t workId);
+    static void SetBuildTreeSchedulerManualClock(bool enabled);
+    static void AdvanceBuildTreeSchedulerManualClock(double milliseconds);
+    static void RunBuildTreeSchedulerFrame();
+    static winrt::BuildTreeSchedulerFrameStats GetBuildTreeSchedulerLastFrameStats();
+
+    static winrt::RealizationBufferStats GetRealizationBufferStats(winrt::ItemsRepeater const& repeater);
+    static void ResetRealizationBufferStats(winrt::ItemsRepeater const& repeater);
+
+    static void SetLayoutMetricsEnabled(bool enabled);
+    static void ResetLayoutMetrics();
+    static winrt::RepeaterLayoutSpanStats GetLayoutSpanStats(winrt::RepeaterLayoutSpan const& span);
+    static winrt::RepeaterLayoutCounters GetLayoutCounters();
+
 private:
     static RepeaterTestHooks* s_testHooks;
 
@@ -208,7 +208,7 @@ winrt::IVectorView<winrt::IInspectable> SelectionModel::SelectedItems()
                     unsigned int currentCount = node->SelectedCount();
                     if (index >= currentIndex && index < currentIndex + currentCount)
                     {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
+                        int targetIndex = node->SelectedIndexAt(index - currentIndex);
                         item = node->ItemsSourceView().GetAt(targetIndex);
                         break;
                     }
@@ -263,7 +263,7 @@ winrt::IVectorView<winrt::IndexPath> SelectionModel::SelectedIndices()
                     unsigned int currentCount = node->SelectedCount();
                     if (index >= currentIndex && index < currentIndex + currentCount)
                     {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
+                        int targetIndex = node->SelectedIndexAt(index - currentIndex);
                         path = winrt::get_self<IndexPath>(info.Path)->CloneWithChildIndex(targetIndex);
                         break;
                     }
@@ -169,17 +169,10 @@ int SelectionNode::SelectedCount()
 
 bool SelectionNode::IsSelected(int index)
 {
-    bool isSelected = false;
-    for (auto& range : m_selected)
-    {
-        if (range.Contains(index))
-        {
-            isSelected = true;
-            break;
-        }
-    }
-
-    return isSelected;
+    // m_selected is sorted and non-overlapping, so only the first range ending
+    // at or after index can contain it.
+    const auto it = FirstRangeEndingAtOrAfter(index);
+    return it != m_selected.end() && it->Contains(index);
 }
 
 // True  -> Selected
@@ -232,7 +225,7 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial(int index)
 
 int SelectionNode::SelectedIndex()
 {
-    return SelectedCount() > 0 ? SelectedIndices().at(0) : -1;
+    return SelectedCount() > 0 ? m_selected.front().Begin() : -1;
 }
 
 void SelectionNode::SelectedIndex(int value)
@@ -250,26 +243,37 @@ void SelectionNode::SelectedIndex(int value)
 
 std::vector<int> SelectionNode::SelectedIndices()
 {
-    if (!m_selectedIndicesCacheIsValid)
+    // The ranges are already sorted and non-overlapping so they can be expanded
+    // as-is. Callers that only need a few indices should use SelectedIndexAt.
+    std::vector<int> selectedIndices;
+    selectedIndices.reserve(m_selectedCount);
+    for (auto& range : m_selected)
     {
-        m_selectedIndicesCacheIsValid = true;
-        for (auto& range : m_selected)
+        for (int index = range.Begin(); index <= range.End(); index++)
         {
-            for (int index = range.Begin(); index <= range.End(); index++)
-            {
-                // Avoid duplicates
-                if (std::find(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end(), index) == m_selectedIndicesCached.end())
-                {
-                    m_selectedIndicesCached.emplace_back(index);
-                }
-            }
+            selectedIndices.emplace_back(index);
         }
+    }
 
-        // Sort the list for easy consumption
-        std::sort(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end());
+    return selectedIndices;
+}
+
+// Returns the position-th selected index in ascending order without expanding
+// the selected ranges.
+int SelectionNode::SelectedIndexAt(int position)
+{
+    if (position < 0 || position >= m_selectedCount)
+    {
+        throw winrt::hresult_out_of_bounds();
     }
 
-    return m_selectedIndicesCached;
+    EnsureSelectedRangeOffsets();
+
+    // m_selectedRangeOffsets[i] is the number of selected indices before m_selected[i].
+    // The range holding position is the last one whose offset is <= position.
+    const auto it = std::upper_bound(m_selectedRangeOffsets.begin(), m_selectedRangeOffsets.end(), position) - 1;
+    const auto& range = m_selected[it - m_selectedRangeOffsets.begin()];
+    return range.Begin() + (position - *it);
 }
 
 bool SelectionNode::Select(int index, bool select)
@@ -336,24 +340,57 @@ bool SelectionNode::IsValidIndex(int index)
     return (ItemsSourceView() == nullptr || (index >= 0 && index < ItemsSourceView().Count()));
 }
 
-void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged)
+std::vector<IndexRange>::iterator SelectionNode::FirstRangeEndingAtOrAfter(int index)
 {
-    // TODO: Check for duplicates (Task 14107720)
-    // TODO: Optimize by merging adjacent ranges (Task 14107720)
-
-    int oldCount = SelectedCount();
+    return std::lower_bound(m_selected.begin(), m_selected.end(), index,
+        [](const IndexRange& range, int value) { return range.End() < value; });
+}
 
-    for (int i = addRange.Begin(); i <= addRange.End(); i++)
+void SelectionNode::EnsureSelectedRangeOffsets()
+{
+    if (!m_selectedRangeOffsetsAreValid)
     {
-        if (!IsSelected(i))
+        m_selectedRangeOffsets.clear();
+        m_selectedRangeOffsets.reserve(m_selected.size());
+
+        int offset = 0;
+        for (auto& range : m_selected)
         {
-            m_selectedCount++;
+            m_selectedRangeOffsets.emplace_back(offset);
+            offset += range.End() - range.Begin() + 1;
         }
+
+        MUX_ASSERT(offset == m_selectedCount);
+        m_selectedRangeOffsetsAreValid = true;
+    }
+}
+
+void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged)
+{
+    // m_selected is kept sorted, non-overlapping and with adjacent ranges merged.
+    // Find every range that overlaps or touches addRange and replace them with
+    // their union.
+    int begin = addRange.Begin();
+    int end = addRange.End();
+    int alreadySelectedCount = 0;
+
+    const auto first = FirstRangeEndingAtOrAfter(begin - 1);
+    auto last = first;
+    while (last != m_selected.end() && last->Begin() <= addRange.End() + 1)
+    {
+        alreadySelectedCount += std::max(0, std::min(last->End(), addRange.End()) - std::max(last->Begin(), addRange.Begin()) + 1);
+        begin = std::min(begin, last->Begin());
+        end = std::max(end, last->End());
+        ++last;
     }
 
-    if (oldCount != m_selectedCount)
+    const int addedCount = (addRange.End() - addRange.Begin() + 1) - alreadySelectedCount;
+    if (addedCount > 0)
     {
-        m_selected.emplace_back(addRange);
+        m_selectedCount += addedCount;
+        const auto insertAt = m_selected.erase(first, last);
+        m_selected.emplace(insertAt, begin, end);
+        m_selectedRangeOffsetsAreValid = false;
 
         if (raiseOnSelectionChanged)
         {
@@ -364,79 +401,38 @@ void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionCh
 
 void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged)
 {
-    int oldCount = m_selectedCount;
-
-    // TODO: Prevent overlap of Ranges in _selected (Task 14107720)
-    for (int i = removeRange.Begin(); i <= removeRange.End(); i++)
+    const auto first = FirstRangeEndingAtOrAfter(removeRange.Begin());
+    auto last = first;
+    int removedCount = 0;
+    while (last != m_selected.end() && last->Begin() <= removeRange.End())
     {
-        if (IsSelected(i))
-        {
-            m_selectedCount--;
-        }
+        removedCount += std::min(last->End(), removeRange.End()) - std::max(last->Begin(), removeRange.Begin()) + 1;
+        ++last;
     }
 
-    if (oldCount != m_selectedCount)
+    if (removedCount > 0)
     {
-        // Build up a both a list of Ranges to remove and ranges to add
-        std::vector<IndexRange> toRemove;
-        std::vector<IndexRange> toAdd;
-
-        for (IndexRange& range : m_selected)
+        // Only the first and last intersecting ranges can stick out of removeRange,
+        // keep whatever is left of them on either side.
+        std::vector<IndexRange> remaining;
+        if (first->Begin() < removeRange.Begin())
         {
-            // If this range intersects the remove range, we have to do something
-            if (removeRange.Intersects(range))
-            {
-                IndexRange before(-1, -1);
-                IndexRange cut(-1, -1);
-                IndexRange after(-1, -1);
-
-                // Intersection with the beginning of the range
-                //  Anything to the left of the point (exclusive) stays
-                //  Anything to the right of the point (inclusive) gets clipped
-                if (range.Contains(removeRange.Begin() - 1))
-                {
-                    range.Split(removeRange.Begin() - 1, before, cut);
-                    toAdd.emplace_back(before);
-                }
-
-                // Intersection with the end of the range
-                //  Anything to the left of the point (inclusive) gets clipped
-                //  Anything to the right of the point (exclusive) stays
-                if (range.Contains(removeRange.End()))
-                {
-                    if (range.Split(removeRange.End(), cut, after))
-                    {
-                        toAdd.emplace_back(after);
-                    }
-                }
-
-                // Remove this Range from the collection
-                // New ranges will be added for any remaining subsections
-                toRemove.emplace_back(range);
-            }
+            remaining.emplace_back(first->Begin(), removeRange.Begin() - 1);
         }
 
-        bool change = ((toRemove.size() > 0) || (toAdd.size() > 0));
-
-        if (change)
+        if ((last - 1)->End() > removeRange.End())
         {
-            // Remove tagged ranges
-            for (IndexRange& remove : toRemove)
-            {
-                auto iter = std::find(m_selected.begin(), m_selected.end(), remove);
-                m_selected.erase(iter);
-            }
+            remaining.emplace_back(removeRange.End() + 1, (last - 1)->End());
+        }
 
-            // Add new ranges
-            for (IndexRange& add : toAdd)
-            {
-                m_selected.emplace_back(add);
-            }
+        const auto insertAt = m_selected.erase(first, last);
+        m_selected.insert(insertAt, remaining.begin(), remaining.end());
+        m_selectedCount -= removedCount;
+        m_selectedRangeOffsetsAreValid = false;
 
-            if (raiseOnSelectionChanged)
-            {
-                OnSelectionChanged();
-            }
+        if (raiseOnSelectionChanged)
+        {
+            OnSelectionChanged();
         }
     }
 }
@@ -447,6 +443,7 @@ void SelectionNode::ClearSelection()
     if (m_selected.size() > 0)
     {
         m_selected.clear();
+        m_selectedRangeOffsetsAreValid = false;
         OnSelectionChanged();
     }
 
@@ -528,39 +525,27 @@ void SelectionNode::OnSourceListChanged(const winrt::IInspectable& dataSource, c
 bool SelectionNode::OnItemsAdded(int index, int count)
 {
     bool selectionInvalidated = false;
-    // Update ranges for leaf items
-    std::vector<IndexRange> toAdd;
-    for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
+    // Update ranges for leaf items. Every range ending at or after index needs to
+    // shift right, only the first of them can straddle the insertion point.
+    auto it = FirstRangeEndingAtOrAfter(index);
+    if (it != m_selected.end())
     {
-        auto range = m_selected[i];
-
-        // The range is after the inserted items, need to shift the range right
-        if (range.End() >= index)
+        if (it->Contains(index - 1))
         {
-            int begin = range.Begin();
-            // If the index left of newIndex is inside the range,
-            // Split the range and remember the left piece to add later
-            if (range.Contains(index - 1))
-            {
-                IndexRange before(-1, -1), after(-1, -1);
-                range.Split(index - 1, before, after);
-                toAdd.emplace_back(before);
-                begin = index;
-            }
-
-            // Shift the range to the right
-            m_selected[i] = IndexRange(begin + count, range.End() + count);
-            selectionInvalidated = true;
+            // Split the range and keep the left piece where it is
+            IndexRange before(-1, -1), after(-1, -1);
+            it->Split(index - 1, before, after);
+            *it = after;
+            it = m_selected.insert(it, before) + 1;
         }
-    }
 
-    if (toAdd.size() > 0)
-    {
-        // Add the left sides of the split ranges
-        for (auto& add : toAdd)
+        for (; it != m_selected.end(); ++it)
         {
-            m_selected.emplace_back(add);
+            *it = IndexRange(it->Begin() + count, it->End() + count);
         }
+
+        m_selectedRangeOffsetsAreValid = false;
+        selectionInvalidated = true;
     }
 
     // Update for non-leaf if we are tracking non-leaf nodes
@@ -609,35 +594,34 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     // Remove the items from the selection for leaf
     if (ItemsSourceView().Count() > 0)
     {
-        bool isSelected = false;
-        for (int i = index; i <= index + count - 1; i++)
+        const int oldSelectedCount = m_selectedCount;
+        RemoveRange(IndexRange(index, index + count - 1), false /* raiseOnSelectionChanged */);
+        if (oldSelectedCount != m_selectedCount)
         {
-            if (IsSelected(i))
-            {
-                isSelected = true;
-                break;
-            }
-        }
-
-        if (isSelected)
-        {
-            RemoveRange(IndexRange(index, index + count - 1), false /* raiseOnSelectionChanged */);
             selectionInvalidated = true;
         }
 
-        for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
+        // Every range after the removed items needs to shift left
+        auto it = FirstRangeEndingAtOrAfter(index);
+        if (it != m_selected.end())
         {
-            auto range = m_selected[i];
+            MUX_ASSERT(!it->Contains(index));
 
-            // The range is after the removed items, need to shift the range left
-            if (range.End() > index)
+            for (auto shift = it; shift != m_selected.end(); ++shift)
             {
-                MUX_ASSERT(!range.Contains(index));
+                *shift = IndexRange(shift->Begin() - count, shift->End() - count);
+            }
 
-                // Shift the range to the left
-                m_selected[i] = IndexRange(range.Begin() - count, range.End() - count);
-                selectionInvalidated = true;
+            // Closing the gap can make the range before the removed items adjacent
+            // to the first shifted one, merge them so the ranges stay canonical.
+            if (it != m_selected.begin() && (it - 1)->End() + 1 == it->Begin())
+            {
+                *(it - 1) = IndexRange((it - 1)->Begin(), it->End());
+                m_selected.erase(it);
             }
+
+            m_selectedRangeOffsetsAreValid = false;
+            selectionInvalidated = true;
         }
 
         // Update for non-leaf if we are tracking non-leaf nodes
@@ -694,8 +678,7 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
 
 void SelectionNode::OnSelectionChanged()
 {
-    m_selectedIndicesCacheIsValid = false;
-    m_selectedIndicesCached.clear();
+    m_selectedRangeOffsetsAreValid = false;
 }
 
 /* static */
@@ -41,6 +41,7 @@ public:
     int SelectedIndex();
     void SelectedIndex(int value);
     std::vector<int> SelectedIndices();
+    int SelectedIndexAt(int position);
     bool Select(int index, bool select);
     bool ToggleSelect(int index);
     void SelectAll();
@@ -54,6 +55,8 @@ private:
     void HookupCollectionChangedHandler();
     void UnhookCollectionChangedHandler();
     bool IsValidIndex(int index);
+    std::vector<IndexRange>::iterator FirstRangeEndingAtOrAfter(int index);
+    void EnsureSelectedRangeOffsets();
     void AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged);
     void RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged);
     void ClearSelection();
@@ -74,6 +77,7 @@ private:
     SelectionNode* m_parent { nullptr };
 
     // For parents of leaf nodes (any node whose children are not data sources)
+    // Sorted by Begin(), non-overlapping and with adjacent ranges merged.
     std::vector<IndexRange> m_selected;
     
     tracker_ref<winrt::IInspectable> m_source;
@@ -81,8 +85,10 @@ private:
     winrt::ItemsSourceView::CollectionChanged_revoker m_itemsSourceViewChanged{};
 
     int m_selectedCount{ 0 };
-    std::vector<int> m_selectedIndicesCached;
-    bool m_selectedIndicesCacheIsValid = false;
+    // Number of selected indices before each range in m_selected, used to answer
+    // SelectedIndexAt with a binary search.
+    std::vector<int> m_selectedRangeOffsets;
+    bool m_selectedRangeOffsetsAreValid = false;
     int m_anchorIndex{ -1 };
     int m_realizedChildrenNodeCount{ 0 };
 };
@@ -90,6 +90,12 @@ void StackLayout::OnItemsChangedCore(
     winrt::IInspectable const& source,
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
+    auto& measuredSizeIndex = GetAsStackState(context.LayoutState())->MeasuredSizeIndex();
+    if (measuredSizeIndex.Count() > 0)
+    {
+        measuredSizeIndex.OnItemsSourceChanged(args);
+    }
+
     GetFlowAlgorithm(context).OnItemsSourceChanged(source, args, context);
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
@@ -116,8 +122,13 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
         const auto lastExtent = state->FlowAlgorithm().LastExtent();
 
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
+        const auto measuredSizeIndex = GetMeasuredSizeIndex(context, state);
+        const double estimatedElementSize = measuredSizeIndex ? GetEstimatedElementSize(*measuredSizeIndex, averageElementSize - m_itemSpacing) : 0.0;
         const double realizationWindowOffsetInExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - m_itemSpacing) : lastExtent.*MajorSize();
+        const double estimatedMajorSize = measuredSizeIndex ?
+            measuredSizeIndex->OffsetOf(itemsCount, estimatedElementSize, m_itemSpacing) - m_itemSpacing :
+            averageElementSize * itemsCount - m_itemSpacing;
+        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, estimatedMajorSize) : lastExtent.*MajorSize();
         if (itemsCount > 0 &&
             realizationRect.*MajorSize() >= 0 &&
             // MajorSize = 0 will account for when a nested repeater is outside the realization rect but still being measured. Also,
@@ -126,9 +137,17 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
             // in the navigating direction.
             realizationWindowOffsetInExtent + realizationRect.*MajorSize() >= 0 && realizationWindowOffsetInExtent <= majorSize)
         {
-            anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
-            offset = anchorIndex * averageElementSize + lastExtent.*MajorStart();
-            anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
+            if (measuredSizeIndex)
+            {
+                anchorIndex = measuredSizeIndex->IndexAt(realizationWindowOffsetInExtent, estimatedElementSize, m_itemSpacing);
+                offset = measuredSizeIndex->OffsetOf(anchorIndex, estimatedElementSize, m_itemSpacing) + lastExtent.*MajorStart();
+            }
+            else
+            {
+                anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
+                offset = anchorIndex * averageElementSize + lastExtent.*MajorStart();
+                anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
+            }
         }
     }
 
@@ -153,17 +172,32 @@ winrt::Rect StackLayout::GetExtent(
     const int itemsCount = context.ItemCount();
     const auto stackState = GetAsStackState(context.LayoutState());
     const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + m_itemSpacing;
+    const auto measuredSizeIndex = GetMeasuredSizeIndex(context, stackState);
+    const double estimatedElementSize = measuredSizeIndex ? GetEstimatedElementSize(*measuredSizeIndex, averageElementSize - m_itemSpacing) : 0.0;
+    // Size of all the items including the spacing after each one of them.
+    const double totalSize = measuredSizeIndex ?
+        measuredSizeIndex->OffsetOf(itemsCount, estimatedElementSize, m_itemSpacing) :
+        itemsCount * averageElementSize;
 
     extent.*MinorSize() = static_cast<float>(stackState->MaxArrangeBounds());
-    extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    extent.*MajorSize() = std::max(0.0f, static_cast<float>(totalSize - m_itemSpacing));
     if (itemsCount > 0)
     {
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - firstRealizedItemIndex * averageElementSize);
-            auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            if (measuredSizeIndex)
+            {
+                extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - measuredSizeIndex->OffsetOf(firstRealizedItemIndex, estimatedElementSize, m_itemSpacing));
+                const double remainingSize = totalSize - measuredSizeIndex->OffsetOf(lastRealizedItemIndex + 1, estimatedElementSize, m_itemSpacing);
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingSize);
+            }
+            else
+            {
+                extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - firstRealizedItemIndex * averageElementSize);
+                auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            }
         }
         else
         {
@@ -203,6 +237,11 @@ void StackLayout::OnElementMeasured(
             index,
             provisionalArrangeSizeWinRt.*Major(),
             provisionalArrangeSizeWinRt.*Minor());
+
+        if (const auto measuredSizeIndex = GetMeasuredSizeIndex(virtualContext, stackState))
+        {
+            measuredSizeIndex->SetSize(index, provisionalArrangeSizeWinRt.*Major());
+        }
     }
 }
 
@@ -251,7 +290,15 @@ winrt::FlowLayoutAnchorInfo StackLayout::Algorithm_GetAnchorForTargetElement(
         index = targetIndex;
         const auto state = GetAsStackState(context.LayoutState());
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
-        offset = index * averageElementSize + state->FlowAlgorithm().LastExtent().*MajorStart();
+        if (const auto measuredSizeIndex = GetMeasuredSizeIndex(context, state))
+        {
+            const double estimatedElementSize = GetEstimatedElementSize(*measuredSizeIndex, averageElementSize - m_itemSpacing);
+            offset = measuredSizeIndex->OffsetOf(index, estimatedElementSize, m_itemSpacing) + state->FlowAlgorithm().LastExtent().*MajorStart();
+        }
+        else
+        {
+            offset = index * averageElementSize + state->FlowAlgorithm().LastExtent().*MajorStart();
+        }
     }
 
     return winrt::FlowLayoutAnchorInfo{ index, offset };
@@ -315,6 +362,10 @@ void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventA
     {
         m_itemSpacing = unbox_value<double>(args.NewValue());
     }
+    else if (property == s_IsMeasuredSizeIndexEnabledProperty)
+    {
+        m_isMeasuredSizeIndexEnabled = unbox_value<bool>(args.NewValue());
+    }
 
     InvalidateLayout();
 }
@@ -344,4 +395,31 @@ double StackLayout::GetAverageElementSize(
     return averageElementSize;
 }
 
+MeasuredSizeIndex* StackLayout::GetMeasuredSizeIndex(
+    const winrt::VirtualizingLayoutContext& context,
+    const winrt::com_ptr<StackLayoutState>& stackState)
+{
+    auto& measuredSizeIndex = stackState->MeasuredSizeIndex();
+    if (!m_isMeasuredSizeIndexEnabled)
+    {
+        if (measuredSizeIndex.Count() > 0)
+        {
+            measuredSizeIndex.Clear();
+        }
+
+        return nullptr;
+    }
+
+    measuredSizeIndex.Resize(context.ItemCount());
+    return &measuredSizeIndex;
+}
+
+/* static */
+double StackLayout::GetEstimatedElementSize(const MeasuredSizeIndex& measuredSizeIndex, double averageElementSize)
+{
+    // Prefer the average over every item measured so far, it is much more stable than the
+    // estimation buffer when scrolling through items of varying size.
+    return measuredSizeIndex.MeasuredCount() > 0 ? measuredSizeIndex.AverageMeasuredSize() : averageElementSize;
+}
+
 #pragma endregion
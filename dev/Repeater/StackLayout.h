@@ -101,6 +101,13 @@ private:
         winrt::VirtualizingLayoutContext context,
         const winrt::com_ptr<StackLayoutState>& layoutState);
 
+    // Returns the state's measured size index sized to the item count, or null when
+    // IsMeasuredSizeIndexEnabled is not set.
+    MeasuredSizeIndex* GetMeasuredSizeIndex(
+        const winrt::VirtualizingLayoutContext& context,
+        const winrt::com_ptr<StackLayoutState>& stackState);
+    static double GetEstimatedElementSize(const MeasuredSizeIndex& measuredSizeIndex, double averageElementSize);
+
     winrt::com_ptr<StackLayoutState> GetAsStackState(const winrt::IInspectable& state)
     {
         return winrt::get_self<StackLayoutState>(state.as<winrt::StackLayoutState>())->get_strong();
@@ -118,6 +125,7 @@ private:
 
     // Fields
     double m_itemSpacing{};
+    bool m_isMeasuredSizeIndexEnabled{};
 
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration. 
@@ -5,6 +5,7 @@
 
 #include "StackLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "MeasuredSizeIndex.h"
 
 class StackLayoutState :
     public ReferenceTracker<StackLayoutState, winrt::implementation::StackLayoutStateT, winrt::composing>
@@ -21,6 +22,8 @@ public:
     double TotalElementSize() const { return m_totalElementSize; }
     double MaxArrangeBounds() const { return m_maxArrangeBounds; }
     int TotalElementsMeasured() const { return m_totalElementsMeasured; }
+    // Only populated when StackLayout.IsMeasuredSizeIndexEnabled is set.
+    ::MeasuredSizeIndex& MeasuredSizeIndex() { return m_measuredSizeIndex; }
 
 private:
     ::FlowLayoutAlgorithm m_flowAlgorithm{ this };
@@ -31,5 +34,6 @@ private:
     // is going to be used in the calculation of the extent.
     double m_maxArrangeBounds{};
     int m_totalElementsMeasured{};
+    ::MeasuredSizeIndex m_measuredSizeIndex{};
     static const int BufferSize = 100;
 };
\ No newline at end of file
@@ -61,15 +61,28 @@ winrt::Size UniformGridLayout::MeasureOverride(
     auto gridState = GetAsGridState(context.LayoutState());
     gridState->EnsureElementSize(availableSize, context, m_minItemWidth, m_minItemHeight, m_itemsStretch, Orientation(), MinRowSpacing(), MinColumnSpacing(), m_maximumRowsOrColumns);
 
-    auto desiredSize = GetFlowAlgorithm(context).Measure(
-        availableSize,
-        context,
-        true, /* isWrapping*/
-        MinItemSpacing(),
-        LineSpacing(),
-        m_maximumRowsOrColumns /* maxItemsPerLine */,
-        OrientationBasedMeasures::GetScrollOrientation(),
-        LayoutId());
+    // Items of a fixed size can always be placed by index, so HasFixedSizeItems implies the
+    // closed-form layout even when IsClosedFormLayoutEnabled is not set.
+    auto desiredSize = (m_isClosedFormLayoutEnabled || m_hasFixedSizeItems) ?
+        GetFlowAlgorithm(context).MeasureUniform(
+            availableSize,
+            context,
+            winrt::Size{ static_cast<float>(gridState->EffectiveItemWidth()), static_cast<float>(gridState->EffectiveItemHeight()) },
+            MinItemSpacing(),
+            LineSpacing(),
+            m_maximumRowsOrColumns /* maxItemsPerLine */,
+            !m_hasFixedSizeItems /* measureElements */,
+            OrientationBasedMeasures::GetScrollOrientation(),
+            LayoutId()) :
+        GetFlowAlgorithm(context).Measure(
+            availableSize,
+            context,
+            true, /* isWrapping*/
+            MinItemSpacing(),
+            LineSpacing(),
+            m_maximumRowsOrColumns /* maxItemsPerLine */,
+            OrientationBasedMeasures::GetScrollOrientation(),
+            LayoutId());
 
     // If after Measure the first item is in the realization rect, then we revoke grid state's ownership,
     // and only use the layout when to clear it when it's done.
@@ -285,6 +298,14 @@ void UniformGridLayout::OnPropertyChanged(const winrt::DependencyPropertyChanged
     {
         m_maximumRowsOrColumns = static_cast<unsigned int>(unbox_value<int>(args.NewValue()));
     }
+    else if (property == s_IsClosedFormLayoutEnabledProperty)
+    {
+        m_isClosedFormLayoutEnabled = unbox_value<bool>(args.NewValue());
+    }
+    else if (property == s_HasFixedSizeItemsProperty)
+    {
+        m_hasFixedSizeItems = unbox_value<bool>(args.NewValue());
+    }
 
     InvalidateLayout();
 }
@@ -112,6 +112,11 @@ private:
     winrt::UniformGridLayoutItemsJustification m_itemsJustification{ winrt::UniformGridLayoutItemsJustification::Start };
     winrt::UniformGridLayoutItemsStretch m_itemsStretch{ winrt::UniformGridLayoutItemsStretch::None };
     unsigned int m_maximumRowsOrColumns{MAXUINT};
+    // Lay out items by index instead of generating from an anchor.
+    bool m_isClosedFormLayoutEnabled{ false };
+    // Items never change size with their data, so realized items are not measured again.
+    // Also turns on the closed-form layout, which is what lets measuring be skipped.
+    bool m_hasFixedSizeItems{ false };
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration.
     // layout specific state needs to be stored in UniformGridLayoutState.
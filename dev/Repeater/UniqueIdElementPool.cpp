@@ -18,15 +18,18 @@ void UniqueIdElementPool::Add(const winrt::UIElement& element)
     MUX_ASSERT(m_owner->ItemsSourceView().HasKeyIndexMapping());
 
     auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-    auto key = std::wstring(virtInfo->UniqueId().data());
+    auto const& uniqueId = virtInfo->UniqueIdString();
 
-    if (m_elementMap.find(key) != m_elementMap.end())
+    if (m_elementMap.find(uniqueId) != m_elementMap.end())
     {
-        std::wstring message = L"The unique id provided (" + std::wstring(virtInfo->UniqueId().data()) + L") is not unique.";
+        std::wstring message = L"The unique id provided (" + std::wstring(uniqueId.data()) + L") is not unique.";
         throw winrt::hresult_error(E_FAIL, message.c_str());
     }
 
-    m_elementMap.insert(std::make_pair(std::move(key), tracker_ref<winrt::UIElement>(m_owner, element)));
+    Entry entry{ m_owner, uniqueId, element };
+    // The key views the entry's string buffer, which moves along with the hstring.
+    const std::wstring_view key = entry.uniqueId;
+    m_elementMap.emplace(key, std::move(entry));
 }
 
 winrt::UIElement UniqueIdElementPool::Remove(int index)
@@ -35,11 +38,11 @@ winrt::UIElement UniqueIdElementPool::Remove(int index)
 
     // Check if there is already a element in the mapping and if so, use it.
     winrt::UIElement element = nullptr;
-    std::wstring key = std::wstring(m_owner->ItemsSourceView().KeyFromIndex(index));
+    auto const key = m_owner->ItemsSourceView().KeyFromIndex(index);
     auto it = m_elementMap.find(key);
     if (it != m_elementMap.end())
     {
-        element = it->second.get();
+        element = it->second.element.get();
         m_elementMap.erase(it);
     }
 
@@ -18,6 +18,21 @@ public:
     auto end() const { return m_elementMap.end(); }
 
 private:
+    struct Entry
+    {
+        Entry(const ITrackerHandleManager* owner, const winrt::hstring& id, const winrt::UIElement& value) :
+            uniqueId(id),
+            element(owner, value)
+        {
+        }
+
+        // Owns the characters the map key views. Copying an hstring only adds a reference to its buffer.
+        winrt::hstring uniqueId;
+        tracker_ref<winrt::UIElement> element;
+    };
+
     ItemsRepeater* m_owner{ nullptr };
-    std::map<std::wstring, tracker_ref<winrt::UIElement>> m_elementMap;
+    // Keyed by views into Entry::uniqueId, so neither adding an element nor looking up the key
+    // of an index copies the key.
+    std::unordered_map<std::wstring_view, Entry> m_elementMap;
 };
\ No newline at end of file
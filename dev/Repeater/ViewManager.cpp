@@ -8,6 +8,7 @@
 #include "ItemsRepeater.h"
 #include "ElementFactoryGetArgs.h"
 #include "ElementFactoryRecycleArgs.h"
+#include "RepeaterLayoutMetrics.h"
 
 ViewManager::ViewManager(ItemsRepeater* owner) :
     m_owner(owner),
@@ -133,7 +134,14 @@ void ViewManager::ClearElementToElementFactory(const winrt::UIElement& element)
     }
 
     auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);    
+    MUX_TRACE_EVENT(RepeaterElementCleared, m_owner, virtInfo->Index());
+    RemoveRealizedElement(virtInfo);
     virtInfo->MoveOwnershipToElementFactory();
+    if (m_owner->ItemTemplateShim())
+    {
+        // The element stays in the children collection, it gets arranged out of view.
+        AddClearedElement(element, virtInfo);
+    }
     m_phaser.StopPhasing(element, virtInfo);
     if (m_lastFocusedElement == element)
     {
@@ -184,12 +192,11 @@ winrt::Control ViewManager::FindFocusCandidate(int clearedIndex, winrt::UIElemen
     int nextIndex = std::numeric_limits<int>::max();
     winrt::UIElement nextElement = nullptr;
     winrt::UIElement previousElement = nullptr;
-    auto children = m_owner->Children();
-    for (unsigned i = 0u; i < children.Size(); ++i)
+    for (const auto& elementInfo : m_realizedElements)
     {
-        auto child = children.GetAt(i);
-        auto virtInfo = ItemsRepeater::TryGetVirtualizationInfo(child);
-        if (virtInfo && virtInfo->IsHeldByLayout())
+        auto child = elementInfo.Element();
+        auto virtInfo = elementInfo.VirtualizationInfo();
+        if (virtInfo->IsHeldByLayout())
         {
             const int currentIndex = virtInfo->Index();
             if (currentIndex < clearedIndex)
@@ -274,7 +281,7 @@ void ViewManager::PrunePinnedElements()
             --i;
 
             // Pinning was the only thing keeping this element alive.
-            ClearElementToElementFactory(elementInfo.PinnedElement());
+            ClearElementToElementFactory(elementInfo.Element());
         }
     }
 }
@@ -316,6 +323,7 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
 {
     // Note: For items that have been removed, the index will not be touched. It will hold
     // the old index before it was removed. It is not valid anymore.
+    int touchedCount = 0;
     switch (args.Action())
     {
     case winrt::NotifyCollectionChangedAction::Add:
@@ -326,13 +334,12 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
         if (newIndex <= m_lastRealizedElementIndexHeldByLayout)
         {
             m_lastRealizedElementIndexHeldByLayout += newCount;
-            auto children = m_owner->Children();
-            auto childCount = children.Size();
-            for (unsigned i = 0u; i < childCount; ++i)
+            for (const auto& elementInfo : GetRealizedElements())
             {
-                auto element = children.GetAt(i);
-                auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+                auto element = elementInfo.Element();
+                auto virtInfo = elementInfo.VirtualizationInfo();
                 auto dataIndex = virtInfo->Index();
+                ++touchedCount;
 
                 if (virtInfo->IsRealized() && dataIndex >= newIndex)
                 {
@@ -349,10 +356,11 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
                 auto elementInfo = m_pinnedPool[i];
                 auto virtInfo = elementInfo.VirtualizationInfo();
                 auto dataIndex = virtInfo->Index();
+                ++touchedCount;
 
                 if (virtInfo->IsRealized() && dataIndex >= newIndex)
                 {
-                    auto element = elementInfo.PinnedElement();
+                    auto element = elementInfo.Element();
                     UpdateElementIndex(element, virtInfo, dataIndex + newCount);
                 }
             }
@@ -393,12 +401,12 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
         {
             // countChange > 0 : countChange items were added
             // countChange < 0 : -countChange  items were removed
-            auto children = m_owner->Children();
-            for (unsigned i = 0u; i < children.Size(); ++i)
+            for (const auto& elementInfo : GetRealizedElements())
             {
-                auto element = children.GetAt(i);
-                auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+                auto element = elementInfo.Element();
+                auto virtInfo = elementInfo.VirtualizationInfo();
                 auto dataIndex = virtInfo->Index();
+                ++touchedCount;
 
                 if (virtInfo->IsRealized())
                 {
@@ -419,27 +427,34 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
     {
         auto oldStartIndex = args.OldStartingIndex();
         auto oldCount = static_cast<int>(args.OldItems().Size());
-        auto children = m_owner->Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+        // Clearing an element removes it from the realized elements, so the elements whose
+        // data was removed are collected first and cleared once the walk is done.
+        std::vector<winrt::UIElement> elementsToClear;
+        for (const auto& elementInfo : GetRealizedElements())
         {
-            auto element = children.GetAt(i);
-            auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+            auto virtInfo = elementInfo.VirtualizationInfo();
             auto dataIndex = virtInfo->Index();
+            ++touchedCount;
 
             if (virtInfo->IsRealized())
             {
                 if (virtInfo->AutoRecycleCandidate() && oldStartIndex <= dataIndex && dataIndex < oldStartIndex + oldCount)
                 {
                     // If we are doing the mapping, remove the element who's data was removed.
-                    m_owner->ClearElementImpl(element);
+                    elementsToClear.push_back(elementInfo.Element());
                 }
                 else if (dataIndex >= (oldStartIndex + oldCount))
                 {
-                    UpdateElementIndex(element, virtInfo, dataIndex - oldCount);
+                    UpdateElementIndex(elementInfo.Element(), virtInfo, dataIndex - oldCount);
                 }
             }
         }
 
+        for (const auto& element : elementsToClear)
+        {
+            m_owner->ClearElementImpl(element);
+        }
+
         InvalidateRealizedIndicesHeldByLayout();
         break;
     }
@@ -451,21 +466,27 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
         }
 
         // Walk through all the elements and make sure they are cleared, they will go into
-        // the stable id reset pool.
-        auto children = m_owner->Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+        // the stable id reset pool. Clearing swap-removes from m_realizedElements, so walk it backwards.
+        for (size_t i = m_realizedElements.size(); i-- > 0;)
         {
-            auto element = children.GetAt(i);
-            auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+            if (i >= m_realizedElements.size())
+            {
+                continue;
+            }
+
+            auto virtInfo = m_realizedElements[i].VirtualizationInfo();
+            ++touchedCount;
             if (virtInfo->IsRealized() && virtInfo->AutoRecycleCandidate())
             {
-                m_owner->ClearElementImpl(element);
+                m_owner->ClearElementImpl(m_realizedElements[i].Element());
             }
         }
 
         InvalidateRealizedIndicesHeldByLayout();
         break;
     }
+
+    REPEATER_TRACE_INFO(L"Collection change touched %d elements. \n", touchedCount);
 }
 
 void ViewManager::EnsureFirstLastRealizedIndices()
@@ -497,7 +518,7 @@ void ViewManager::OnOwnerArranged()
             // TODO: Task 14204306: ItemsRepeater: Find better focus candidate when focused element is deleted in the ItemsSource.
             // Focused element is getting cleared. Need to figure out semantics on where
             // focus should go when the focused element is removed from the data collection.
-            ClearElement(entry.second.get(), true /* isClearedDueToCollectionChange */);
+            ClearElement(entry.second.element.get(), true /* isClearedDueToCollectionChange */);
         }
 
         m_resetPool.Clear();
@@ -526,12 +547,10 @@ winrt::UIElement ViewManager::GetElementIfAlreadyHeldByLayout(int index)
         MUX_ASSERT((m_firstRealizedElementIndexHeldByLayout == FirstRealizedElementIndexDefault && m_lastRealizedElementIndexHeldByLayout == LastRealizedElementIndexDefault) ||
             (m_firstRealizedElementIndexHeldByLayout != FirstRealizedElementIndexDefault && m_lastRealizedElementIndexHeldByLayout != LastRealizedElementIndexDefault));
 
-        auto children = m_owner->Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+        for (const auto& elementInfo : m_realizedElements)
         {
-            auto child = children.GetAt(i);
-            auto virtInfo = ItemsRepeater::TryGetVirtualizationInfo(child);
-            if (virtInfo && virtInfo->IsHeldByLayout())
+            auto virtInfo = elementInfo.VirtualizationInfo();
+            if (virtInfo->IsHeldByLayout())
             {
                 // Only give back elements held by layout. If someone else is holding it, they will be served by other methods.
                 const int childIndex = virtInfo->Index();
@@ -539,7 +558,7 @@ winrt::UIElement ViewManager::GetElementIfAlreadyHeldByLayout(int index)
                 m_lastRealizedElementIndexHeldByLayout = std::max(m_lastRealizedElementIndexHeldByLayout, childIndex);
                 if (virtInfo->Index() == index)
                 {
-                    element = child;
+                    element = elementInfo.Element();
                     // If we have valid first/last indices, we don't have to walk the rest, but if we 
                     // do not, then we keep walking through the entire children collection to get accurate
                     // indices once.
@@ -557,6 +576,7 @@ winrt::UIElement ViewManager::GetElementIfAlreadyHeldByLayout(int index)
 
 winrt::UIElement ViewManager::GetElementFromUniqueIdResetPool(int index)
 {
+    RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::GetElementFromUniqueIdResetPool);
     winrt::UIElement element = nullptr;
     // See if you can get it from the reset pool.
     if (m_isDataSourceStableResetPending)
@@ -567,6 +587,7 @@ winrt::UIElement ViewManager::GetElementFromUniqueIdResetPool(int index)
             // Make sure that the index is updated to the current one
             auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
             virtInfo->MoveOwnershipToLayoutFromUniqueIdResetPool();
+            AddRealizedElement(element, virtInfo);
             UpdateElementIndex(element, virtInfo, index);
         }
     }
@@ -576,6 +597,7 @@ winrt::UIElement ViewManager::GetElementFromUniqueIdResetPool(int index)
 
 winrt::UIElement ViewManager::GetElementFromPinnedElements(int index)
 {
+    RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::GetElementFromPinnedPool);
     winrt::UIElement element = nullptr;
 
     // See if you can find something among the pinned elements.
@@ -587,7 +609,7 @@ winrt::UIElement ViewManager::GetElementFromPinnedElements(int index)
         if (virtInfo->Index() == index)
         {
             m_pinnedPool.erase(m_pinnedPool.begin() + i);
-            element = elementInfo.PinnedElement();
+            element = elementInfo.Element();
             elementInfo.VirtualizationInfo()->MoveOwnershipToLayoutFromPinnedPool();
             break;
         }
@@ -598,6 +620,7 @@ winrt::UIElement ViewManager::GetElementFromPinnedElements(int index)
 
 winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
 {
+    RepeaterLayoutTimingSpan span(RepeaterLayoutSpan::GetElementFromElementFactory);
     // The view generator is the provider of last resort.
     auto data = m_owner->ItemsSourceView().GetAt(index);
     
@@ -640,17 +663,21 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
         args.Parent(nullptr);
     }
 
+    RepeaterLayoutMetrics::Increment(RepeaterLayoutCounter::ElementsRealized);
     auto virtInfo = ItemsRepeater::TryGetVirtualizationInfo(element);
     if (!virtInfo)
     {
         virtInfo = ItemsRepeater::CreateAndInitializeVirtualizationInfo(element);
         REPEATER_TRACE_PERF(L"ElementCreated");
+        MUX_TRACE_EVENT(RepeaterElementCreated, m_owner, index);
     }
     else
     {
         // View obtained from ElementFactory already has a VirtualizationInfo attached to it
         // which means that the element has been recycled and not created from scratch.
         REPEATER_TRACE_PERF(L"ElementRecycled");
+        RepeaterLayoutMetrics::Increment(RepeaterLayoutCounter::ElementsRecycled);
+        MUX_TRACE_EVENT(RepeaterElementRecycled, m_owner, index);
     }
 
     if (!itemsSourceContainsElements)
@@ -686,6 +713,7 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
         m_owner->ItemsSourceView().HasKeyIndexMapping() ?
         m_owner->ItemsSourceView().KeyFromIndex(index) :
         winrt::hstring{});
+    AddRealizedElement(element, virtInfo);
 
     // The view generator is the only provider that prepares the element.
     auto repeater = m_owner;
@@ -724,6 +752,7 @@ bool ViewManager::ClearElementToUniqueIdResetPool(const winrt::UIElement& elemen
     if (m_isDataSourceStableResetPending)
     {
         m_resetPool.Add(element);
+        RemoveRealizedElement(virtInfo);
         virtInfo->MoveOwnershipToUniqueIdResetPoolFromLayout();
     }
 
@@ -736,6 +765,7 @@ bool ViewManager::ClearElementToAnimator(const winrt::UIElement& element, const
     if (cleared)
     {
         const int clearedIndex = virtInfo->Index();
+        RemoveRealizedElement(virtInfo);
         virtInfo->MoveOwnershipToAnimator();
         if (m_lastFocusedElement == element)
         {
@@ -759,11 +789,13 @@ bool ViewManager::ClearElementToPinnedPool(const winrt::UIElement& element, cons
 #ifdef _DEBUG
         for (size_t i = 0; i < m_pinnedPool.size(); ++i)
         {
-            MUX_ASSERT(m_pinnedPool[i].PinnedElement() != element);
+            MUX_ASSERT(m_pinnedPool[i].Element() != element);
         }
 #endif
-        m_pinnedPool.push_back(PinnedElementInfo(m_owner, element));
+        m_pinnedPool.push_back(ElementInfo(m_owner, element, virtInfo));
         virtInfo->MoveOwnershipToPinnedPool();
+        // Pinned elements stay realized, but they are arranged out of view like cleared ones.
+        AddClearedElement(element, virtInfo);
     }
 
     return moveToPinnedPool;
@@ -852,7 +884,71 @@ void ViewManager::InvalidateRealizedIndicesHeldByLayout()
     m_lastRealizedElementIndexHeldByLayout = LastRealizedElementIndexDefault;
 }
 
-ViewManager::PinnedElementInfo::PinnedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element) :
-    m_pinnedElement(owner, element),
-    m_virtInfo(owner, ItemsRepeater::GetVirtualizationInfo(element))
+winrt::UIElement ViewManager::TryGetRealizedElement(int index) const
+{
+    for (const auto& elementInfo : m_realizedElements)
+    {
+        if (elementInfo.VirtualizationInfo()->Index() == index)
+        {
+            return elementInfo.Element();
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<ViewManager::ElementInfo> ViewManager::TakeClearedElements()
+{
+    std::vector<ElementInfo> clearedElements;
+    clearedElements.swap(m_clearedElements);
+    for (const auto& elementInfo : clearedElements)
+    {
+        elementInfo.VirtualizationInfo()->IsInClearedElements(false);
+    }
+
+    return clearedElements;
+}
+
+void ViewManager::AddClearedElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo)
+{
+    // An element can be cleared more than once before the next arrange, e.g. to the pinned
+    // pool and then from it to the element factory. It only needs to be arranged out of view once.
+    if (!virtInfo->IsInClearedElements())
+    {
+        virtInfo->IsInClearedElements(true);
+        m_clearedElements.emplace_back(m_owner, element, virtInfo);
+    }
+}
+
+void ViewManager::AddRealizedElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo)
+{
+    MUX_ASSERT(virtInfo->IsRealized());
+    if (virtInfo->RealizedElementsSlot() == -1)
+    {
+        virtInfo->RealizedElementsSlot(static_cast<int>(m_realizedElements.size()));
+        m_realizedElements.emplace_back(m_owner, element, virtInfo);
+    }
+}
+
+void ViewManager::RemoveRealizedElement(const winrt::com_ptr<VirtualizationInfo>& virtInfo)
+{
+    const int slot = virtInfo->RealizedElementsSlot();
+    if (slot != -1)
+    {
+        MUX_ASSERT(m_realizedElements[slot].VirtualizationInfo() == virtInfo);
+        const int lastSlot = static_cast<int>(m_realizedElements.size()) - 1;
+        if (slot != lastSlot)
+        {
+            m_realizedElements[slot] = m_realizedElements[lastSlot];
+            m_realizedElements[slot].VirtualizationInfo()->RealizedElementsSlot(slot);
+        }
+
+        m_realizedElements.pop_back();
+        virtInfo->RealizedElementsSlot(-1);
+    }
+}
+
+ViewManager::ElementInfo::ElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element, const winrt::com_ptr<::VirtualizationInfo>& virtInfo) :
+    m_element(owner, element),
+    m_virtInfo(owner, virtInfo)
 { }
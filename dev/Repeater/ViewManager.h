@@ -28,6 +28,32 @@ public:
     void OnLayoutChanging();
     void OnOwnerArranged();
 
+    struct ElementInfo
+    {
+        ElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element, const winrt::com_ptr<::VirtualizationInfo>& virtInfo);
+
+        winrt::UIElement Element() const { return m_element.get(); }
+        winrt::com_ptr<VirtualizationInfo> VirtualizationInfo() const { return m_virtInfo.get(); }
+
+    private:
+        tracker_ref<winrt::UIElement> m_element;
+
+        // We hold on VirtualizationInfo to make sure we can
+        // quickly access its content rather than go through
+        // ItemsRepeater.GetVirtualizationInfo(element) which is
+        // slower (assuming it's implemented using attached
+        // properties).
+        tracker_com_ref<::VirtualizationInfo> m_virtInfo;
+    };
+
+    // Elements that are realized (held by layout or in the pinned pool). Clearing an element
+    // swap-removes it from this list, so callers that clear elements while walking it have
+    // to walk it backwards by index.
+    const std::vector<ElementInfo>& GetRealizedElements() const { return m_realizedElements; }
+    winrt::UIElement TryGetRealizedElement(int index) const;
+    // Elements cleared since the last call. They have not been arranged out of view yet.
+    std::vector<ElementInfo> TakeClearedElements();
+
 private:
 #pragma region GetElement providers
 
@@ -58,30 +84,23 @@ private:
     void InvalidateRealizedIndicesHeldByLayout();
     void EnsureFirstLastRealizedIndices();
 
-    struct PinnedElementInfo
-    {
-        PinnedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element);
-
-        winrt::UIElement PinnedElement() const { return m_pinnedElement.get(); }
-        winrt::com_ptr<VirtualizationInfo> VirtualizationInfo() const { return m_virtInfo.get(); }
-
-    private:
-        tracker_ref<winrt::UIElement> m_pinnedElement;
-
-        // We hold on VirtualizationInfo to make sure we can
-        // quickly access its content rather than go through
-        // ItemsRepeater.GetVirtualizationInfo(element) which is
-        // slower (assuming it's implemented using attached
-        // properties).
-        tracker_com_ref<::VirtualizationInfo> m_virtInfo;
-    };
+    void AddRealizedElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
+    void AddClearedElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
+    void RemoveRealizedElement(const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
     ItemsRepeater* m_owner{ nullptr };
 
     // Pinned elements that are currently owned by layout are *NOT* in this pool.
-    std::vector<PinnedElementInfo> m_pinnedPool;
+    std::vector<ElementInfo> m_pinnedPool;
     UniqueIdElementPool m_resetPool;
 
+    // Kept in sync with ownership changes so that layout passes and collection changes
+    // only visit the elements they can affect, not the containers sitting in the recycle
+    // pool. Each element stores its position in the vector in its VirtualizationInfo,
+    // so that removal is a swap with the last entry.
+    std::vector<ElementInfo> m_realizedElements;
+    std::vector<ElementInfo> m_clearedElements;
+
     // _lastFocusedElement is listed in _pinnedPool.
     // It has to be an element we own (i.e. a direct child).
     tracker_ref<winrt::UIElement> m_lastFocusedElement;
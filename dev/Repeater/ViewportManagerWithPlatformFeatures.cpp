@@ -14,11 +14,21 @@
 // properties.
 constexpr double CacheBufferPerSideInflationPixelDelta = 40.0;
 
+// Scroll velocity (in pixels per millisecond) at which the realization window reaches its maximum bias.
+constexpr double CacheBufferBiasMaxVelocity = 4.0;
+// Largest fraction of the cache buffer on one side that can be moved to the other side.
+// We always keep a bit of buffer behind the viewport so that small direction changes are cheap.
+constexpr double CacheBufferMaxBias = 0.8;
+// Viewport updates further apart than this are not part of the same scroll, so they don't tell
+// us anything about the velocity.
+constexpr double ScrollVelocitySampleTimeoutInMs = 100.0;
+
 ViewportManagerWithPlatformFeatures::ViewportManagerWithPlatformFeatures(ItemsRepeater* owner) :
     m_owner(owner),
     m_scroller(owner),
     m_makeAnchorElement(owner),
-    m_cacheBuildAction(owner)
+    m_cacheBuildAction(owner),
+    m_rebalanceTimer(owner)
 {
     // ItemsRepeater is not fully constructed yet. Don't interact with it.
 }
@@ -66,7 +76,7 @@ void ViewportManagerWithPlatformFeatures::HorizontalCacheLength(double value)
     {
         ValidateCacheLength(value);
         m_maximumHorizontalCacheLength = value;
-        ResetCacheBuffer();
+        ClampCacheBuffer();
     }
 }
 
@@ -76,7 +86,7 @@ void ViewportManagerWithPlatformFeatures::VerticalCacheLength(double value)
     {
         ValidateCacheLength(value);
         m_maximumVerticalCacheLength = value;
-        ResetCacheBuffer();
+        ClampCacheBuffer();
     }
 }
 
@@ -120,15 +130,26 @@ winrt::Rect ViewportManagerWithPlatformFeatures::GetLayoutRealizationWindow() co
     auto realizationWindow = GetLayoutVisibleWindow();
     if (HasScroller())
     {
-        realizationWindow.X -= static_cast<float>(m_horizontalCacheBufferPerSide);
-        realizationWindow.Y -= static_cast<float>(m_verticalCacheBufferPerSide);
-        realizationWindow.Width += static_cast<float>(m_horizontalCacheBufferPerSide) * 2.0f;
-        realizationWindow.Height += static_cast<float>(m_verticalCacheBufferPerSide) * 2.0f;
+        realizationWindow = GetRealizationWindow(realizationWindow);
     }
 
     return realizationWindow;
 }
 
+winrt::Rect ViewportManagerWithPlatformFeatures::GetRealizationWindow(winrt::Rect visibleWindow) const
+{
+    // The total buffer stays the same, we only move part of it from behind the viewport
+    // to ahead of it while scrolling.
+    const double horizontalBias = GetCacheBufferBias(m_horizontalScrollVelocity);
+    const double verticalBias = GetCacheBufferBias(m_verticalScrollVelocity);
+
+    visibleWindow.X -= static_cast<float>(m_horizontalCacheBufferPerSide * (1.0 - horizontalBias));
+    visibleWindow.Y -= static_cast<float>(m_verticalCacheBufferPerSide * (1.0 - verticalBias));
+    visibleWindow.Width += static_cast<float>(m_horizontalCacheBufferPerSide) * 2.0f;
+    visibleWindow.Height += static_cast<float>(m_verticalCacheBufferPerSide) * 2.0f;
+    return visibleWindow;
+}
+
 void ViewportManagerWithPlatformFeatures::SetLayoutExtent(winrt::Rect extent)
 {
     m_expectedViewportShift.X += m_layoutExtent.X - extent.X;
@@ -231,14 +252,24 @@ void ViewportManagerWithPlatformFeatures::OnOwnerArranged()
             {
                 m_horizontalCacheBufferPerSide += CacheBufferPerSideInflationPixelDelta;
                 m_verticalCacheBufferPerSide += CacheBufferPerSideInflationPixelDelta;
+            }
 
-                m_horizontalCacheBufferPerSide = std::min(m_horizontalCacheBufferPerSide, maximumHorizontalCacheBufferPerSide);
-                m_verticalCacheBufferPerSide = std::min(m_verticalCacheBufferPerSide, maximumVerticalCacheBufferPerSide);
+            // The viewport may have shrunk since the buffer was built.
+            m_horizontalCacheBufferPerSide = std::min(m_horizontalCacheBufferPerSide, maximumHorizontalCacheBufferPerSide);
+            m_verticalCacheBufferPerSide = std::min(m_verticalCacheBufferPerSide, maximumVerticalCacheBufferPerSide);
 
-                // Since we grow the cache buffer at the end of the arrange pass,
-                // we need to register work even if we just reached cache potential.
+            // Since we grow the cache buffer at the end of the arrange pass,
+            // we need to register work even if we just reached cache potential.
+            if (continueBuildingCache)
+            {
                 RegisterCacheBuildWork();
             }
+            else if (m_horizontalScrollVelocity != 0.0 || m_verticalScrollVelocity != 0.0)
+            {
+                // While the realization window is biased, we need to come back once
+                // scrolling stops to even it out again.
+                RegisterRebalanceWork();
+            }
         }
     }
 }
@@ -371,6 +402,13 @@ void ViewportManagerWithPlatformFeatures::ResetScrollers()
 void ViewportManagerWithPlatformFeatures::OnCacheBuildActionCompleted()
 {
     m_cacheBuildAction.set(nullptr);
+    if (IsScrollVelocityStale())
+    {
+        // Scrolling stopped, rebalance the realization window around the viewport.
+        m_horizontalScrollVelocity = 0.0;
+        m_verticalScrollVelocity = 0.0;
+    }
+
     if (!m_managingViewportDisabled)
     {
         m_owner->InvalidateMeasure();
@@ -433,6 +471,7 @@ void ViewportManagerWithPlatformFeatures::UpdateViewport(winrt::Rect const& view
 {
     assert(!m_managingViewportDisabled);
     const auto previousVisibleWindow = m_visibleWindow;
+    const auto previousRealizationWindow = GetRealizationWindow(previousVisibleWindow);
     REPEATER_TRACE_INFO(L"%ls: \tEffective Viewport: (%.0f,%.0f,%.0f,%.0f)->(%.0f,%.0f,%.0f,%.0f). \n",
         GetLayoutId().data(),
         previousVisibleWindow.X, previousVisibleWindow.Y, previousVisibleWindow.Width, previousVisibleWindow.Height,
@@ -456,9 +495,66 @@ void ViewportManagerWithPlatformFeatures::UpdateViewport(winrt::Rect const& view
         m_visibleWindow = currentVisibleWindow;
     }
 
+    UpdateScrollVelocity(previousVisibleWindow, m_visibleWindow);
+
+    // Small viewport changes keep the buffer we built so far, most of it is still around the new
+    // viewport. If we jumped past the realization window, which may have been leaning to one side,
+    // none of it is useful anymore and we start again from the new viewport.
+    if (previousVisibleWindow != winrt::Rect() &&
+        m_visibleWindow != winrt::Rect() &&
+        (m_visibleWindow.X > previousRealizationWindow.X + previousRealizationWindow.Width ||
+         m_visibleWindow.X + m_visibleWindow.Width < previousRealizationWindow.X ||
+         m_visibleWindow.Y > previousRealizationWindow.Y + previousRealizationWindow.Height ||
+         m_visibleWindow.Y + m_visibleWindow.Height < previousRealizationWindow.Y))
+    {
+        REPEATER_TRACE_INFO(L"%ls: \tViewport jumped out of the realization window. Resetting cache buffer. \n", GetLayoutId().data());
+        m_horizontalScrollVelocity = 0.0;
+        m_verticalScrollVelocity = 0.0;
+        ResetCacheBuffer();
+    }
+
     TryInvalidateMeasure();
 }
 
+void ViewportManagerWithPlatformFeatures::UpdateScrollVelocity(winrt::Rect const& previousVisibleWindow, winrt::Rect const& currentVisibleWindow)
+{
+    const double elapsed = m_viewportUpdateTimer.PreciseDurationInMilliSeconds();
+    m_viewportUpdateTimer.Reset();
+
+    if (previousVisibleWindow == winrt::Rect() ||
+        currentVisibleWindow == winrt::Rect() ||
+        elapsed <= 0.0 ||
+        elapsed > ScrollVelocitySampleTimeoutInMs)
+    {
+        // First update of a new scroll, we don't know where it is going yet.
+        m_horizontalScrollVelocity = 0.0;
+        m_verticalScrollVelocity = 0.0;
+        return;
+    }
+
+    // Average with the previous sample so that a single uneven frame doesn't
+    // flip the realization window back and forth.
+    m_horizontalScrollVelocity = (m_horizontalScrollVelocity + (currentVisibleWindow.X - previousVisibleWindow.X) / elapsed) / 2.0;
+    m_verticalScrollVelocity = (m_verticalScrollVelocity + (currentVisibleWindow.Y - previousVisibleWindow.Y) / elapsed) / 2.0;
+}
+
+bool ViewportManagerWithPlatformFeatures::IsScrollVelocityStale() const
+{
+    return m_viewportUpdateTimer.PreciseDurationInMilliSeconds() > ScrollVelocitySampleTimeoutInMs;
+}
+
+// Returns the fraction of the cache buffer on each side to move ahead of the viewport, positive
+// values move it toward increasing offsets.
+double ViewportManagerWithPlatformFeatures::GetCacheBufferBias(double velocity) const
+{
+    if (velocity == 0.0 || IsScrollVelocityStale())
+    {
+        return 0.0;
+    }
+
+    return std::clamp(velocity / CacheBufferBiasMaxVelocity, -CacheBufferMaxBias, CacheBufferMaxBias);
+}
+
 void ViewportManagerWithPlatformFeatures::ResetCacheBuffer()
 {
     m_horizontalCacheBufferPerSide = 0.0;
@@ -471,6 +567,19 @@ void ViewportManagerWithPlatformFeatures::ResetCacheBuffer()
     }
 }
 
+void ViewportManagerWithPlatformFeatures::ClampCacheBuffer()
+{
+    // Shrinking the maximum cache length does not need to throw away what we already
+    // realized within the new maximum, and growing it only needs us to keep building.
+    m_horizontalCacheBufferPerSide = std::min(m_horizontalCacheBufferPerSide, m_maximumHorizontalCacheLength * m_visibleWindow.Width / 2.0);
+    m_verticalCacheBufferPerSide = std::min(m_verticalCacheBufferPerSide, m_maximumVerticalCacheLength * m_visibleWindow.Height / 2.0);
+
+    if (!m_managingViewportDisabled)
+    {
+        RegisterCacheBuildWork();
+    }
+}
+
 void ViewportManagerWithPlatformFeatures::ValidateCacheLength(double cacheLength)
 {
     if (cacheLength < 0.0 || std::isinf(cacheLength) || std::isnan(cacheLength))
@@ -499,6 +608,62 @@ void ViewportManagerWithPlatformFeatures::RegisterCacheBuildWork()
     }
 }
 
+void ViewportManagerWithPlatformFeatures::RegisterRebalanceWork()
+{
+    assert(!m_managingViewportDisabled);
+    auto timer = m_rebalanceTimer.get();
+    if (!timer)
+    {
+        timer = winrt::DispatcherTimer();
+        // Unlike the cache build action, the timer is kept around so we can't hold on to the owner here.
+        // ItemsRepeater owns this instance, so it is valid as long as the owner is.
+        timer.Tick([this, weakOwner = m_owner->get_weak()](const winrt::IInspectable&, const winrt::IInspectable&)
+        {
+            if (auto strongOwner = weakOwner.get())
+            {
+                OnRebalanceTimerTick();
+            }
+        });
+        m_rebalanceTimer.set(timer);
+    }
+
+    if (!timer.IsEnabled())
+    {
+        // Come back right after the last velocity sample times out instead of polling until it does.
+        const double remainingInMs = std::max(ScrollVelocitySampleTimeoutInMs - m_viewportUpdateTimer.PreciseDurationInMilliSeconds(), 0.0) + 1.0;
+        timer.Interval(winrt::TimeSpan::duration(static_cast<int64_t>(remainingInMs * 10000.0)));
+        timer.Start();
+    }
+}
+
+void ViewportManagerWithPlatformFeatures::OnRebalanceTimerTick()
+{
+    m_rebalanceTimer.get().Stop();
+
+    if (m_horizontalScrollVelocity == 0.0 && m_verticalScrollVelocity == 0.0)
+    {
+        // Already rebalanced, for instance after a jump.
+        return;
+    }
+
+    if (IsScrollVelocityStale())
+    {
+        // Scrolling stopped, rebalance the realization window around the viewport.
+        m_horizontalScrollVelocity = 0.0;
+        m_verticalScrollVelocity = 0.0;
+
+        if (!m_managingViewportDisabled)
+        {
+            m_owner->InvalidateMeasure();
+        }
+    }
+    else if (!m_managingViewportDisabled)
+    {
+        // Still scrolling, the last sample is more recent than when the timer started.
+        RegisterRebalanceWork();
+    }
+}
+
 void ViewportManagerWithPlatformFeatures::TryInvalidateMeasure()
 {
     // Don't invalidate measure if we have an invalid window.
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ViewportManager.h"
+#include "QPCTimer.h"
 
 class ItemsRepeater;
 
@@ -48,6 +49,7 @@ private:
     struct ScrollerInfo;
 
     void OnCacheBuildActionCompleted();
+    void OnRebalanceTimerTick();
     void OnEffectiveViewportChanged(winrt::FrameworkElement const& sender, winrt::EffectiveViewportChangedEventArgs const& args);
     void OnLayoutUpdated(winrt::IInspectable const& sender, winrt::IInspectable const& args);
 
@@ -55,8 +57,14 @@ private:
     bool HasScroller() const { return m_scroller != nullptr; }
     void UpdateViewport(winrt::Rect const& args);
     void ResetCacheBuffer();
+    void ClampCacheBuffer();
+    void UpdateScrollVelocity(winrt::Rect const& previousVisibleWindow, winrt::Rect const& currentVisibleWindow);
+    bool IsScrollVelocityStale() const;
+    double GetCacheBufferBias(double velocity) const;
     void ValidateCacheLength(double cacheLength);
     void RegisterCacheBuildWork();
+    void RegisterRebalanceWork();
+    winrt::Rect GetRealizationWindow(winrt::Rect visibleWindow) const;
     void TryInvalidateMeasure();
     winrt::Rect GetLayoutVisibleWindowDiscardAnchor() const;
 
@@ -73,6 +81,8 @@ private:
     bool m_isAnchorOutsideRealizedRange{};  // Value is only valid when m_makeAnchorElement is set.
 
     tracker_ref<winrt::IAsyncAction> m_cacheBuildAction;
+    // Fires once the scroll velocity goes stale, to even out the realization window after scrolling stops.
+    tracker_ref<winrt::DispatcherTimer> m_rebalanceTimer;
 
     winrt::Rect m_visibleWindow{};
     winrt::Rect m_layoutExtent{};
@@ -95,6 +105,12 @@ private:
     double m_horizontalCacheBufferPerSide{};
     double m_verticalCacheBufferPerSide{};
 
+    // Scroll velocity in pixels per millisecond, measured from successive viewport updates.
+    // The realization window leans toward the direction of travel in proportion to it.
+    double m_horizontalScrollVelocity{};
+    double m_verticalScrollVelocity{};
+    QPCTimer m_viewportUpdateTimer{};
+
     bool m_isBringIntoViewInProgress{false};
     // For non-virtualizing layouts, we do not need to keep
     // updating viewports and invalidating measure often. So when
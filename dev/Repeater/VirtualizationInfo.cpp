@@ -40,7 +40,7 @@ void VirtualizationInfo::UpdatePhasingInfo(int phase, const winrt::IInspectable&
 
 #pragma region Ownership state machine
 
-void VirtualizationInfo::MoveOwnershipToLayoutFromElementFactory(int index, wstring_view uniqueId)
+void VirtualizationInfo::MoveOwnershipToLayoutFromElementFactory(int index, const winrt::hstring& uniqueId)
 {
     MUX_ASSERT(m_owner == ElementOwner::ElementFactory);
     m_owner = ElementOwner::Layout;
@@ -69,6 +69,7 @@ void VirtualizationInfo::MoveOwnershipToElementFactory()
     m_index = -1;
     m_uniqueId.clear();
     m_arrangeBounds = ItemsRepeater::InvalidRect;
+    m_isInVisibleWindow = false;
 }
 
 void VirtualizationInfo::MoveOwnershipToUniqueIdResetPoolFromLayout()
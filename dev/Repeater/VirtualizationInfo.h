@@ -53,7 +53,7 @@ public:
 
 #pragma region Ownership state machine
 
-    void MoveOwnershipToLayoutFromElementFactory(int index, wstring_view uniqueId);
+    void MoveOwnershipToLayoutFromElementFactory(int index, const winrt::hstring& uniqueId);
     void MoveOwnershipToLayoutFromUniqueIdResetPool();
     void MoveOwnershipToLayoutFromPinnedPool();
     void MoveOwnershipToElementFactory();
@@ -72,6 +72,7 @@ public:
     void ArrangeBounds(winrt::Rect value) { m_arrangeBounds = value; }
 
     wstring_view UniqueId() const { return m_uniqueId; }
+    const winrt::hstring& UniqueIdString() const { return m_uniqueId; }
 
 #pragma region Keep element from being recycled
     bool KeepAlive() { return m_keepAlive; }
@@ -81,6 +82,22 @@ public:
     bool AutoRecycleCandidate() { return m_autoRecycleCandidate; }
     void AutoRecycleCandidate(bool value) { m_autoRecycleCandidate = value; }
 
+    // Position in ViewManager's list of realized elements, -1 if not in it.
+    int RealizedElementsSlot() const { return m_realizedElementsSlot; }
+    void RealizedElementsSlot(int value) { m_realizedElementsSlot = value; }
+
+    // Node of the element in Phaser's pending elements, -1 if it is not waiting for a phase.
+    int PhasingSlot() const { return m_phasingSlot; }
+    void PhasingSlot(int value) { m_phasingSlot = value; }
+
+    // Whether the element intersected the visible window the last time it was arranged.
+    bool IsInVisibleWindow() const { return m_isInVisibleWindow; }
+    void IsInVisibleWindow(bool value) { m_isInVisibleWindow = value; }
+
+    // Whether the element is in ViewManager's list of elements waiting to be arranged out of view.
+    bool IsInClearedElements() const { return m_isInClearedElements; }
+    void IsInClearedElements(bool value) { m_isInClearedElements = value; }
+
 private:
     unsigned m_pinCounter{ 0u };
     int m_index{ -1 };
@@ -90,6 +107,10 @@ private:
     int m_phase{ PhaseNotSpecified };
     bool m_keepAlive{ false };
     bool m_autoRecycleCandidate{ false };
+    int m_realizedElementsSlot{ -1 };
+    int m_phasingSlot{ -1 };
+    bool m_isInVisibleWindow{ false };
+    bool m_isInClearedElements{ false };
 
     weak_ref<winrt::IInspectable> m_data;
     weak_ref<winrt::IDataTemplateComponent> m_dataTemplateComponent;
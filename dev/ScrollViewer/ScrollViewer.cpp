@@ -933,6 +933,8 @@ void ScrollViewer::OnScrollerStateChanged(
 
     if (auto scroller = m_scroller.get())
     {
+        MUX_TRACE_EVENT(ScrollViewerStateChanged, this, static_cast<int32_t>(scroller.State()));
+
         if (scroller.State() == winrt::InteractionState::Interaction)
         {
             m_preferMouseIndicators = false;
@@ -973,6 +975,15 @@ void ScrollViewer::OnScrollerViewChanged(
     const winrt::IInspectable& /*sender*/,
     const winrt::IInspectable& args)
 {
+    if (StructuredTrace::IsEnabled())
+    {
+        if (auto scroller = m_scroller.get())
+        {
+            StructuredTrace::Write(TraceEventId::ScrollViewerViewChanged, this, 0, 0,
+                static_cast<float>(scroller.HorizontalOffset()), static_cast<float>(scroller.VerticalOffset()), scroller.ZoomFactor());
+        }
+    }
+
     // Unless the control is still loading, show the scroll controller indicators when the view changes. For example,
     // when using Ctrl+/- to zoom, mouse-wheel to scroll or zoom, or any other input type. Keep the existing indicator type.
     if (SharedHelpers::IsFrameworkElementLoaded(*this))
@@ -874,6 +874,84 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             }
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Measures the anchor element selection while growing the number of registered anchor candidates from 100 to 50,000 (VerticalAnchorRatio=0.5).")]
+        public void AnchoringWithManyAnchorCandidates()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone5))
+            {
+                Log.Warning("Skipping: IScrollAnchorProvider is only available in RS5 and above.");
+                return;
+            }
+
+            foreach (int candidateCount in new int[] { 100, 1000, 10000, 50000 })
+            {
+                Scroller scroller = null;
+                StackPanel stackPanel = null;
+                AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+                RunOnUIThread.Execute(() =>
+                {
+                    Log.Comment("Setting up Scroller with {0} anchor candidates", candidateCount);
+
+                    stackPanel = new StackPanel();
+                    for (int i = 0; i < candidateCount; i++)
+                    {
+                        stackPanel.Children.Add(new Border() { Height = 20 });
+                    }
+
+                    scroller = new Scroller()
+                    {
+                        Width = c_defaultAnchoringUIScrollerConstrainedSize,
+                        Height = c_defaultAnchoringUIScrollerNonConstrainedSize,
+                        ContentOrientation = ContentOrientation.Vertical,
+                        HorizontalAnchorRatio = double.NaN,
+                        VerticalAnchorRatio = 0.5,
+                        Content = stackPanel
+                    };
+
+                    IScrollAnchorProvider anchorProvider = (IScrollAnchorProvider)(object)scroller;
+                    foreach (UIElement child in stackPanel.Children)
+                    {
+                        anchorProvider.RegisterAnchorCandidate(child);
+                    }
+
+                    scroller.Loaded += (object sender, RoutedEventArgs e) =>
+                    {
+                        scrollerLoadedEvent.Set();
+                    };
+
+                    MUXControlsTestApp.App.TestContentRoot = scroller;
+                });
+
+                WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+                ScrollTo(scroller, 0.0, candidateCount * 10.0, AnimationMode.Disabled, SnapPointsMode.Ignore, false /*hookViewChanged*/);
+
+                RunOnUIThread.Execute(() =>
+                {
+                    IScrollAnchorProvider anchorProvider = (IScrollAnchorProvider)(object)scroller;
+                    Border firstBorder = stackPanel.Children[0] as Border;
+
+                    // Each layout grows the content before the viewport, which causes an anchor element selection.
+                    var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                    for (int i = 0; i < 100; i++)
+                    {
+                        firstBorder.Height += 1;
+                        scroller.UpdateLayout();
+                    }
+                    stopwatch.Stop();
+
+                    Log.Comment("100 anchor selections among " + candidateCount + " candidates took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                    UIElement anchor = anchorProvider.CurrentAnchor;
+                    Verify.IsNotNull(anchor);
+                    Log.Comment("Anchor index: {0}", stackPanel.Children.IndexOf(anchor));
+                    Verify.AreNotEqual(firstBorder, anchor);
+                });
+            }
+        }
+
         private void SetupRepeaterAnchoringUI(
             Scroller scroller,
             AutoResetEvent scrollerLoadedEvent)
@@ -3,8 +3,11 @@
 
 using MUXControlsTestApp.Utilities;
 using System;
+using System.Diagnostics;
 using System.Numerics;
+using System.Threading;
 using Windows.UI.Xaml.Controls;
+using Windows.UI.Xaml.Shapes;
 using Windows.UI.Xaml.Controls.Primitives;
 using Common;
 
@@ -18,6 +21,8 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 #endif
 
 using Scroller = Microsoft.UI.Xaml.Controls.Primitives.Scroller;
+using AnimationMode = Microsoft.UI.Xaml.Controls.AnimationMode;
+using SnapPointsMode = Microsoft.UI.Xaml.Controls.SnapPointsMode;
 using ScrollSnapPointsAlignment = Microsoft.UI.Xaml.Controls.Primitives.ScrollSnapPointsAlignment;
 using ScrollSnapPoint = Microsoft.UI.Xaml.Controls.Primitives.ScrollSnapPoint;
 using RepeatedScrollSnapPoint = Microsoft.UI.Xaml.Controls.Primitives.RepeatedScrollSnapPoint;
@@ -283,5 +288,195 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.AreEqual<int>(1, combinationCount31);
             });
         }
+
+        [TestMethod]
+        [TestProperty("Description", "Adds many irregular scroll snap points, which are collapsed into zone tables, and verifies their zones and snapping behavior.")]
+        public void CanSnapToManyIrregularScrollSnapPoints()
+        {
+            const int snapPointsCount = 300;
+
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            ScrollSnapPoint[] scrollSnapPoints = new ScrollSnapPoint[snapPointsCount];
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                Stopwatch stopwatch = Stopwatch.StartNew();
+
+                // Snap points at 0, 4, 6, 10, 12, ... 898, with alternating 4px and 2px intervals.
+                for (int i = 0; i < snapPointsCount; i++)
+                {
+                    scrollSnapPoints[i] = new ScrollSnapPoint(snapPointValue: 3 * i + i % 2, alignment: ScrollSnapPointsAlignment.Near);
+                    scroller.HorizontalSnapPoints.Add(scrollSnapPoints[i]);
+                }
+
+                Log.Comment($"Added {snapPointsCount} horizontal snap points in {stopwatch.ElapsedMilliseconds} ms");
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Vector2 firstApplicableZone = ScrollerTestHooks.GetHorizontalSnapPointActualApplicableZone(scroller, scrollSnapPoints[0]);
+                Vector2 applicableZone = ScrollerTestHooks.GetHorizontalSnapPointActualApplicableZone(scroller, scrollSnapPoints[33]);
+                Vector2 lastApplicableZone = ScrollerTestHooks.GetHorizontalSnapPointActualApplicableZone(scroller, scrollSnapPoints[snapPointsCount - 1]);
+                Log.Comment("firstApplicableZone=" + firstApplicableZone.ToString());
+                Log.Comment("applicableZone=" + applicableZone.ToString());
+                Log.Comment("lastApplicableZone=" + lastApplicableZone.ToString());
+
+                Verify.AreEqual<int>(snapPointsCount, ScrollerTestHooks.GetConsolidatedHorizontalScrollSnapPoints(scroller).Count);
+                Verify.AreEqual<float>(float.NegativeInfinity, firstApplicableZone.X);
+                Verify.AreEqual<float>(2.0f, firstApplicableZone.Y);
+                Verify.AreEqual<float>(98.0f, applicableZone.X);
+                Verify.AreEqual<float>(101.0f, applicableZone.Y);
+                Verify.AreEqual<float>(896.0f, lastApplicableZone.X);
+                Verify.AreEqual<float>(float.PositiveInfinity, lastApplicableZone.Y);
+            });
+
+            Log.Comment("Jumping to offsets that snap to snap points at the start, in the middle and at the end of the zone tables");
+            ScrollTo(scroller, 1.9, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, expectedFinalHorizontalOffset: 0.0, expectedFinalVerticalOffset: 0.0);
+            ScrollTo(scroller, 100.6, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, expectedFinalHorizontalOffset: 100.0, expectedFinalVerticalOffset: 0.0);
+            ScrollTo(scroller, 101.2, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, expectedFinalHorizontalOffset: 102.0, expectedFinalVerticalOffset: 0.0);
+            ScrollTo(scroller, 700.9, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, expectedFinalHorizontalOffset: 700.0, expectedFinalVerticalOffset: 0.0);
+            ScrollTo(scroller, 897.9, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, expectedFinalHorizontalOffset: 898.0, expectedFinalVerticalOffset: 0.0);
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Snaps through thousands of irregular scroll snap points spread over many zone tables, with and without inertia.")]
+        public void CanSnapToThousandsOfIrregularScrollSnapPoints()
+        {
+            const int snapPointsCount = 3000;
+            // Number of zones held by each zone table, and thus by each inertia modifier.
+            const int maxZoneCount = 32;
+
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            ScrollSnapPoint[] scrollSnapPoints = new ScrollSnapPoint[snapPointsCount];
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                // Snap points at 0, 4, 6, 10, 12, ... 8998, with alternating 4px and 2px intervals.
+                for (int i = 0; i < snapPointsCount; i++)
+                {
+                    scrollSnapPoints[i] = new ScrollSnapPoint(snapPointValue: 3 * i + i % 2, alignment: ScrollSnapPointsAlignment.Near);
+                    scroller.HorizontalSnapPoints.Add(scrollSnapPoints[i]);
+                }
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+                rectangleScrollerContent.Width = 3 * snapPointsCount + c_defaultUIScrollerWidth;
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual<int>((snapPointsCount + maxZoneCount - 1) / maxZoneCount, ScrollerTestHooks.GetHorizontalSnapPointInertiaModifierCount(scroller));
+
+                Log.Comment("First and last zones extend to infinity.");
+                Verify.AreEqual(0.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, -1000.0));
+                Verify.AreEqual(8998.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 100000.0));
+
+                Log.Comment("The boundary shared by the last zone of the first table and the first zone of the second table belongs to the former.");
+                Verify.AreEqual(94.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 95.0));
+                Verify.AreEqual(96.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 95.01));
+
+                Log.Comment("Boundaries shared within a table belong to the lower zone too.");
+                Verify.AreEqual(4.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 5.0));
+                Verify.AreEqual(6.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 5.01));
+
+                for (int i = 0; i < snapPointsCount; i += 97)
+                {
+                    double snapPointValue = 3 * i + i % 2;
+                    Verify.AreEqual(snapPointValue, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, snapPointValue + 0.5));
+                    Verify.AreSame(scrollSnapPoints[i], ScrollerTestHooks.GetHorizontalSnappingSnapPoint(scroller, snapPointValue));
+                    Verify.IsNull(ScrollerTestHooks.GetHorizontalSnappingSnapPoint(scroller, snapPointValue + 0.5));
+                }
+            });
+
+            Log.Comment("Jumping to a snap point makes it the ignored one, which must not change the regular zones.");
+            ScrollTo(scroller, 96.4, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, hookViewChanged: false, expectedFinalHorizontalOffset: 96.0, expectedFinalVerticalOffset: 0.0);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreSame(scrollSnapPoints[maxZoneCount], ScrollerTestHooks.GetHorizontalSnappingSnapPoint(scroller, 96.0));
+                Verify.AreEqual(94.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 95.0));
+                Verify.AreEqual(96.0, ScrollerTestHooks.GetHorizontalValueAfterSnapPoints(scroller, 96.9));
+            });
+
+            Log.Comment("Jumping far away moves the ignored snap point to another table.");
+            ScrollTo(scroller, 6000.2, 0.0, AnimationMode.Disabled, SnapPointsMode.Default, hookViewChanged: false, expectedFinalHorizontalOffset: 6000.0, expectedFinalVerticalOffset: 0.0);
+
+            Log.Comment("Running inertia through the resting value expressions of the zone tables.");
+            ScrollFrom(scroller, 1000.0f, 0.0f, horizontalInertiaDecayRate: null, verticalInertiaDecayRate: null, hookViewChanged: false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment($"Inertia rested at HorizontalOffset={scroller.HorizontalOffset}");
+                Verify.IsNotNull(ScrollerTestHooks.GetHorizontalSnappingSnapPoint(scroller, scroller.HorizontalOffset));
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Looks up values in snap point zone tables with shared boundaries, gaps and moved impulse zones.")]
+        public void SnapPointZoneTableFindsZones()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // Snap points at 0, 10, 20 and 50, where 10 is the ignored value so its impulse zone collapsed onto it
+                // and its neighbors' impulse zones reach it. The zone of 20 ends at 30, leaving a gap until 40.
+                double[] zones = new double[]
+                {
+                    //   min,                     max,  impulseMin,                impulseMax,   value
+                    double.NegativeInfinity,      5.0,  double.NegativeInfinity,   10.0,          0.0,
+                    5.0,                         15.0,  10.0,                      10.0,         10.0,
+                    15.0,                        30.0,  10.0,                      30.0,         20.0,
+                    40.0,    double.PositiveInfinity,   40.0,   double.PositiveInfinity,         50.0,
+                };
+
+                Log.Comment("Regular zones, including the first and last one.");
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(zones, -1000.0, false /*forImpulse*/));
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(zones, 5.0, false /*forImpulse*/));
+                Verify.AreEqual(1, ScrollerTestHooks.FindSnapPointZone(zones, 5.01, false /*forImpulse*/));
+                Verify.AreEqual(1, ScrollerTestHooks.FindSnapPointZone(zones, 15.0, false /*forImpulse*/));
+                Verify.AreEqual(2, ScrollerTestHooks.FindSnapPointZone(zones, 30.0, false /*forImpulse*/));
+                Verify.AreEqual(-1, ScrollerTestHooks.FindSnapPointZone(zones, 30.01, false /*forImpulse*/));
+                Verify.AreEqual(-1, ScrollerTestHooks.FindSnapPointZone(zones, 39.99, false /*forImpulse*/));
+                Verify.AreEqual(3, ScrollerTestHooks.FindSnapPointZone(zones, 40.0, false /*forImpulse*/));
+                Verify.AreEqual(3, ScrollerTestHooks.FindSnapPointZone(zones, 1000000.0, false /*forImpulse*/));
+
+                Log.Comment("Impulse zones, where the boundary shared by three zones belongs to the first one.");
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(zones, 7.0, true /*forImpulse*/));
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(zones, 10.0, true /*forImpulse*/));
+                Verify.AreEqual(2, ScrollerTestHooks.FindSnapPointZone(zones, 10.01, true /*forImpulse*/));
+                Verify.AreEqual(-1, ScrollerTestHooks.FindSnapPointZone(zones, 35.0, true /*forImpulse*/));
+                Verify.AreEqual(3, ScrollerTestHooks.FindSnapPointZone(zones, 45.0, true /*forImpulse*/));
+
+                Log.Comment("Evaluate snaps with the regular zones and leaves values in gaps alone.");
+                Verify.AreEqual(0.0, ScrollerTestHooks.EvaluateSnapPointZones(zones, -3.0));
+                Verify.AreEqual(10.0, ScrollerTestHooks.EvaluateSnapPointZones(zones, 7.0));
+                Verify.AreEqual(20.0, ScrollerTestHooks.EvaluateSnapPointZones(zones, 28.0));
+                Verify.AreEqual(35.0, ScrollerTestHooks.EvaluateSnapPointZones(zones, 35.0));
+                Verify.AreEqual(50.0, ScrollerTestHooks.EvaluateSnapPointZones(zones, 1000.0));
+
+                Log.Comment("A table with a single bounded zone.");
+                double[] singleZone = new double[] { 0.0, 10.0, 0.0, 10.0, 5.0 };
+                Verify.AreEqual(-1, ScrollerTestHooks.FindSnapPointZone(singleZone, -0.01, false /*forImpulse*/));
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(singleZone, 0.0, false /*forImpulse*/));
+                Verify.AreEqual(0, ScrollerTestHooks.FindSnapPointZone(singleZone, 10.0, false /*forImpulse*/));
+                Verify.AreEqual(-1, ScrollerTestHooks.FindSnapPointZone(singleZone, 10.01, false /*forImpulse*/));
+                Verify.AreEqual(10.01, ScrollerTestHooks.EvaluateSnapPointZones(singleZone, 10.01));
+            });
+        }
     }
 }
@@ -0,0 +1,171 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "AnchorCandidateIndex.h"
+
+AnchorCandidateIndex::Entry::Entry(const ITrackerHandleManager* owner, const winrt::UIElement& value, uint64_t sequence) :
+    element(owner, value),
+    sequence(sequence)
+{
+}
+
+AnchorCandidateIndex::AnchorCandidateIndex(const ITrackerHandleManager* owner) :
+    m_owner(owner)
+{
+}
+
+bool AnchorCandidateIndex::Add(const winrt::UIElement& element)
+{
+    auto& entry = m_entries[winrt::get_abi(element)];
+    if (entry)
+    {
+        return false;
+    }
+
+    entry = std::make_unique<Entry>(m_owner, element, m_nextSequence++);
+    AddUnplaced(entry.get());
+    return true;
+}
+
+bool AnchorCandidateIndex::Remove(const winrt::UIElement& element)
+{
+    auto it = m_entries.find(winrt::get_abi(element));
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    Unplace(it->second.get());
+    RemoveUnplaced(it->second.get());
+    m_entries.erase(it);
+    return true;
+}
+
+void AnchorCandidateIndex::Clear()
+{
+    m_entries.clear();
+    m_placedEntries.clear();
+    m_unplacedEntries.clear();
+    m_placedExtents.clear();
+}
+
+void AnchorCandidateIndex::Reset(bool isVertical)
+{
+    m_isVertical = isVertical;
+    m_placedEntries.clear();
+    m_placedExtents.clear();
+
+    for (auto& pair : m_entries)
+    {
+        auto entry = pair.second.get();
+        if (entry->isPlaced)
+        {
+            entry->isPlaced = false;
+            AddUnplaced(entry);
+        }
+    }
+}
+
+void AnchorCandidateIndex::Place(Entry* entry, const winrt::Rect& bounds)
+{
+    const float nearEdge = NearEdge(bounds);
+
+    if (entry->isPlaced && entry->position->first == nearEdge)
+    {
+        if (Extent(entry->bounds) != Extent(bounds))
+        {
+            m_placedExtents.erase(entry->extentPosition);
+            entry->extentPosition = m_placedExtents.insert(Extent(bounds));
+        }
+        entry->bounds = bounds;
+    }
+    else
+    {
+        Unplace(entry);
+        RemoveUnplaced(entry);
+        entry->bounds = bounds;
+        entry->position = m_placedEntries.emplace(nearEdge, entry);
+        entry->extentPosition = m_placedExtents.insert(Extent(bounds));
+        entry->isPlaced = true;
+    }
+}
+
+void AnchorCandidateIndex::Unplace(Entry* entry)
+{
+    if (entry->isPlaced)
+    {
+        m_placedEntries.erase(entry->position);
+        m_placedExtents.erase(entry->extentPosition);
+        entry->isPlaced = false;
+        AddUnplaced(entry);
+    }
+}
+
+std::vector<AnchorCandidateIndex::Entry*> AnchorCandidateIndex::PlacedEntries(float nearEdge, float farEdge) const
+{
+    std::vector<Entry*> entries;
+
+    for (auto it = m_placedEntries.lower_bound(nearEdge - MaxExtent()); it != m_placedEntries.end() && it->first <= farEdge; ++it)
+    {
+        const auto entry = it->second;
+        if (it->first + Extent(entry->bounds) >= nearEdge)
+        {
+            entries.push_back(entry);
+        }
+    }
+
+    return entries;
+}
+
+std::vector<AnchorCandidateIndex::Entry*> AnchorCandidateIndex::AllEntries() const
+{
+    std::vector<Entry*> entries;
+    entries.reserve(m_entries.size());
+
+    for (const auto& pair : m_entries)
+    {
+        entries.push_back(pair.second.get());
+    }
+
+    return entries;
+}
+
+void AnchorCandidateIndex::AddUnplaced(Entry* entry)
+{
+    if (entry->unplacedSlot == -1)
+    {
+        entry->unplacedSlot = static_cast<int>(m_unplacedEntries.size());
+        m_unplacedEntries.push_back(entry);
+    }
+}
+
+void AnchorCandidateIndex::RemoveUnplaced(Entry* entry)
+{
+    const int slot = entry->unplacedSlot;
+    if (slot != -1)
+    {
+        // Swap with the last one so that removal is O(1).
+        const auto last = m_unplacedEntries.back();
+        m_unplacedEntries[slot] = last;
+        last->unplacedSlot = slot;
+        m_unplacedEntries.pop_back();
+        entry->unplacedSlot = -1;
+    }
+}
+
+float AnchorCandidateIndex::NearEdge(const winrt::Rect& bounds) const
+{
+    return m_isVertical ? bounds.Y : bounds.X;
+}
+
+float AnchorCandidateIndex::Extent(const winrt::Rect& bounds) const
+{
+    return m_isVertical ? bounds.Height : bounds.Width;
+}
+
+float AnchorCandidateIndex::MaxExtent() const
+{
+    return m_placedExtents.empty() ? 0.0f : *m_placedExtents.rbegin();
+}
@@ -0,0 +1,69 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <set>
+
+// The Scroller's registered anchor candidates along with their Content relative bounds as of the last time they
+// were evaluated. Candidates with known bounds are kept sorted by their near edge along one axis, so the ones
+// that may intersect the viewport can be found without computing the bounds of all of them.
+class AnchorCandidateIndex
+{
+public:
+    struct Entry
+    {
+        Entry(const ITrackerHandleManager* owner, const winrt::UIElement& value, uint64_t sequence);
+
+        tracker_ref<winrt::UIElement> element;
+        // Registration order, used to pick the same candidate as a walk through all of them when distances are equal.
+        uint64_t sequence{ 0 };
+        winrt::Rect bounds{};
+
+    private:
+        friend class AnchorCandidateIndex;
+
+        bool isPlaced{ false };
+        std::multimap<float, Entry*>::iterator position{};
+        std::multiset<float>::iterator extentPosition{};
+        int unplacedSlot{ -1 };
+    };
+
+    AnchorCandidateIndex(const ITrackerHandleManager* owner);
+
+    bool Add(const winrt::UIElement& element);
+    bool Remove(const winrt::UIElement& element);
+    void Clear();
+    size_t Size() const { return m_entries.size(); }
+
+    // Forgets the bounds of all candidates and sorts them along the given axis from now on.
+    void Reset(bool isVertical);
+    bool IsVertical() const { return m_isVertical; }
+
+    // Records the bounds of a candidate, or forgets them when the candidate is not a valid anchor.
+    void Place(Entry* entry, const winrt::Rect& bounds);
+    void Unplace(Entry* entry);
+
+    // Candidates whose bounds are not known, they were registered or invalid since they were last evaluated.
+    std::vector<Entry*> UnplacedEntries() const { return m_unplacedEntries; }
+    // Candidates whose recorded bounds overlap [nearEdge, farEdge] along the sorting axis.
+    std::vector<Entry*> PlacedEntries(float nearEdge, float farEdge) const;
+    std::vector<Entry*> AllEntries() const;
+
+private:
+    void AddUnplaced(Entry* entry);
+    void RemoveUnplaced(Entry* entry);
+    float NearEdge(const winrt::Rect& bounds) const;
+    float Extent(const winrt::Rect& bounds) const;
+    float MaxExtent() const;
+
+    const ITrackerHandleManager* m_owner{ nullptr };
+    std::unordered_map<void*, std::unique_ptr<Entry>> m_entries;
+    std::multimap<float, Entry*> m_placedEntries;
+    std::vector<Entry*> m_unplacedEntries;
+    // Extents of the placed candidates. The largest one bounds how far before the viewport a candidate can
+    // start and still overlap it.
+    std::multiset<float> m_placedExtents;
+    bool m_isVertical{ true };
+    uint64_t m_nextSequence{ 0 };
+};
@@ -653,6 +653,8 @@ winrt::Size Scroller::MeasureOverride(winrt::Size const& availableSize)
 
         content.Measure(contentAvailableSize);
         contentDesiredSize = content.DesiredSize();
+
+        m_isContentMeasuredSinceArrange = true;
     }
 
     // The framework determines that this Scroller is scrollable when unclippedDesiredSize.Width/Height > desiredSize.Width/Height
@@ -921,6 +923,15 @@ winrt::Size Scroller::ArrangeOverride(winrt::Size const& finalSize)
         }
 
         renderSizeChanged = content.RenderSize() != oldRenderSize;
+
+        if (m_isContentMeasuredSinceArrange || renderSizeChanged)
+        {
+            // The Content laid out again, anchor candidates may have moved anywhere within it, including into
+            // the viewport. The anchor selection above ran before this arrange, so it's the next one that
+            // has to evaluate all of them.
+            m_isAnchorCandidateIndexStale = true;
+            m_isContentMeasuredSinceArrange = false;
+        }
     }
 
     // Set a rectangular clip on this Scroller the same size as the arrange
@@ -1497,15 +1508,7 @@ double Scroller::ComputeValueAfterSnapPoints(
     double value,
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet)
 {
-    for (std::shared_ptr<SnapPointWrapper<T>> snapPointWrapper : snapPointsSet)
-    {
-        if (std::get<0>(snapPointWrapper->ActualApplicableZone()) <= value &&
-            std::get<1>(snapPointWrapper->ActualApplicableZone()) >= value)
-        {
-            return snapPointWrapper->Evaluate(static_cast<float>(value));
-        }
-    }
-    return value;
+    return GetSnapPointInertiaModifiers(&snapPointsSet).Evaluate(value);
 }
 
 // Returns the zooming center point for mouse-wheel-triggered zooming
@@ -1953,6 +1956,14 @@ void Scroller::SetupSnapPoints(
         EnsureInteractionTracker();
     }
 
+    SnapPointInertiaModifiers<T>& snapPointInertiaModifiers = GetSnapPointInertiaModifiers(snapPointsSet);
+
+    // Regroup runs of irregular snap points into zone tables before their zones are evaluated.
+    snapPointInertiaModifiers.Build(*snapPointsSet);
+
+    // Update the regular and impulse actual applicable ranges.
+    UpdateSnapPointsRanges(snapPointsSet, false /*forImpulseOnly*/);
+
     if (m_state == winrt::InteractionState::Idle)
     {
         const double ignoredValue = [this, dimension]()
@@ -1973,14 +1984,13 @@ void Scroller::SetupSnapPoints(
 
         // When snap points are changed while in the Idle State, update
         // ignored snapping values for any potential start of an impulse inertia.
-        UpdateSnapPointsIgnoredValue(snapPointsSet, ignoredValue);
+        if (UpdateSnapPointsIgnoredValue(snapPointsSet, ignoredValue))
+        {
+            UpdateSnapPointsRanges(snapPointsSet, true /*forImpulseOnly*/);
+        }
     }
 
-    // Update the regular and impulse actual applicable ranges.
-    UpdateSnapPointsRanges(snapPointsSet, false /*forImpulseOnly*/);
-
-    winrt::Compositor compositor = m_interactionTracker.Compositor();
-    winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = nullptr;
 
     winrt::hstring target = L"";
     winrt::hstring scale = L"";
@@ -2012,6 +2022,7 @@ void Scroller::SetupSnapPoints(
     // For older versions of windows the interaction tracker cannot accept empty collections of inertia modifiers
     if (snapPointsSet->size() == 0)
     {
+        winrt::Compositor compositor = m_interactionTracker.Compositor();
         winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
         winrt::ExpressionAnimation conditionExpressionAnimation = compositor.CreateExpressionAnimation(L"false");
         winrt::ExpressionAnimation restingPointExpressionAnimation = compositor.CreateExpressionAnimation(L"this.Target." + target);
@@ -2019,20 +2030,16 @@ void Scroller::SetupSnapPoints(
         modifier.Condition(conditionExpressionAnimation);
         modifier.RestingValue(restingPointExpressionAnimation);
 
+        modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
         modifiers.Append(modifier);
     }
     else
     {
-        for (auto snapPointWrapper : *snapPointsSet)
-        {
-            winrt::InteractionTrackerInertiaRestingValue modifier = GetInertiaRestingValue(
-                snapPointWrapper,
-                compositor,
-                target,
-                scale);
-
-            modifiers.Append(modifier);
-        }
+        modifiers = snapPointInertiaModifiers.CreateModifiers(
+            m_interactionTracker,
+            target,
+            scale,
+            IsInertiaFromImpulse());
     }
 
     switch (dimension)
@@ -2095,6 +2102,8 @@ void Scroller::UpdateSnapPointsRanges(
             nullptr,
             forImpulseOnly);
     }
+
+    GetSnapPointInertiaModifiers(snapPointsSet).UpdateZones();
 }
 
 template <typename T>
@@ -2123,19 +2132,9 @@ void Scroller::UpdateSnapPointsIgnoredValue(
         // The ignored snap point value has changed.
         UpdateSnapPointsRanges(snapPointsSet, true /*forImpulseOnly*/);
 
-        winrt::Compositor compositor = m_interactionTracker.Compositor();
-        winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
-
-        for (auto snapPointWrapper : *snapPointsSet)
-        {
-            auto modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
-            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse();
-
-            modifier.Condition(conditionExpressionAnimation);
-            modifier.RestingValue(restingValueExpressionAnimation);
-
-            modifiers.Append(modifier);
-        }
+        // Only the zone tables containing the old or new ignored snap point, or their neighbors, get their parameters updated.
+        winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = GetSnapPointInertiaModifiers(snapPointsSet).GetUpdatedModifiersForImpulse(
+            m_interactionTracker.Compositor());
 
         switch (dimension)
         {
@@ -2186,14 +2185,10 @@ bool Scroller::UpdateSnapPointsIgnoredValue(
 
     if (snapCount > 1)
     {
-        for (auto snapPointWrapper : *snapPointsSet)
+        if (SnapPointWrapper<T>* snapPointWrapper = GetSnapPointInertiaModifiers(snapPointsSet).FindSnappingSnapPoint(newIgnoredValue))
         {
-            if (snapPointWrapper->SnapsAt(newIgnoredValue))
-            {
-                snapPointWrapper->SetIgnoredValue(newIgnoredValue);
-                ignoredValueUpdated = true;
-                break;
-            }
+            snapPointWrapper->SetIgnoredValue(newIgnoredValue);
+            ignoredValueUpdated = true;
         }
     }
 
@@ -2210,19 +2205,9 @@ void Scroller::UpdateSnapPointsInertiaFromImpulse(
 
     if (snapPointsSet->size() > 0)
     {
-        winrt::Compositor compositor = m_interactionTracker.Compositor();
-        winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
-
-        for (auto snapPointWrapper : *snapPointsSet)
-        {
-            auto modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
-            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse(isInertiaFromImpulse);
-
-            modifier.Condition(conditionExpressionAnimation);
-            modifier.RestingValue(restingValueExpressionAnimation);
-
-            modifiers.Append(modifier);
-        }
+        winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = GetSnapPointInertiaModifiers(snapPointsSet).GetUpdatedModifiersForImpulse(
+            m_interactionTracker.Compositor(),
+            isInertiaFromImpulse);
 
         switch (dimension)
         {
@@ -5294,6 +5279,9 @@ void Scroller::UpdateContent(
 
     UnhookContentPropertyChanged(oldContent);
 
+    // The known anchor candidate bounds are relative to the old content.
+    m_anchorCandidateIndex.Reset(m_anchorCandidateIndex.IsVertical());
+
     if (newContent)
     {
         children.Append(newContent);
@@ -5436,6 +5424,7 @@ void Scroller::UpdateState(
     if (state != m_state)
     {
         m_state = state;
+        MUX_TRACE_EVENT(ScrollerStateChanged, this, static_cast<int32_t>(state));
         RaiseStateChanged();
     }
 }
@@ -5740,6 +5729,8 @@ void Scroller::OnViewChanged(bool horizontalOffsetChanged, bool verticalOffsetCh
 
     UpdateScrollAutomationPatternProperties();
 
+    MUX_TRACE_EVENT(ScrollerViewChanged, this, 0, 0,
+        static_cast<float>(m_zoomedHorizontalOffset), static_cast<float>(m_zoomedVerticalOffset), m_zoomFactor);
     RaiseViewChanged();
 }
 
@@ -7005,6 +6996,7 @@ void Scroller::CompleteViewChange(
         interactionTrackerAsyncOperation.get(), TypeLogging::ScrollerViewChangeResultToString(result).c_str());
 
     interactionTrackerAsyncOperation->SetIsCompleted(true);
+    MUX_TRACE_EVENT(ScrollerViewChangeCompleted, this, interactionTrackerAsyncOperation->GetViewChangeId(), static_cast<int32_t>(result));
 
     bool onHorizontalOffsetChangeCompleted = false;
     bool onVerticalOffsetChangeCompleted = false;
@@ -7403,22 +7395,20 @@ std::shared_ptr<InteractionTrackerAsyncOperation> Scroller::GetInteractionTracke
     return nullptr;
 }
 
-template <typename T>
-winrt::InteractionTrackerInertiaRestingValue Scroller::GetInertiaRestingValue(
-    std::shared_ptr<SnapPointWrapper<T>> snapPointWrapper,
-    winrt::Compositor const& compositor,
-    winrt::hstring const& target,
-    winrt::hstring const& scale) const
+SnapPointInertiaModifiers<winrt::ScrollSnapPointBase>& Scroller::GetSnapPointInertiaModifiers(
+    std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> const* snapPointsSet)
 {
-    bool isInertiaFromImpulse = IsInertiaFromImpulse();
-    winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
-    winrt::ExpressionAnimation conditionExpressionAnimation = snapPointWrapper->CreateConditionalExpression(m_interactionTracker, target, scale, isInertiaFromImpulse);
-    winrt::ExpressionAnimation restingPointExpressionAnimation = snapPointWrapper->CreateRestingPointExpression(m_interactionTracker, target, scale, isInertiaFromImpulse);
+    MUX_ASSERT(snapPointsSet == &m_sortedConsolidatedHorizontalSnapPoints || snapPointsSet == &m_sortedConsolidatedVerticalSnapPoints);
 
-    modifier.Condition(conditionExpressionAnimation);
-    modifier.RestingValue(restingPointExpressionAnimation);
+    return snapPointsSet == &m_sortedConsolidatedHorizontalSnapPoints ? m_horizontalSnapPointInertiaModifiers : m_verticalSnapPointInertiaModifiers;
+}
+
+SnapPointInertiaModifiers<winrt::ZoomSnapPointBase>& Scroller::GetSnapPointInertiaModifiers(
+    std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> const* snapPointsSet)
+{
+    MUX_ASSERT(snapPointsSet == &m_sortedConsolidatedZoomSnapPoints);
 
-    return modifier;
+    return m_zoomSnapPointInertiaModifiers;
 }
 
 // Relies on InteractionTracker.IsInertiaFromImpulse starting with RS5,
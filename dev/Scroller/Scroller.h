@@ -12,6 +12,7 @@
 #include "ScrollerBringingIntoViewEventArgs.h"
 #include "ScrollerAnchorRequestedEventArgs.h"
 #include "SnapPointWrapper.h"
+#include "AnchorCandidateIndex.h"
 #include "ScrollerTrace.h"
 #include "ViewChange.h"
 #include "OffsetsChange.h"
@@ -247,6 +248,11 @@ public:
     SnapPointWrapper<winrt::ScrollSnapPointBase>* GetScrollSnapPointWrapper(ScrollerDimension dimension, winrt::ScrollSnapPointBase const& scrollSnapPoint);
     SnapPointWrapper<winrt::ZoomSnapPointBase>* GetZoomSnapPointWrapper(winrt::ZoomSnapPointBase const& zoomSnapPoint);
 
+    SnapPointInertiaModifiers<winrt::ScrollSnapPointBase> const& GetHorizontalSnapPointInertiaModifiers() const
+    {
+        return m_horizontalSnapPointInertiaModifiers;
+    }
+
     // Invoked when a dependency property of this Scroller has changed.
     void OnPropertyChanged(
         const winrt::DependencyPropertyChangedEventArgs& args);
@@ -514,11 +520,10 @@ private:
     std::shared_ptr<InteractionTrackerAsyncOperation> GetInteractionTrackerOperationWithAdditionalVelocity(
         bool isOperationTypeForOffsetsChange,
         InteractionTrackerAsyncOperationTrigger operationTrigger) const;
-    template <typename T> winrt::InteractionTrackerInertiaRestingValue GetInertiaRestingValue(
-        std::shared_ptr<SnapPointWrapper<T>> snapPointWrapper,
-        winrt::Compositor const& compositor,
-        winrt::hstring const& target,
-        winrt::hstring const& scale) const;
+    SnapPointInertiaModifiers<winrt::ScrollSnapPointBase>& GetSnapPointInertiaModifiers(
+        std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> const* snapPointsSet);
+    SnapPointInertiaModifiers<winrt::ZoomSnapPointBase>& GetSnapPointInertiaModifiers(
+        std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> const* snapPointsSet);
 
 #ifdef USE_SCROLLMODE_AUTO
     winrt::ScrollMode GetComputedScrollMode(ScrollerDimension dimension, bool ignoreZoomMode = false);
@@ -723,6 +728,19 @@ private:
         _Inout_ double* bestAnchorCandidateDistance,
         _Inout_ winrt::UIElement* bestAnchorCandidate,
         _Inout_ winrt::Rect* bestAnchorCandidateBounds) const;
+    void ProcessIndexedAnchorCandidates(
+        const winrt::UIElement& content,
+        const winrt::Rect& viewportAnchorBounds,
+        double viewportAnchorPointHorizontalOffset,
+        double viewportAnchorPointVerticalOffset,
+        _Inout_ double* bestAnchorCandidateDistance,
+        _Inout_ winrt::UIElement* bestAnchorCandidate,
+        _Inout_ winrt::Rect* bestAnchorCandidateBounds);
+
+    static double ComputeAnchorCandidateDistance(
+        const winrt::Rect& anchorCandidateBounds,
+        double viewportAnchorPointHorizontalOffset,
+        double viewportAnchorPointVerticalOffset);
 
     static winrt::Rect GetDescendantBounds(
         const winrt::UIElement& content,
@@ -789,6 +807,8 @@ private:
     bool m_horizontalSnapPointsNeedViewportUpdates{ false }; // True when at least one horizontal snap point is not near aligned.
     bool m_verticalSnapPointsNeedViewportUpdates{ false }; // True when at least one vertical snap point is not near aligned.
     bool m_isAnchorElementDirty{ true }; // False when m_anchorElement is up-to-date, True otherwise.
+    bool m_isAnchorCandidateIndexStale{ true }; // True when the Content may have laid out again since all the anchor candidates were last evaluated.
+    bool m_isContentMeasuredSinceArrange{ false }; // True when the Content was measured and its next arrange may move the anchor candidates.
     bool m_isInertiaFromImpulse{ false }; // Only used on pre-RS5 versions, as a replacement for the InteractionTracker.IsInertiaFromImpulse property.
 
     // Display information used for mouse-wheel scrolling on pre-RS5 Windows versions.
@@ -809,6 +829,8 @@ private:
     tracker_ref<winrt::UIElement> m_anchorElement{ this };
     tracker_ref<winrt::ScrollerAnchorRequestedEventArgs> m_anchorRequestedEventArgs{ this };
     std::vector<tracker_ref<winrt::UIElement>> m_anchorCandidates;
+    // Same candidates as m_anchorCandidates, sorted by their last known bounds.
+    AnchorCandidateIndex m_anchorCandidateIndex{ this };
     std::list<std::shared_ptr<InteractionTrackerAsyncOperation>> m_interactionTrackerAsyncOperations;
     winrt::Rect m_anchorElementBounds{};
     winrt::InteractionState m_state{ winrt::InteractionState::Idle };
@@ -888,6 +910,9 @@ private:
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedHorizontalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedVerticalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> m_sortedConsolidatedZoomSnapPoints{};
+    SnapPointInertiaModifiers<winrt::ScrollSnapPointBase> m_horizontalSnapPointInertiaModifiers{};
+    SnapPointInertiaModifiers<winrt::ScrollSnapPointBase> m_verticalSnapPointInertiaModifiers{};
+    SnapPointInertiaModifiers<winrt::ZoomSnapPointBase> m_zoomSnapPointInertiaModifiers{};
 
     // Maximum difference for offsets to be considered equal. Used for pointer wheel scrolling.
     static constexpr float s_offsetEqualityEpsilon{ 0.00001f };
@@ -284,6 +284,7 @@ void Scroller::ClearAnchorCandidates()
     SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
     m_anchorCandidates.clear();
+    m_anchorCandidateIndex.Clear();
     m_isAnchorElementDirty = true;
 }
 
@@ -388,20 +389,14 @@ void Scroller::EnsureAnchorElementSelection()
     }
     else
     {
-        for (tracker_ref<winrt::UIElement> anchorCandidateTracker : m_anchorCandidates)
-        {
-            const winrt::UIElement anchorCandidate = anchorCandidateTracker.get();
-
-            ProcessAnchorCandidate(
-                anchorCandidate,
-                content,
-                viewportAnchorBounds,
-                viewportAnchorPointHorizontalOffset,
-                viewportAnchorPointVerticalOffset,
-                &bestAnchorCandidateDistance,
-                &bestAnchorCandidate,
-                &bestAnchorCandidateBounds);
-        }
+        ProcessIndexedAnchorCandidates(
+            content,
+            viewportAnchorBounds,
+            viewportAnchorPointHorizontalOffset,
+            viewportAnchorPointVerticalOffset,
+            &bestAnchorCandidateDistance,
+            &bestAnchorCandidate,
+            &bestAnchorCandidateBounds);
     }
 
     if (bestAnchorCandidate)
@@ -447,27 +442,148 @@ void Scroller::ProcessAnchorCandidate(
         return;
     }
 
-    // Using the distances from the viewport anchor point to the four corners of the anchor candidate.
+    const double anchorCandidateDistance = ComputeAnchorCandidateDistance(
+        anchorCandidateBounds,
+        viewportAnchorPointHorizontalOffset,
+        viewportAnchorPointVerticalOffset);
+
+    if (anchorCandidateDistance <= *bestAnchorCandidateDistance)
+    {
+        *bestAnchorCandidate = anchorCandidate;
+        *bestAnchorCandidateBounds = anchorCandidateBounds;
+        *bestAnchorCandidateDistance = anchorCandidateDistance;
+    }
+}
+
+// Same as calling ProcessAnchorCandidate for all registered candidates, but only computes the bounds of the candidates
+// that overlapped the viewport the last time they were evaluated, plus the ones that were never evaluated.
+// When the Content laid out again since the last full evaluation, or one of those candidates moved, all the
+// recorded bounds are refreshed.
+void Scroller::ProcessIndexedAnchorCandidates(
+    const winrt::UIElement& content,
+    const winrt::Rect& viewportAnchorBounds,
+    double viewportAnchorPointHorizontalOffset,
+    double viewportAnchorPointVerticalOffset,
+    _Inout_ double* bestAnchorCandidateDistance,
+    _Inout_ winrt::UIElement* bestAnchorCandidate,
+    _Inout_ winrt::Rect* bestAnchorCandidateBounds)
+{
+    MUX_ASSERT(content);
+
+    // Sort along the anchoring direction, preferring the vertical one when anchoring in both.
+    const bool isVertical = !isnan(viewportAnchorPointVerticalOffset);
+
+    if (m_anchorCandidateIndex.IsVertical() != isVertical)
+    {
+        m_anchorCandidateIndex.Reset(isVertical);
+    }
+
+    const float viewportNearEdge = isVertical ? viewportAnchorBounds.Y : viewportAnchorBounds.X;
+    const float viewportFarEdge = viewportNearEdge + (isVertical ? viewportAnchorBounds.Height : viewportAnchorBounds.Width);
+    uint64_t bestAnchorCandidateSequence = 0;
+    bool hasMovedAnchorCandidate = false;
+    bool hasOverlappingAnchorCandidate = false;
+
+    auto processEntry = [&](AnchorCandidateIndex::Entry* entry, bool isPlaced)
+    {
+        const winrt::UIElement anchorCandidate = entry->element.get();
+
+        if (!IsElementValidAnchor(anchorCandidate, content))
+        {
+            // Invalid candidates are looked at again on every evaluation, they may become valid without moving.
+            m_anchorCandidateIndex.Unplace(entry);
+            return;
+        }
+
+        const winrt::Rect anchorCandidateBounds = GetDescendantBounds(content, anchorCandidate);
+
+        if (isPlaced && anchorCandidateBounds != entry->bounds)
+        {
+            hasMovedAnchorCandidate = true;
+        }
+
+        m_anchorCandidateIndex.Place(entry, anchorCandidateBounds);
+
+        if (!SharedHelpers::DoRectsIntersect(viewportAnchorBounds, anchorCandidateBounds))
+        {
+            // Ignore candidates that do not intersect with the viewport in order to favor those that do.
+            return;
+        }
+
+        hasOverlappingAnchorCandidate = true;
+
+        const double anchorCandidateDistance = ComputeAnchorCandidateDistance(
+            anchorCandidateBounds,
+            viewportAnchorPointHorizontalOffset,
+            viewportAnchorPointVerticalOffset);
+
+        // On ties, pick the candidate that was registered last like a walk through m_anchorCandidates would.
+        if (anchorCandidateDistance < *bestAnchorCandidateDistance ||
+            (anchorCandidateDistance == *bestAnchorCandidateDistance && (!*bestAnchorCandidate || entry->sequence > bestAnchorCandidateSequence)))
+        {
+            *bestAnchorCandidate = anchorCandidate;
+            *bestAnchorCandidateBounds = anchorCandidateBounds;
+            *bestAnchorCandidateDistance = anchorCandidateDistance;
+            bestAnchorCandidateSequence = entry->sequence;
+        }
+    };
+
+    if (!m_isAnchorCandidateIndexStale)
+    {
+        for (const auto entry : m_anchorCandidateIndex.PlacedEntries(viewportNearEdge, viewportFarEdge))
+        {
+            processEntry(entry, true /*isPlaced*/);
+        }
+
+        for (const auto entry : m_anchorCandidateIndex.UnplacedEntries())
+        {
+            processEntry(entry, false /*isPlaced*/);
+        }
+    }
+
+    if (m_isAnchorCandidateIndexStale || hasMovedAnchorCandidate || (!hasOverlappingAnchorCandidate && m_anchorCandidateIndex.Size() > 0))
+    {
+        // Candidates outside of the viewport may have moved into it, evaluate all of them.
+        SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_INT, METH_NAME, this, static_cast<int>(m_anchorCandidateIndex.Size()));
+
+        *bestAnchorCandidate = nullptr;
+        *bestAnchorCandidateBounds = winrt::Rect{};
+        *bestAnchorCandidateDistance = std::numeric_limits<float>::max();
+
+        for (const auto entry : m_anchorCandidateIndex.AllEntries())
+        {
+            processEntry(entry, false /*isPlaced*/);
+        }
+
+        m_isAnchorCandidateIndexStale = false;
+    }
+}
+
+// Uses the distances from the viewport anchor point to the four corners of the anchor candidate.
+double Scroller::ComputeAnchorCandidateDistance(
+    const winrt::Rect& anchorCandidateBounds,
+    double viewportAnchorPointHorizontalOffset,
+    double viewportAnchorPointVerticalOffset)
+{
     double anchorCandidateDistance{ 0.0 };
 
     if (!isnan(viewportAnchorPointHorizontalOffset))
     {
-        anchorCandidateDistance += std::pow(viewportAnchorPointHorizontalOffset - anchorCandidateBounds.X, 2);
-        anchorCandidateDistance += std::pow(viewportAnchorPointHorizontalOffset - (anchorCandidateBounds.X + anchorCandidateBounds.Width), 2);
+        const double nearDistance = viewportAnchorPointHorizontalOffset - anchorCandidateBounds.X;
+        const double farDistance = viewportAnchorPointHorizontalOffset - (anchorCandidateBounds.X + anchorCandidateBounds.Width);
+
+        anchorCandidateDistance += nearDistance * nearDistance + farDistance * farDistance;
     }
 
     if (!isnan(viewportAnchorPointVerticalOffset))
     {
-        anchorCandidateDistance += std::pow(viewportAnchorPointVerticalOffset - anchorCandidateBounds.Y, 2);
-        anchorCandidateDistance += std::pow(viewportAnchorPointVerticalOffset - (anchorCandidateBounds.Y + anchorCandidateBounds.Height), 2);
-    }
+        const double nearDistance = viewportAnchorPointVerticalOffset - anchorCandidateBounds.Y;
+        const double farDistance = viewportAnchorPointVerticalOffset - (anchorCandidateBounds.Y + anchorCandidateBounds.Height);
 
-    if (anchorCandidateDistance <= *bestAnchorCandidateDistance)
-    {
-        *bestAnchorCandidate = anchorCandidate;
-        *bestAnchorCandidateBounds = anchorCandidateBounds;
-        *bestAnchorCandidateDistance = anchorCandidateDistance;
+        anchorCandidateDistance += nearDistance * nearDistance + farDistance * farDistance;
     }
+
+    return anchorCandidateDistance;
 }
 
 // Returns the bounds of a Scroller.Content descendant in respect to that content.
@@ -125,8 +125,11 @@ void Scroller::RegisterAnchorCandidate(winrt::UIElement const& element)
         }
 #endif // _DEBUG
 
-        m_anchorCandidates.push_back(tracker_ref<winrt::UIElement>{ this, element });
-        m_isAnchorElementDirty = true;
+        if (m_anchorCandidateIndex.Add(element))
+        {
+            m_anchorCandidates.push_back(tracker_ref<winrt::UIElement>{ this, element });
+            m_isAnchorElementDirty = true;
+        }
     }
 }
 
@@ -139,6 +142,12 @@ void Scroller::UnregisterAnchorCandidate(winrt::UIElement const& element)
         throw winrt::hresult_error(E_INVALIDARG);
     }
 
+    if (!m_anchorCandidateIndex.Remove(element))
+    {
+        // Not a registered candidate, no need to look for it.
+        return;
+    }
+
     const winrt::UIElement anchorCandidate = element;
     const auto it = std::find_if(m_anchorCandidates.cbegin(), m_anchorCandidates.cend(), [&anchorCandidate](const tracker_ref<winrt::UIElement>& a) { return a.get() == anchorCandidate; });
     if (it != m_anchorCandidates.cend())
@@ -1932,3 +1932,243 @@ double RepeatedZoomSnapPoint::Evaluate(
     }
     return value;
 }
+
+/////////////////////////////////////////////////////////////////////
+/////////////////    Snap Point Zone Tables    //////////////////////
+/////////////////////////////////////////////////////////////////////
+
+SnapPointZoneTable::SnapPointZoneTable(size_t size)
+    : m_zones(size)
+{
+    MUX_ASSERT(size > 0);
+}
+
+size_t SnapPointZoneTable::Size() const
+{
+    return m_zones.size();
+}
+
+const SnapPointZoneTable::Zone& SnapPointZoneTable::ZoneAt(size_t index) const
+{
+    return m_zones[index];
+}
+
+void SnapPointZoneTable::SetZone(size_t index, const Zone& zone)
+{
+    Zone& currentZone = m_zones[index];
+
+    if (m_restingValueExpressionAnimation &&
+        (currentZone.impulseMin != zone.impulseMin || currentZone.impulseMax != zone.impulseMax))
+    {
+        // Remember which impulse bounds changed so that UpdateExpressionAnimationsForImpulse only sets their parameters.
+        m_updatedImpulseZones.push_back(index);
+    }
+
+    currentZone = zone;
+}
+
+std::tuple<double, double> SnapPointZoneTable::ApplicableZone(bool forImpulse) const
+{
+    return forImpulse ?
+        std::make_tuple(m_zones.front().impulseMin, m_zones.back().impulseMax) :
+        std::make_tuple(m_zones.front().min, m_zones.back().max);
+}
+
+int SnapPointZoneTable::FindZone(double value, bool forImpulse) const
+{
+    // Zones are sorted and do not overlap, except for shared boundaries which belong to the first zone like
+    // when each snap point had its own inertia modifier.
+    const auto it = std::lower_bound(
+        m_zones.begin(),
+        m_zones.end(),
+        value,
+        [forImpulse](const Zone& zone, double value)
+        {
+            return (forImpulse ? zone.impulseMax : zone.max) < value;
+        });
+
+    if (it != m_zones.end() && (forImpulse ? it->impulseMin : it->min) <= value)
+    {
+        return static_cast<int>(it - m_zones.begin());
+    }
+
+    return -1;
+}
+
+double SnapPointZoneTable::Evaluate(double value) const
+{
+    const int index = FindZone(value, false /*forImpulse*/);
+
+    return index == -1 ? value : m_zones[index].value;
+}
+
+winrt::ExpressionAnimation SnapPointZoneTable::CreateRestingPointExpression(
+    winrt::InteractionTracker const& interactionTracker,
+    winrt::hstring const& target,
+    winrt::hstring const& scale,
+    bool isInertiaFromImpulse)
+{
+    // Unlike the single irregular snap point case, the resting value depends on the impulse mode since it is
+    // determined by the zone that contains the natural resting value.
+    const std::wstring targetExpression = std::wstring(L"this.Target.") + target.c_str();
+    std::wstring expression = GetIsInertiaFromImpulseExpression().c_str();
+
+    expression += L" ? ";
+    expression += GetZoneLookupExpression(0, m_zones.size() - 1, true /*forImpulse*/, targetExpression, scale);
+    expression += L" : ";
+    expression += GetZoneLookupExpression(0, m_zones.size() - 1, false /*forImpulse*/, targetExpression, scale);
+
+    SCROLLER_TRACE_VERBOSE(nullptr, TRACE_MSG_METH_INT, METH_NAME, this, static_cast<int>(m_zones.size()));
+
+    m_restingValueExpressionAnimation = interactionTracker.Compositor().CreateExpressionAnimation(winrt::hstring(expression));
+
+    for (size_t index = 0; index < m_zones.size(); index++)
+    {
+        SetZoneParameters(m_restingValueExpressionAnimation, index, false /*forImpulseOnly*/);
+    }
+
+    m_updatedImpulseZones.clear();
+
+    if (!SharedHelpers::IsRS5OrHigher())
+    {
+        m_restingValueExpressionAnimation.SetBooleanParameter(s_isInertiaFromImpulse, isInertiaFromImpulse);
+    }
+
+    return m_restingValueExpressionAnimation;
+}
+
+winrt::ExpressionAnimation SnapPointZoneTable::CreateConditionalExpression(
+    winrt::InteractionTracker const& interactionTracker,
+    winrt::hstring const& target,
+    winrt::hstring const& scale,
+    bool isInertiaFromImpulse)
+{
+    // The table applies to the whole span of its zones. The natural resting value is returned as is for the gaps
+    // between zones, which makes it a no-op for those.
+    const size_t lastIndex = m_zones.size() - 1;
+    winrt::hstring expression = StringUtil::FormatString(
+        L"%1!s! ? (this.Target.%2!s! >= (%5!s! * %7!s!) && this.Target.%2!s! <= (%6!s! * %7!s!)) : (this.Target.%2!s! >= (%3!s! * %7!s!) && this.Target.%2!s! <= (%4!s! * %7!s!))",
+        GetIsInertiaFromImpulseExpression().data(),
+        target.data(),
+        GetParameterName(s_zoneMin, 0).data(),
+        GetParameterName(s_zoneMax, lastIndex).data(),
+        GetParameterName(s_zoneImpulseMin, 0).data(),
+        GetParameterName(s_zoneImpulseMax, lastIndex).data(),
+        scale.data());
+
+    SCROLLER_TRACE_VERBOSE(nullptr, TRACE_MSG_METH_STR, METH_NAME, this, expression.c_str());
+
+    m_conditionExpressionAnimation = interactionTracker.Compositor().CreateExpressionAnimation(expression);
+
+    m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneMin, 0), static_cast<float>(m_zones.front().min));
+    m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneMax, lastIndex), static_cast<float>(m_zones.back().max));
+    m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMin, 0), static_cast<float>(m_zones.front().impulseMin));
+    m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMax, lastIndex), static_cast<float>(m_zones.back().impulseMax));
+
+    if (!SharedHelpers::IsRS5OrHigher())
+    {
+        m_conditionExpressionAnimation.SetBooleanParameter(s_isInertiaFromImpulse, isInertiaFromImpulse);
+    }
+
+    return m_conditionExpressionAnimation;
+}
+
+// Invoked when the ignored value changed. Only pushes the impulse bounds that changed since the
+// expression animations were created or last updated, and returns True when there were any.
+bool SnapPointZoneTable::UpdateExpressionAnimationsForImpulse()
+{
+    if (m_updatedImpulseZones.empty())
+    {
+        return false;
+    }
+
+    MUX_ASSERT(m_conditionExpressionAnimation);
+    MUX_ASSERT(m_restingValueExpressionAnimation);
+
+    for (const size_t index : m_updatedImpulseZones)
+    {
+        SetZoneParameters(m_restingValueExpressionAnimation, index, true /*forImpulseOnly*/);
+
+        if (index == 0)
+        {
+            m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMin, index), static_cast<float>(m_zones[index].impulseMin));
+        }
+
+        if (index == m_zones.size() - 1)
+        {
+            m_conditionExpressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMax, index), static_cast<float>(m_zones[index].impulseMax));
+        }
+    }
+
+    m_updatedImpulseZones.clear();
+    return true;
+}
+
+// Invoked on pre-RS5 versions when Scroller::m_isInertiaFromImpulse changed
+// and the 'iIFI' boolean parameters need to be updated.
+void SnapPointZoneTable::UpdateExpressionAnimationsForImpulse(
+    bool isInertiaFromImpulse) const
+{
+    MUX_ASSERT(!SharedHelpers::IsRS5OrHigher());
+
+    m_conditionExpressionAnimation.SetBooleanParameter(s_isInertiaFromImpulse, isInertiaFromImpulse);
+    m_restingValueExpressionAnimation.SetBooleanParameter(s_isInertiaFromImpulse, isInertiaFromImpulse);
+}
+
+// Returns a balanced tree of conditional expressions that evaluates to the scaled value of the zone containing
+// the target, or to the target itself when it falls in a gap, for the zones between firstIndex and lastIndex.
+// The composition expression language has no arrays, so the table is unrolled into log2(zone count) comparisons.
+std::wstring SnapPointZoneTable::GetZoneLookupExpression(
+    size_t firstIndex,
+    size_t lastIndex,
+    bool forImpulse,
+    std::wstring const& targetExpression,
+    winrt::hstring const& scale) const
+{
+    const std::wstring scaleExpression = std::wstring(L" * ") + scale.c_str() + L")";
+    const wstring_view minName = forImpulse ? s_zoneImpulseMin : s_zoneMin;
+    const wstring_view maxName = forImpulse ? s_zoneImpulseMax : s_zoneMax;
+
+    if (firstIndex == lastIndex)
+    {
+        return L"((" + targetExpression + L" >= (" + GetParameterName(minName, firstIndex).c_str() + scaleExpression +
+            L" && " + targetExpression + L" <= (" + GetParameterName(maxName, firstIndex).c_str() + scaleExpression +
+            L") ? (" + GetParameterName(s_zoneValue, firstIndex).c_str() + scaleExpression + L" : " + targetExpression + L")";
+    }
+
+    // Shared boundaries go to the lower zone, like FindZone does.
+    const size_t middleIndex = firstIndex + (lastIndex - firstIndex) / 2;
+
+    return L"(" + targetExpression + L" <= (" + GetParameterName(maxName, middleIndex).c_str() + scaleExpression +
+        L" ? " + GetZoneLookupExpression(firstIndex, middleIndex, forImpulse, targetExpression, scale) +
+        L" : " + GetZoneLookupExpression(middleIndex + 1, lastIndex, forImpulse, targetExpression, scale) + L")";
+}
+
+void SnapPointZoneTable::SetZoneParameters(
+    winrt::ExpressionAnimation const& expressionAnimation,
+    size_t index,
+    bool forImpulseOnly) const
+{
+    const Zone& zone = m_zones[index];
+
+    if (!forImpulseOnly)
+    {
+        expressionAnimation.SetScalarParameter(GetParameterName(s_zoneMin, index), static_cast<float>(zone.min));
+        expressionAnimation.SetScalarParameter(GetParameterName(s_zoneMax, index), static_cast<float>(zone.max));
+        expressionAnimation.SetScalarParameter(GetParameterName(s_zoneValue, index), static_cast<float>(zone.value));
+    }
+
+    expressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMin, index), static_cast<float>(zone.impulseMin));
+    expressionAnimation.SetScalarParameter(GetParameterName(s_zoneImpulseMax, index), static_cast<float>(zone.impulseMax));
+}
+
+winrt::hstring SnapPointZoneTable::GetParameterName(wstring_view const& name, size_t index)
+{
+    return winrt::hstring(std::wstring(name) + std::to_wstring(index));
+}
+
+winrt::hstring SnapPointZoneTable::GetIsInertiaFromImpulseExpression()
+{
+    // Returns 'this.Target.IsInertiaFromImpulse' starting with RS5, and 'iIFI' prior to RS5.
+    return SharedHelpers::IsRS5OrHigher() ? winrt::hstring(L"this.Target.IsInertiaFromImpulse") : winrt::hstring(s_isInertiaFromImpulse);
+}
@@ -527,3 +527,81 @@ private:
     double m_start{ 0.0f };
     double m_end{ 0.0f };
 };
+
+// Applicable zones of a run of consecutive irregular snap points (ScrollSnapPoint or ZoomSnapPoint instances), in snap point order.
+// Each zone snaps to a single value, so the whole run can be handed to the InteractionTracker as a single inertia modifier whose
+// resting value expression locates the zone of the natural resting value with a binary search, instead of using one modifier and
+// two expression animations per snap point. The same lookup is used on the CPU side by FindZone and Evaluate.
+class SnapPointZoneTable
+{
+public:
+    struct Zone
+    {
+        double min{ -INFINITY };
+        double max{ INFINITY };
+        double impulseMin{ -INFINITY };
+        double impulseMax{ INFINITY };
+        double value{ 0.0 };
+    };
+
+    // Returns the maximum number of zones per table. Longer runs of irregular snap points are split into several tables
+    // so that the size of each resting value expression remains bounded.
+    static constexpr size_t MaxZoneCount() { return s_maxZoneCount; }
+
+    SnapPointZoneTable(size_t size);
+
+    size_t Size() const;
+    const Zone& ZoneAt(size_t index) const;
+    void SetZone(size_t index, const Zone& zone);
+    std::tuple<double, double> ApplicableZone(bool forImpulse) const;
+
+    // Returns the index of the first zone containing the provided value, or -1 when the value is outside all zones.
+    int FindZone(double value, bool forImpulse) const;
+    // Returns the value the provided value snaps to, or the value itself when it is outside all the regular zones.
+    double Evaluate(double value) const;
+
+    winrt::ExpressionAnimation CreateRestingPointExpression(
+        winrt::InteractionTracker const& interactionTracker,
+        winrt::hstring const& target,
+        winrt::hstring const& scale,
+        bool isInertiaFromImpulse);
+    winrt::ExpressionAnimation CreateConditionalExpression(
+        winrt::InteractionTracker const& interactionTracker,
+        winrt::hstring const& target,
+        winrt::hstring const& scale,
+        bool isInertiaFromImpulse);
+    bool UpdateExpressionAnimationsForImpulse();
+    void UpdateExpressionAnimationsForImpulse(
+        bool isInertiaFromImpulse) const;
+
+private:
+    std::wstring GetZoneLookupExpression(
+        size_t firstIndex,
+        size_t lastIndex,
+        bool forImpulse,
+        std::wstring const& targetExpression,
+        winrt::hstring const& scale) const;
+    void SetZoneParameters(
+        winrt::ExpressionAnimation const& expressionAnimation,
+        size_t index,
+        bool forImpulseOnly) const;
+
+    static winrt::hstring GetParameterName(wstring_view const& name, size_t index);
+    static winrt::hstring GetIsInertiaFromImpulseExpression();
+
+    std::vector<Zone> m_zones;
+    std::vector<size_t> m_updatedImpulseZones; // Indexes of the zones with impulse bounds not yet pushed to the expression animations.
+    winrt::ExpressionAnimation m_conditionExpressionAnimation{ nullptr };
+    winrt::ExpressionAnimation m_restingValueExpressionAnimation{ nullptr };
+
+    // Each zone adds 5 scalar parameters and a level of conditionals every time the count doubles to the resting value expression.
+    static constexpr size_t s_maxZoneCount{ 32 };
+
+    // Constants used in composition expressions
+    static constexpr wstring_view s_isInertiaFromImpulse{ L"iIFI"sv };
+    static constexpr wstring_view s_zoneMin{ L"zMin"sv };
+    static constexpr wstring_view s_zoneMax{ L"zMax"sv };
+    static constexpr wstring_view s_zoneImpulseMin{ L"zIMin"sv };
+    static constexpr wstring_view s_zoneImpulseMax{ L"zIMax"sv };
+    static constexpr wstring_view s_zoneValue{ L"zVal"sv };
+};
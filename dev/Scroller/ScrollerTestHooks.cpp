@@ -507,6 +507,77 @@ int ScrollerTestHooks::GetZoomSnapPointCombinationCount(
     }
 }
 
+int ScrollerTestHooks::GetHorizontalSnapPointInertiaModifierCount(const winrt::Scroller& scroller)
+{
+    if (scroller)
+    {
+        return static_cast<int>(winrt::get_self<Scroller>(scroller)->GetHorizontalSnapPointInertiaModifiers().Size());
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+double ScrollerTestHooks::GetHorizontalValueAfterSnapPoints(const winrt::Scroller& scroller, double value)
+{
+    if (scroller)
+    {
+        return winrt::get_self<Scroller>(scroller)->GetHorizontalSnapPointInertiaModifiers().Evaluate(value);
+    }
+    else
+    {
+        return value;
+    }
+}
+
+winrt::ScrollSnapPointBase ScrollerTestHooks::GetHorizontalSnappingSnapPoint(const winrt::Scroller& scroller, double value)
+{
+    if (scroller)
+    {
+        if (SnapPointWrapper<winrt::ScrollSnapPointBase>* snapPointWrapper = winrt::get_self<Scroller>(scroller)->GetHorizontalSnapPointInertiaModifiers().FindSnappingSnapPoint(value))
+        {
+            return snapPointWrapper->SnapPoint();
+        }
+    }
+
+    return nullptr;
+}
+
+int ScrollerTestHooks::FindSnapPointZone(winrt::array_view<double const> zones, double value, bool forImpulse)
+{
+    return CreateSnapPointZoneTable(zones).FindZone(value, forImpulse);
+}
+
+double ScrollerTestHooks::EvaluateSnapPointZones(winrt::array_view<double const> zones, double value)
+{
+    return CreateSnapPointZoneTable(zones).Evaluate(value);
+}
+
+SnapPointZoneTable ScrollerTestHooks::CreateSnapPointZoneTable(winrt::array_view<double const> zones)
+{
+    if (zones.size() == 0 || zones.size() % 5 != 0)
+    {
+        throw winrt::hresult_invalid_argument(L"zones must hold 5 values per zone.");
+    }
+
+    SnapPointZoneTable zoneTable(zones.size() / 5);
+
+    for (size_t index = 0; index < zoneTable.Size(); index++)
+    {
+        zoneTable.SetZone(
+            index,
+            SnapPointZoneTable::Zone{
+                zones[static_cast<uint32_t>(index * 5)],
+                zones[static_cast<uint32_t>(index * 5 + 1)],
+                zones[static_cast<uint32_t>(index * 5 + 2)],
+                zones[static_cast<uint32_t>(index * 5 + 3)],
+                zones[static_cast<uint32_t>(index * 5 + 4)] });
+    }
+
+    return zoneTable;
+}
+
 winrt::Color ScrollerTestHooks::GetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint)
 {
 
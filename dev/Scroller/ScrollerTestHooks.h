@@ -96,11 +96,17 @@ public:
     static int GetZoomSnapPointCombinationCount(
         const winrt::Scroller& scroller,
         const winrt::ZoomSnapPointBase& zoomSnapPoint);
+    static int GetHorizontalSnapPointInertiaModifierCount(const winrt::Scroller& scroller);
+    static double GetHorizontalValueAfterSnapPoints(const winrt::Scroller& scroller, double value);
+    static winrt::ScrollSnapPointBase GetHorizontalSnappingSnapPoint(const winrt::Scroller& scroller, double value);
+    static int FindSnapPointZone(winrt::array_view<double const> zones, double value, bool forImpulse);
+    static double EvaluateSnapPointZones(winrt::array_view<double const> zones, double value);
     static winrt::Color GetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint);
     static void SetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint, const winrt::Color& color);
 
 private:
     static winrt::ScrollerViewChangeResult TestHooksViewChangeResult(ScrollerViewChangeResult result);
+    static SnapPointZoneTable CreateSnapPointZoneTable(winrt::array_view<double const> zones);
 
     static com_ptr<ScrollerTestHooks> s_testHooks;
     winrt::event<winrt::TypedEventHandler<winrt::Scroller, winrt::ScrollerTestHooksAnchorEvaluatedEventArgs>> m_anchorEvaluatedEventSource;
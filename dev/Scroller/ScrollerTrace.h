@@ -7,6 +7,7 @@
 #include "TraceLogging.h"
 #include "Utils.h"
 #include "MUXControlsTestHooks.h"
+#include "StructuredTrace.h"
 
 inline bool IsScrollerTracingEnabled()
 {
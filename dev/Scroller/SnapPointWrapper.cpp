@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "SnapPointWrapper.h"
+#include "Vector.h"
 
 template<typename T>
 SnapPointWrapper<T>::SnapPointWrapper(T const& snapPoint)
@@ -30,6 +31,12 @@ std::tuple<double, double> SnapPointWrapper<T>::ActualApplicableZone() const
     return m_actualApplicableZone;
 }
 
+template<typename T>
+std::tuple<double, double> SnapPointWrapper<T>::ActualImpulseApplicableZone() const
+{
+    return m_actualImpulseApplicableZone;
+}
+
 template<typename T>
 int SnapPointWrapper<T>::CombinationCount() const
 {
@@ -205,6 +212,9 @@ template winrt::ZoomSnapPointBase SnapPointWrapper<winrt::ZoomSnapPointBase>::Sn
 template std::tuple<double, double> SnapPointWrapper<winrt::ScrollSnapPointBase>::ActualApplicableZone() const;
 template std::tuple<double, double> SnapPointWrapper<winrt::ZoomSnapPointBase>::ActualApplicableZone() const;
 
+template std::tuple<double, double> SnapPointWrapper<winrt::ScrollSnapPointBase>::ActualImpulseApplicableZone() const;
+template std::tuple<double, double> SnapPointWrapper<winrt::ZoomSnapPointBase>::ActualImpulseApplicableZone() const;
+
 template int SnapPointWrapper<winrt::ScrollSnapPointBase>::CombinationCount() const;
 template int SnapPointWrapper<winrt::ZoomSnapPointBase>::CombinationCount() const;
 
@@ -263,3 +273,249 @@ template bool SnapPointWrapper<winrt::ZoomSnapPointBase>::SnapsAt(double value)
 
 template SnapPointBase* SnapPointWrapper<winrt::ScrollSnapPointBase>::GetSnapPointFromWrapper(std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>> snapPointWrapper);
 template SnapPointBase* SnapPointWrapper<winrt::ZoomSnapPointBase>::GetSnapPointFromWrapper(std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>> snapPointWrapper);
+
+template<typename T>
+void SnapPointInertiaModifiers<T>::Build(std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet)
+{
+    const auto isIrregular = [](std::shared_ptr<SnapPointWrapper<T>> const& snapPointWrapper)
+    {
+        // Irregular snap points are the ones with a tertiary sort value of 0.
+        return SnapPointWrapper<T>::GetSnapPointFromWrapper(snapPointWrapper)->SortPredicate().tertiary == 0;
+    };
+
+    bool isIrregularRun = false;
+
+    m_entries.clear();
+
+    for (auto snapPointWrapper : snapPointsSet)
+    {
+        const bool isSnapPointIrregular = isIrregular(snapPointWrapper);
+
+        if (!isSnapPointIrregular ||
+            !isIrregularRun ||
+            m_entries.back().snapPointWrappers.size() == SnapPointZoneTable::MaxZoneCount())
+        {
+            m_entries.emplace_back();
+        }
+
+        m_entries.back().snapPointWrappers.push_back(snapPointWrapper);
+        isIrregularRun = isSnapPointIrregular;
+    }
+
+    for (auto& entry : m_entries)
+    {
+        // Runs of a single snap point keep using its own expressions.
+        if (entry.snapPointWrappers.size() > 1)
+        {
+            entry.zoneTable = std::make_unique<SnapPointZoneTable>(entry.snapPointWrappers.size());
+        }
+    }
+}
+
+template<typename T>
+void SnapPointInertiaModifiers<T>::UpdateZones()
+{
+    for (auto& entry : m_entries)
+    {
+        if (entry.zoneTable)
+        {
+            for (size_t index = 0; index < entry.snapPointWrappers.size(); index++)
+            {
+                const auto& snapPointWrapper = entry.snapPointWrappers[index];
+                const auto [min, max] = snapPointWrapper->ActualApplicableZone();
+                const auto [impulseMin, impulseMax] = snapPointWrapper->ActualImpulseApplicableZone();
+
+                entry.zoneTable->SetZone(
+                    index,
+                    SnapPointZoneTable::Zone{
+                        min,
+                        max,
+                        impulseMin,
+                        impulseMax,
+                        SnapPointWrapper<T>::GetSnapPointFromWrapper(snapPointWrapper)->SortPredicate().primary });
+            }
+        }
+    }
+}
+
+template<typename T>
+size_t SnapPointInertiaModifiers<T>::Size() const
+{
+    return m_entries.size();
+}
+
+template<typename T>
+double SnapPointInertiaModifiers<T>::Evaluate(double value) const
+{
+    // Entries are sorted and their applicable zones do not overlap, except for shared boundaries.
+    auto it = std::lower_bound(
+        m_entries.begin(),
+        m_entries.end(),
+        value,
+        [](const Entry& entry, double value) { return ApplicableZoneMax(entry) < value; });
+
+    for (; it != m_entries.end() && ApplicableZoneMin(*it) <= value; ++it)
+    {
+        if (!it->zoneTable)
+        {
+            return it->snapPointWrappers.front()->Evaluate(static_cast<float>(value));
+        }
+
+        const int index = it->zoneTable->FindZone(value, false /*forImpulse*/);
+
+        if (index != -1)
+        {
+            return it->zoneTable->ZoneAt(index).value;
+        }
+    }
+
+    return value;
+}
+
+template<typename T>
+SnapPointWrapper<T>* SnapPointInertiaModifiers<T>::FindSnappingSnapPoint(double value) const
+{
+    auto it = std::lower_bound(
+        m_entries.begin(),
+        m_entries.end(),
+        value,
+        [](const Entry& entry, double value) { return ApplicableZoneMax(entry) < value; });
+
+    for (; it != m_entries.end() && ApplicableZoneMin(*it) <= value; ++it)
+    {
+        const int index = it->zoneTable ? it->zoneTable->FindZone(value, false /*forImpulse*/) : 0;
+
+        if (index != -1 && it->snapPointWrappers[index]->SnapsAt(value))
+        {
+            return it->snapPointWrappers[index].get();
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename T>
+winrt::IVector<winrt::InteractionTrackerInertiaModifier> SnapPointInertiaModifiers<T>::CreateModifiers(
+    winrt::InteractionTracker const& interactionTracker,
+    winrt::hstring const& target,
+    winrt::hstring const& scale,
+    bool isInertiaFromImpulse)
+{
+    winrt::Compositor compositor = interactionTracker.Compositor();
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
+
+    for (auto& entry : m_entries)
+    {
+        if (entry.zoneTable)
+        {
+            entry.modifier = CreateModifier(
+                compositor,
+                entry.zoneTable->CreateConditionalExpression(interactionTracker, target, scale, isInertiaFromImpulse),
+                entry.zoneTable->CreateRestingPointExpression(interactionTracker, target, scale, isInertiaFromImpulse));
+        }
+        else
+        {
+            auto& snapPointWrapper = entry.snapPointWrappers.front();
+
+            entry.modifier = CreateModifier(
+                compositor,
+                snapPointWrapper->CreateConditionalExpression(interactionTracker, target, scale, isInertiaFromImpulse),
+                snapPointWrapper->CreateRestingPointExpression(interactionTracker, target, scale, isInertiaFromImpulse));
+        }
+
+        modifiers.Append(entry.modifier);
+    }
+
+    return modifiers;
+}
+
+// Invoked when the ignored value changed and UpdateZones was called with the new impulse zones.
+// Zone tables that are not affected keep their modifier as is.
+template<typename T>
+winrt::IVector<winrt::InteractionTrackerInertiaModifier> SnapPointInertiaModifiers<T>::GetUpdatedModifiersForImpulse(
+    winrt::Compositor const& compositor)
+{
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
+
+    for (auto& entry : m_entries)
+    {
+        if (entry.zoneTable)
+        {
+            if (entry.zoneTable->UpdateExpressionAnimationsForImpulse())
+            {
+                // The modifier captures the expression animations when it is set up, so a new one is needed to pick up the new parameters.
+                entry.modifier = CreateModifier(compositor, entry.modifier.Condition(), entry.modifier.RestingValue());
+            }
+        }
+        else
+        {
+            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = entry.snapPointWrappers.front()->GetUpdatedExpressionAnimationsForImpulse();
+
+            entry.modifier = CreateModifier(compositor, conditionExpressionAnimation, restingValueExpressionAnimation);
+        }
+
+        modifiers.Append(entry.modifier);
+    }
+
+    return modifiers;
+}
+
+// Invoked on pre-RS5 versions when Scroller::m_isInertiaFromImpulse changed
+// and the 'iIFI' boolean parameters need to be updated.
+template<typename T>
+winrt::IVector<winrt::InteractionTrackerInertiaModifier> SnapPointInertiaModifiers<T>::GetUpdatedModifiersForImpulse(
+    winrt::Compositor const& compositor,
+    bool isInertiaFromImpulse)
+{
+    MUX_ASSERT(!SharedHelpers::IsRS5OrHigher());
+
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
+
+    for (auto& entry : m_entries)
+    {
+        if (entry.zoneTable)
+        {
+            entry.zoneTable->UpdateExpressionAnimationsForImpulse(isInertiaFromImpulse);
+            entry.modifier = CreateModifier(compositor, entry.modifier.Condition(), entry.modifier.RestingValue());
+        }
+        else
+        {
+            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = entry.snapPointWrappers.front()->GetUpdatedExpressionAnimationsForImpulse(isInertiaFromImpulse);
+
+            entry.modifier = CreateModifier(compositor, conditionExpressionAnimation, restingValueExpressionAnimation);
+        }
+
+        modifiers.Append(entry.modifier);
+    }
+
+    return modifiers;
+}
+
+template<typename T>
+double SnapPointInertiaModifiers<T>::ApplicableZoneMin(const Entry& entry)
+{
+    return std::get<0>(entry.zoneTable ? entry.zoneTable->ApplicableZone(false /*forImpulse*/) : entry.snapPointWrappers.front()->ActualApplicableZone());
+}
+
+template<typename T>
+double SnapPointInertiaModifiers<T>::ApplicableZoneMax(const Entry& entry)
+{
+    return std::get<1>(entry.zoneTable ? entry.zoneTable->ApplicableZone(false /*forImpulse*/) : entry.snapPointWrappers.back()->ActualApplicableZone());
+}
+
+template<typename T>
+winrt::InteractionTrackerInertiaRestingValue SnapPointInertiaModifiers<T>::CreateModifier(
+    winrt::Compositor const& compositor,
+    winrt::ExpressionAnimation const& conditionExpressionAnimation,
+    winrt::ExpressionAnimation const& restingValueExpressionAnimation)
+{
+    auto modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
+
+    modifier.Condition(conditionExpressionAnimation);
+    modifier.RestingValue(restingValueExpressionAnimation);
+
+    return modifier;
+}
+
+template class SnapPointInertiaModifiers<winrt::ScrollSnapPointBase>;
+template class SnapPointInertiaModifiers<winrt::ZoomSnapPointBase>;
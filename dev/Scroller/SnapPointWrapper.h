@@ -20,6 +20,7 @@ public:
 
     T SnapPoint() const;
     std::tuple<double, double> ActualApplicableZone() const;
+    std::tuple<double, double> ActualImpulseApplicableZone() const;
     int CombinationCount() const;
     bool ResetIgnoredValue();
     void SetIgnoredValue(double ignoredValue);
@@ -73,3 +74,50 @@ struct SnapPointWrapperComparator
         return *leftSnapPoint < rightSnapPoint;
     }
 };
+
+// The inertia modifiers provided to the InteractionTracker for a sorted and consolidated snap points set.
+// Runs of consecutive irregular snap points are collapsed into SnapPointZoneTable instances that use a single modifier each,
+// while repeated snap points keep their own modifier. The entries are in snap point order, which allows snapped values to be
+// evaluated on the CPU side with binary searches.
+template <typename T>
+class SnapPointInertiaModifiers
+{
+public:
+    // Regroups the snap points into entries. Invoked whenever the snap points set changed.
+    void Build(std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet);
+    // Copies the actual applicable zones of the irregular snap points into their zone table.
+    void UpdateZones();
+
+    size_t Size() const;
+    double Evaluate(double value) const;
+    // Returns the first snap point which snaps around the provided value, or nullptr when there is none.
+    SnapPointWrapper<T>* FindSnappingSnapPoint(double value) const;
+
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> CreateModifiers(
+        winrt::InteractionTracker const& interactionTracker,
+        winrt::hstring const& target,
+        winrt::hstring const& scale,
+        bool isInertiaFromImpulse);
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> GetUpdatedModifiersForImpulse(
+        winrt::Compositor const& compositor);
+    winrt::IVector<winrt::InteractionTrackerInertiaModifier> GetUpdatedModifiersForImpulse(
+        winrt::Compositor const& compositor,
+        bool isInertiaFromImpulse);
+
+private:
+    struct Entry
+    {
+        std::vector<std::shared_ptr<SnapPointWrapper<T>>> snapPointWrappers;
+        std::unique_ptr<SnapPointZoneTable> zoneTable;
+        winrt::InteractionTrackerInertiaRestingValue modifier{ nullptr };
+    };
+
+    static double ApplicableZoneMin(const Entry& entry);
+    static double ApplicableZoneMax(const Entry& entry);
+    static winrt::InteractionTrackerInertiaRestingValue CreateModifier(
+        winrt::Compositor const& compositor,
+        winrt::ExpressionAnimation const& conditionExpressionAnimation,
+        winrt::ExpressionAnimation const& restingValueExpressionAnimation);
+
+    std::vector<Entry> m_entries;
+};
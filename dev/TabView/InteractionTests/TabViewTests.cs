@@ -167,6 +167,65 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
             }
         }
 
+        [TestMethod]
+        public void EqualTabWidthForNewTabsTest()
+        {
+            using (var setup = new TestSetupHelper("TabView Tests"))
+            {
+                FindElement.ByName<Button>("SetTabViewWidth").InvokeAndWait();
+
+                Log.Comment("Adding tabs.");
+                Button addTabButton = FindElement.ByName<Button>("Add New Tab");
+                addTabButton.InvokeAndWait();
+                addTabButton.InvokeAndWait();
+
+                ElementCache.Refresh();
+                UIObject firstTab = FindElement.ByName("FirstTab");
+                UIObject newTab = FindElement.ByName("New Tab 2");
+                Verify.IsNotNull(newTab);
+
+                Log.Comment("Tabs realized after the width was computed should get the same width.");
+                int diff = Math.Abs(firstTab.BoundingRectangle.Width - newTab.BoundingRectangle.Width);
+                Verify.IsLessThanOrEqual(diff, 1);
+            }
+        }
+
+        [TestMethod]
+        public void EqualTabWidthAfterThemeAndTemplateChangeTest()
+        {
+            using (var setup = new TestSetupHelper("TabView Tests"))
+            {
+                FindElement.ByName<Button>("SetTabViewWidth").InvokeAndWait();
+
+                UIObject firstTab = FindElement.ByName("FirstTab");
+                int originalWidth = firstTab.BoundingRectangle.Width;
+                Log.Comment("Tab width with the default TabViewItemMaxWidth: " + originalWidth);
+                Verify.IsGreaterThan(originalWidth, 110, "Tabs should start out wider than the max width set below");
+
+                Log.Comment("Lowering TabViewItemMaxWidth and changing the theme.");
+                FindElement.ByName<Button>("SetSmallTabMaxWidthButton").InvokeAndWait();
+                FindElement.ByName<Button>("ChangeTabViewThemeButton").InvokeAndWait();
+
+                Log.Comment("The cached max width should be read again after the theme change.");
+                ElementCache.Refresh();
+                firstTab = FindElement.ByName("FirstTab");
+                UIObject lastTab = FindElement.ByName("LongHeaderTab");
+                Verify.IsLessThanOrEqual(Math.Abs(firstTab.BoundingRectangle.Width - 100), 1);
+                Verify.IsLessThanOrEqual(Math.Abs(lastTab.BoundingRectangle.Width - 100), 1);
+
+                Log.Comment("Restoring TabViewItemMaxWidth and reapplying the template.");
+                FindElement.ByName<Button>("ClearTabMaxWidthButton").InvokeAndWait();
+                FindElement.ByName<Button>("ReapplyTabViewTemplateButton").InvokeAndWait();
+
+                Log.Comment("The cached max width should be read again after the template change.");
+                ElementCache.Refresh();
+                firstTab = FindElement.ByName("FirstTab");
+                lastTab = FindElement.ByName("LongHeaderTab");
+                Verify.IsLessThanOrEqual(Math.Abs(firstTab.BoundingRectangle.Width - originalWidth), 1);
+                Verify.IsLessThanOrEqual(Math.Abs(lastTab.BoundingRectangle.Width - originalWidth), 1);
+            }
+        }
+
         private bool AreScrollButtonsVisible()
         {
             FindElement.ByName<Button>("GetScrollButtonsVisible").InvokeAndWait();
@@ -21,6 +21,12 @@ static constexpr wstring_view c_tabViewItemMaxWidthName{ L"TabViewItemMaxWidth"s
 // TODO: what is the right number and should this be customizable?
 static constexpr double c_scrollAmount = 50.0;
 
+static bool AreTabWidthsEqual(double first, double second)
+{
+    // NaN means the tab sizes to its content
+    return first == second || (std::isnan(first) && std::isnan(second));
+}
+
 TabView::TabView()
 {
     __RP_Marker_ClassById(RuntimeProfiler::ProfId_TabView);
@@ -33,6 +39,11 @@ TabView::TabView()
     Loaded({ this, &TabView::OnLoaded });
     SizeChanged({ this, &TabView::OnSizeChanged });
 
+    if (winrt::IFrameworkElement6 frameworkElement6 = *this)
+    {
+        m_actualThemeChangedRevoker = frameworkElement6.ActualThemeChanged(winrt::auto_revoke, { this, &TabView::OnActualThemeChanged });
+    }
+
     // KeyboardAccelerator is only available on RS3+
     if (SharedHelpers::IsRS3OrHigher())
     {
@@ -79,6 +90,9 @@ void TabView::OnApplyTemplate()
 
     m_shadowReceiver.set(GetTemplateChildT<winrt::Grid>(L"ShadowReceiver", controlProtected));
 
+    // The new template can come with different resources
+    m_tabWidthResourcesValid = false;
+
     m_listView.set([this, controlProtected]() {
         auto listView = GetTemplateChildT<winrt::ListView>(L"TabListView", controlProtected);
         if (listView)
@@ -226,6 +240,26 @@ void TabView::OnLoaded(const winrt::IInspectable&, const winrt::RoutedEventArgs&
     UpdateTabContent();
 }
 
+void TabView::OnActualThemeChanged(const winrt::FrameworkElement&, const winrt::IInspectable&)
+{
+    m_tabWidthResourcesValid = false;
+    UpdateTabWidths();
+}
+
+void TabView::OnContainerContentChanging(const winrt::ContainerContentChangingEventArgs& args)
+{
+    if (!args.InRecycleQueue())
+    {
+        if (auto tvi = args.ItemContainer().try_as<winrt::TabViewItem>())
+        {
+            if (!AreTabWidthsEqual(tvi.Width(), m_tabWidth))
+            {
+                tvi.Width(m_tabWidth);
+            }
+        }
+    }
+}
+
 void TabView::OnListViewLoaded(const winrt::IInspectable&, const winrt::RoutedEventArgs& args)
 {
     if (auto listView = m_listView.get())
@@ -569,14 +603,13 @@ void TabView::UpdateTabWidths()
                 }
                 else if (TabWidthMode() == winrt::TabViewWidthMode::Equal)
                 {
-                    auto const minTabWidth = unbox_value<double>(SharedHelpers::FindResource(c_tabViewItemMinWidthName, winrt::Application::Current().Resources(), box_value(c_tabMinimumWidth)));
-                    auto const maxTabWidth = unbox_value<double>(SharedHelpers::FindResource(c_tabViewItemMaxWidthName, winrt::Application::Current().Resources(), box_value(c_tabMaximumWidth)));
+                    UpdateTabWidthResources();
 
                     // Calculate the proportional width of each tab given the width of the ScrollViewer.
                     auto const padding = Padding();
                     auto const tabWidthForScroller = (availableWidth - (padding.Left + padding.Right)) / (double)(TabItems().Size());
 
-                    tabWidth = std::clamp(tabWidthForScroller, minTabWidth, maxTabWidth);
+                    tabWidth = std::clamp(tabWidthForScroller, m_minTabWidth, m_maxTabWidth);
 
                     // Size tab column to needed size
                     tabColumn.MaxWidth(availableWidth);
@@ -602,22 +635,37 @@ void TabView::UpdateTabWidths()
         }
     }
 
-    for (auto item : TabItems())
+    if (!AreTabWidthsEqual(tabWidth, m_tabWidth))
     {
-        // Set the calculated width on each tab.
-        auto tvi = item.try_as<winrt::TabViewItem>();
-        if (!tvi)
-        {
-            tvi = ContainerFromItem(item).as<winrt::TabViewItem>();
-        }
+        m_tabWidth = tabWidth;
 
-        if (tvi)
+        // Set the calculated width on the realized tabs only, the others get it when they are realized.
+        if (auto listView = m_listView.get())
         {
-            tvi.Width(tabWidth);
+            if (auto panel = listView.ItemsPanelRoot())
+            {
+                for (auto child : panel.Children())
+                {
+                    if (auto tvi = child.try_as<winrt::TabViewItem>())
+                    {
+                        tvi.Width(tabWidth);
+                    }
+                }
+            }
         }
     }
 }
 
+void TabView::UpdateTabWidthResources()
+{
+    if (!m_tabWidthResourcesValid)
+    {
+        m_minTabWidth = unbox_value<double>(SharedHelpers::FindResource(c_tabViewItemMinWidthName, winrt::Application::Current().Resources(), box_value(c_tabMinimumWidth)));
+        m_maxTabWidth = unbox_value<double>(SharedHelpers::FindResource(c_tabViewItemMaxWidthName, winrt::Application::Current().Resources(), box_value(c_tabMaximumWidth)));
+        m_tabWidthResourcesValid = true;
+    }
+}
+
 
 void TabView::UpdateSelectedItem()
 {
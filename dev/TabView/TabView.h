@@ -13,6 +13,7 @@
 #include "TabViewTabDragStartingEventArgs.g.h"
 #include "TabViewTabDragCompletedEventArgs.g.h"
 #include "DispatcherHelper.h"
+#include "DoubleUtil.h"
 
 static constexpr double c_tabShadowDepth = 16.0;
 static constexpr wstring_view c_tabViewShadowDepthName{ L"TabViewShadowDepth"sv };
@@ -112,6 +113,8 @@ public:
 
     void RequestCloseTab(winrt::TabViewItem const& item);
 
+    void OnContainerContentChanging(const winrt::ContainerContentChangingEventArgs& args);
+
     winrt::UIElement GetShadowReceiver() { return m_shadowReceiver.get(); }
 
 private:
@@ -141,6 +144,8 @@ private:
     void UpdateSelectedIndex();
 
     void UpdateTabWidths();
+    void UpdateTabWidthResources();
+    void OnActualThemeChanged(const winrt::FrameworkElement& sender, const winrt::IInspectable& args);
 
     void OnListViewGettingFocus(const winrt::IInspectable& sender, const winrt::GettingFocusEventArgs& args);
 
@@ -173,6 +178,8 @@ private:
 
     winrt::FxScrollViewer::Loaded_revoker m_scrollViewerLoadedRevoker{};
 
+    winrt::FrameworkElement::ActualThemeChanged_revoker m_actualThemeChangedRevoker{};
+
     winrt::Button::Click_revoker m_addButtonClickRevoker{};
 
     winrt::RepeatButton::Click_revoker m_scrollDecreaseClickRevoker{};
@@ -181,4 +188,12 @@ private:
     DispatcherHelper m_dispatcherHelper{ *this };
 
     winrt::Size previousAvailableSize{};
+
+    // TabViewItemMinWidth and TabViewItemMaxWidth, re-read when the template or the theme changes.
+    double m_minTabWidth{ 0.0 };
+    double m_maxTabWidth{ 0.0 };
+    bool m_tabWidthResourcesValid{ false };
+
+    // Width last given to the realized tabs, containers realized later pick it up in OnContainerContentChanging.
+    double m_tabWidth{ DoubleUtil::NaN };
 };
@@ -52,6 +52,7 @@ void TabViewListView::OnContainerContentChanging(const winrt::IInspectable& send
     if (auto tabView = SharedHelpers::GetAncestorOfType<winrt::TabView>(winrt::VisualTreeHelper::GetParent(*this)))
     {
         auto internalTabView = winrt::get_self<TabView>(tabView);
+        internalTabView->OnContainerContentChanging(args);
         internalTabView->UpdateTabContent();
     }
 }
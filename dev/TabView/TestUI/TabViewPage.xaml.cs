@@ -54,6 +54,14 @@ namespace MUXControlsTestApp
                 itemSource.Add(item);
             }
             DataBindingTabView.TabItemsSource = itemSource;
+
+            this.Unloaded += TabViewPage_Unloaded;
+        }
+
+        private void TabViewPage_Unloaded(object sender, RoutedEventArgs e)
+        {
+            // Don't leak the resource override into other pages
+            Application.Current.Resources.Remove("TabViewItemMaxWidth");
         }
 
         public void IsClosableCheckBox_CheckChanged(object sender, RoutedEventArgs e)
@@ -300,6 +308,31 @@ namespace MUXControlsTestApp
             Tabs.Width = 690;
         }
 
+        // TabView only reads TabViewItemMaxWidth again after its theme or template changes,
+        // so these only take effect together with one of the buttons below.
+        private void SetSmallTabMaxWidthButton_Click(object sender, RoutedEventArgs e)
+        {
+            Application.Current.Resources["TabViewItemMaxWidth"] = 100.0;
+        }
+
+        private void ClearTabMaxWidthButton_Click(object sender, RoutedEventArgs e)
+        {
+            Application.Current.Resources.Remove("TabViewItemMaxWidth");
+        }
+
+        private void ChangeTabViewThemeButton_Click(object sender, RoutedEventArgs e)
+        {
+            Tabs.RequestedTheme = Tabs.ActualTheme == ElementTheme.Dark ? ElementTheme.Light : ElementTheme.Dark;
+        }
+
+        private void ReapplyTabViewTemplateButton_Click(object sender, RoutedEventArgs e)
+        {
+            var template = Tabs.Template;
+            Tabs.Template = null;
+            Tabs.UpdateLayout();
+            Tabs.Template = template;
+        }
+
         public void GetScrollButtonsVisible_Click(object sender, RoutedEventArgs e)
         {
             var scrollDecrease = VisualTreeUtils.FindVisualChildByName(Tabs, "ScrollDecreaseButton") as FrameworkElement;
@@ -39,6 +39,9 @@ public:
     static winrt::event_token LoggingMessage(winrt::TypedEventHandler<winrt::IInspectable, winrt::MUXControlsTestHooksLoggingMessageEventArgs> const& value);
     static void LoggingMessage(winrt::event_token const& token);
 
+    static void SetStructuredTracingEnabled(bool enabled);
+    static winrt::IVectorView<winrt::hstring> DrainStructuredTraceEvents();
+
     static winrt::event_token BuildTreeCompleted(winrt::TypedEventHandler<winrt::IInspectable, winrt::IInspectable> const& value); // subscribe
     static void BuildTreeCompleted(winrt::event_token const& token); // unsubscribe
     static void NotifyBuildTreeCompleted();
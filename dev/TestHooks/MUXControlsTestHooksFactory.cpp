@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "MUXControlsTestHooks.h"
+#include "StructuredTrace.h"
 
 MUXControlsTestHooks* MUXControlsTestHooks::s_testHooks = nullptr;
 
@@ -46,3 +47,23 @@ void MUXControlsTestHooks::LoggingMessage(winrt::event_token const& token)
         s_testHooks->LoggingMessageImpl(token);
     }
 }
+
+void MUXControlsTestHooks::SetStructuredTracingEnabled(bool enabled)
+{
+    StructuredTrace::IsEnabled(enabled);
+}
+
+winrt::IVectorView<winrt::hstring> MUXControlsTestHooks::DrainStructuredTraceEvents()
+{
+    std::vector<TraceEvent> events;
+    StructuredTrace::Drain(events);
+
+    std::vector<winrt::hstring> messages;
+    messages.reserve(events.size());
+    for (const auto& event : events)
+    {
+        messages.emplace_back(StructuredTrace::Format(event));
+    }
+
+    return winrt::single_threaded_vector(std::move(messages)).GetView();
+}
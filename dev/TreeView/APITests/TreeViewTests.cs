@@ -280,6 +280,82 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void TreeViewExpandCollapseLargeFolderTest()
+        {
+            TreeView treeView = null;
+            TreeViewList listControl = null;
+
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    listControl = FindVisualChildByName(treeView, "ListControl") as TreeViewList;
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                const int folderCount = 5000;
+                TreeViewNode root = new TreeViewNode() { Content = "Root" };
+                TreeViewNode sibling = new TreeViewNode() { Content = "Sibling" };
+                for (int i = 0; i < folderCount; i++)
+                {
+                    TreeViewNode folder = new TreeViewNode() { Content = "Folder " + i };
+                    folder.Children.Add(new TreeViewNode() { Content = "File " + i });
+                    folder.IsExpanded = (i % 2 == 0);
+                    root.Children.Add(folder);
+                }
+
+                treeView.RootNodes.Add(root);
+                treeView.RootNodes.Add(sibling);
+                Verify.AreEqual(2, listControl.Items.Count);
+
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                treeView.Expand(root);
+                stopwatch.Stop();
+                Log.Comment("Expanding " + folderCount + " folders took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                // Every folder shows up, followed by its file when the folder is expanded.
+                Verify.AreEqual(2 + folderCount + folderCount / 2, listControl.Items.Count);
+                Verify.AreEqual(root, listControl.Items[0]);
+                Verify.AreEqual(root.Children[0], listControl.Items[1]);
+                Verify.AreEqual(root.Children[0].Children[0], listControl.Items[2]);
+                Verify.AreEqual(root.Children[1], listControl.Items[3]);
+                Verify.AreEqual(root.Children[2], listControl.Items[4]);
+                Verify.AreEqual(sibling, listControl.Items[listControl.Items.Count - 1]);
+                Verify.AreEqual(listControl.Items.Count - 1, listControl.Items.IndexOf(sibling));
+
+                // Collapsing a folder in the middle only removes its own file.
+                root.Children[2].IsExpanded = false;
+                Verify.AreEqual(1 + folderCount + folderCount / 2, listControl.Items.Count);
+                Verify.AreEqual(root.Children[3], listControl.Items[5]);
+
+                // Removing an expanded folder removes its file with it.
+                root.Children.RemoveAt(0);
+                Verify.AreEqual(folderCount + folderCount / 2 - 1, listControl.Items.Count);
+                Verify.AreEqual(root.Children[0], listControl.Items[1]);
+
+                stopwatch.Restart();
+                treeView.Collapse(root);
+                stopwatch.Stop();
+                Log.Comment("Collapsing took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                Verify.AreEqual(2, listControl.Items.Count);
+                Verify.AreEqual(sibling, listControl.Items[1]);
+
+                // Put things back
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         [TestMethod]
         public void TreeViewInheritanceTest()
         {
@@ -583,6 +659,65 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void TreeViewSelectAllLargeTreeTest()
+        {
+            TreeView treeView = null;
+            const int folderCount = 100;
+            const int fileCount = 100;
+
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                treeView.SelectionMode = TreeViewSelectionMode.Multiple;
+
+                for (int i = 0; i < folderCount; i++)
+                {
+                    var folder = new TreeViewNode() { Content = "Folder " + i };
+                    for (int j = 0; j < fileCount; j++)
+                    {
+                        folder.Children.Add(new TreeViewNode() { Content = "File " + i + "." + j });
+                    }
+                    treeView.RootNodes.Add(folder);
+                }
+
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                treeView.SelectAll();
+                stopwatch.Stop();
+                Log.Comment("Selecting " + (folderCount * (fileCount + 1)) + " nodes took " + stopwatch.ElapsedMilliseconds + "ms");
+
+                Verify.AreEqual(folderCount * (fileCount + 1), treeView.SelectedNodes.Count);
+                Verify.AreEqual(true, IsMultiSelectCheckBoxChecked(treeView, treeView.RootNodes[0]));
+
+                // Unselecting a single file turns its folder partially selected, which takes it out of the selection.
+                var folder = treeView.RootNodes[0];
+                treeView.SelectedNodes.Remove(folder.Children[50]);
+                Verify.AreEqual(folderCount * (fileCount + 1) - 2, treeView.SelectedNodes.Count);
+                Verify.IsFalse(treeView.SelectedNodes.Contains(folder));
+                Verify.AreEqual(false, IsMultiSelectCheckBoxChecked(treeView, folder));
+
+                // Selecting it again makes the whole folder selected.
+                treeView.SelectedNodes.Add(folder.Children[50]);
+                Verify.AreEqual(folderCount * (fileCount + 1), treeView.SelectedNodes.Count);
+                Verify.IsTrue(treeView.SelectedNodes.Contains(folder));
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         [TestMethod]
         public void VerifyVisualTree()
         {
@@ -0,0 +1,352 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "FlattenedTree.h"
+
+static constexpr uint32_t c_notFound = std::numeric_limits<uint32_t>::max();
+
+FlattenedTree::Entry::Entry(const ITrackerHandleManager* owner, const winrt::TreeViewNode& value) :
+    node(owner, value),
+    depth(value.Depth())
+{
+    minDepth = depth;
+}
+
+FlattenedTree::FlattenedTree(const ITrackerHandleManager* owner) :
+    m_owner(owner)
+{
+}
+
+uint32_t FlattenedTree::Size() const
+{
+    return SizeOf(m_root);
+}
+
+winrt::TreeViewNode FlattenedTree::GetAt(uint32_t index) const
+{
+    return EntryAt(index)->node.get();
+}
+
+bool FlattenedTree::IndexOf(const winrt::TreeViewNode& node, uint32_t& index) const
+{
+    index = 0;
+
+    if (node)
+    {
+        auto it = m_entries.find(winrt::get_self<TreeViewNode>(node));
+        if (it != m_entries.end())
+        {
+            index = IndexOfEntry(it->second.get());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t FlattenedTree::EndOfDescendants(uint32_t index) const
+{
+    // Descendants follow their ancestor and are deeper than it, so the first entry
+    // after index that is not deeper ends the range.
+    const auto end = FindAtOrAboveDepth(m_root, 0, index + 1, EntryAt(index)->depth);
+    return end == c_notFound ? Size() : end;
+}
+
+std::vector<FlattenedTree::Entry*> FlattenedTree::InsertAt(uint32_t index, const std::vector<winrt::TreeViewNode>& nodes)
+{
+    if (index > Size())
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    std::vector<Entry*> entries;
+    entries.reserve(nodes.size());
+    for (const auto& node : nodes)
+    {
+        auto& entry = m_entries[winrt::get_self<TreeViewNode>(node)];
+        if (entry)
+        {
+            // Roll back what we added so far, a node can only show up once.
+            for (const auto& added : entries)
+            {
+                m_entries.erase(winrt::get_self<TreeViewNode>(added->node.get()));
+            }
+            throw winrt::hresult_invalid_argument(L"The node is already in the view.");
+        }
+
+        entry = std::make_unique<Entry>(m_owner, node);
+        entry->priority = NextPriority();
+        entries.push_back(entry.get());
+    }
+
+    Entry* first = nullptr;
+    Entry* second = nullptr;
+    Split(m_root, index, first, second);
+    m_root = Merge(Merge(first, Build(entries)), second);
+    if (m_root)
+    {
+        m_root->parent = nullptr;
+    }
+
+    return entries;
+}
+
+std::vector<std::unique_ptr<FlattenedTree::Entry>> FlattenedTree::RemoveAt(uint32_t index, uint32_t count)
+{
+    if (index + count > Size() || index + count < index)
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    Entry* first = nullptr;
+    Entry* middle = nullptr;
+    Entry* last = nullptr;
+    Split(m_root, index, first, middle);
+    Split(middle, count, middle, last);
+    m_root = Merge(first, last);
+    if (m_root)
+    {
+        m_root->parent = nullptr;
+    }
+
+    std::vector<Entry*> removed;
+    removed.reserve(count);
+    AppendInOrder(middle, removed);
+
+    std::vector<std::unique_ptr<Entry>> result;
+    result.reserve(removed.size());
+    for (const auto& entry : removed)
+    {
+        auto it = m_entries.find(winrt::get_self<TreeViewNode>(entry->node.safe_get()));
+        MUX_ASSERT(it != m_entries.end());
+        result.push_back(std::move(it->second));
+        m_entries.erase(it);
+    }
+
+    return result;
+}
+
+std::vector<std::unique_ptr<FlattenedTree::Entry>> FlattenedTree::Clear()
+{
+    std::vector<std::unique_ptr<Entry>> result;
+    result.reserve(m_entries.size());
+    for (auto& pair : m_entries)
+    {
+        result.push_back(std::move(pair.second));
+    }
+
+    m_entries.clear();
+    m_root = nullptr;
+    return result;
+}
+
+FlattenedTree::Entry* FlattenedTree::EntryAt(uint32_t index) const
+{
+    auto entry = m_root;
+    while (entry)
+    {
+        const auto leftSize = SizeOf(entry->left);
+        if (index < leftSize)
+        {
+            entry = entry->left;
+        }
+        else if (index == leftSize)
+        {
+            return entry;
+        }
+        else
+        {
+            index -= leftSize + 1;
+            entry = entry->right;
+        }
+    }
+
+    throw winrt::hresult_out_of_bounds();
+}
+
+uint32_t FlattenedTree::NextPriority()
+{
+    // xorshift32, we only need the priorities to be well spread to keep the treap balanced.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    return m_seed;
+}
+
+uint32_t FlattenedTree::SizeOf(const Entry* entry)
+{
+    return entry ? entry->size : 0;
+}
+
+int FlattenedTree::MinDepthOf(const Entry* entry)
+{
+    return entry ? entry->minDepth : std::numeric_limits<int>::max();
+}
+
+void FlattenedTree::Update(Entry* entry)
+{
+    entry->size = 1 + SizeOf(entry->left) + SizeOf(entry->right);
+    entry->minDepth = std::min({ entry->depth, MinDepthOf(entry->left), MinDepthOf(entry->right) });
+
+    if (entry->left)
+    {
+        entry->left->parent = entry;
+    }
+
+    if (entry->right)
+    {
+        entry->right->parent = entry;
+    }
+}
+
+FlattenedTree::Entry* FlattenedTree::Merge(Entry* first, Entry* second)
+{
+    if (!first || !second)
+    {
+        return first ? first : second;
+    }
+
+    if (first->priority > second->priority)
+    {
+        first->right = Merge(first->right, second);
+        Update(first);
+        return first;
+    }
+
+    second->left = Merge(first, second->left);
+    Update(second);
+    return second;
+}
+
+// Splits the tree so that the first count entries end up in first and the rest in second.
+void FlattenedTree::Split(Entry* entry, uint32_t count, Entry*& first, Entry*& second)
+{
+    if (!entry)
+    {
+        first = second = nullptr;
+        return;
+    }
+
+    const auto leftSize = SizeOf(entry->left);
+    if (leftSize < count)
+    {
+        Split(entry->right, count - leftSize - 1, entry->right, second);
+        Update(entry);
+        first = entry;
+    }
+    else
+    {
+        Split(entry->left, count, first, entry->left);
+        Update(entry);
+        second = entry;
+    }
+
+    if (first)
+    {
+        first->parent = nullptr;
+    }
+
+    if (second)
+    {
+        second->parent = nullptr;
+    }
+}
+
+// Builds a treap out of entries that are already in order in linear time by keeping
+// track of the right spine of the tree built so far.
+FlattenedTree::Entry* FlattenedTree::Build(const std::vector<Entry*>& entries)
+{
+    std::vector<Entry*> spine;
+    for (const auto& entry : entries)
+    {
+        Entry* last = nullptr;
+        while (!spine.empty() && spine.back()->priority < entry->priority)
+        {
+            last = spine.back();
+            spine.pop_back();
+            Update(last);
+        }
+
+        entry->left = last;
+        entry->right = nullptr;
+        if (!spine.empty())
+        {
+            spine.back()->right = entry;
+        }
+
+        spine.push_back(entry);
+    }
+
+    Entry* root = nullptr;
+    while (!spine.empty())
+    {
+        root = spine.back();
+        spine.pop_back();
+        Update(root);
+    }
+
+    if (root)
+    {
+        root->parent = nullptr;
+    }
+
+    return root;
+}
+
+void FlattenedTree::AppendInOrder(Entry* entry, std::vector<Entry*>& entries)
+{
+    // Walk down the left spine with an explicit stack, the range we collect can be large.
+    std::vector<Entry*> stack;
+    while (entry || !stack.empty())
+    {
+        while (entry)
+        {
+            stack.push_back(entry);
+            entry = entry->left;
+        }
+
+        entry = stack.back();
+        stack.pop_back();
+        entries.push_back(entry);
+        entry = entry->right;
+    }
+}
+
+// Returns the index of the first entry at or after from whose depth is at most depth.
+uint32_t FlattenedTree::FindAtOrAboveDepth(const Entry* entry, uint32_t offset, uint32_t from, int depth)
+{
+    if (!entry || entry->minDepth > depth || offset + entry->size <= from)
+    {
+        return c_notFound;
+    }
+
+    const auto result = FindAtOrAboveDepth(entry->left, offset, from, depth);
+    if (result != c_notFound)
+    {
+        return result;
+    }
+
+    const auto index = offset + SizeOf(entry->left);
+    if (index >= from && entry->depth <= depth)
+    {
+        return index;
+    }
+
+    return FindAtOrAboveDepth(entry->right, index + 1, from, depth);
+}
+
+uint32_t FlattenedTree::IndexOfEntry(const Entry* entry)
+{
+    auto index = SizeOf(entry->left);
+    while (entry->parent)
+    {
+        if (entry == entry->parent->right)
+        {
+            index += SizeOf(entry->parent->left) + 1;
+        }
+        entry = entry->parent;
+    }
+    return index;
+}
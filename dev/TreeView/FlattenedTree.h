@@ -0,0 +1,68 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+#include "TreeViewNode.h"
+
+// The nodes TreeView currently shows, in the order they are displayed.
+// This is an order statistic tree (an implicit treap): every entry knows how many entries its subtree
+// holds, so mapping a flat index to a node and back is O(log n). Entries also track the smallest
+// node depth in their subtree, which is what we use to find where the visible descendants of a node
+// end without walking the TreeViewNode hierarchy.
+class FlattenedTree
+{
+public:
+    struct Entry
+    {
+        Entry(const ITrackerHandleManager* owner, const winrt::TreeViewNode& value);
+
+        tracker_ref<winrt::TreeViewNode> node;
+        int depth{ 0 };
+        winrt::event_token childrenChangedToken{};
+        winrt::event_token expandedChangedToken{};
+
+    private:
+        friend class FlattenedTree;
+
+        uint32_t priority{ 0 };
+        uint32_t size{ 1 };
+        int minDepth{ 0 };
+        Entry* left{ nullptr };
+        Entry* right{ nullptr };
+        Entry* parent{ nullptr };
+    };
+
+    FlattenedTree(const ITrackerHandleManager* owner);
+
+    uint32_t Size() const;
+    winrt::TreeViewNode GetAt(uint32_t index) const;
+    bool IndexOf(const winrt::TreeViewNode& node, uint32_t& index) const;
+
+    // Returns the index right after the last visible descendant of the node at the given index.
+    uint32_t EndOfDescendants(uint32_t index) const;
+
+    // Inserts the nodes in order starting at index and returns their entries.
+    std::vector<Entry*> InsertAt(uint32_t index, const std::vector<winrt::TreeViewNode>& nodes);
+    // Removes count entries starting at index and hands them back in order.
+    std::vector<std::unique_ptr<Entry>> RemoveAt(uint32_t index, uint32_t count);
+    std::vector<std::unique_ptr<Entry>> Clear();
+
+private:
+    Entry* EntryAt(uint32_t index) const;
+    uint32_t NextPriority();
+
+    static uint32_t SizeOf(const Entry* entry);
+    static int MinDepthOf(const Entry* entry);
+    static void Update(Entry* entry);
+    static Entry* Merge(Entry* first, Entry* second);
+    static void Split(Entry* entry, uint32_t count, Entry*& first, Entry*& second);
+    static Entry* Build(const std::vector<Entry*>& entries);
+    static void AppendInOrder(Entry* entry, std::vector<Entry*>& entries);
+    static uint32_t FindAtOrAboveDepth(const Entry* entry, uint32_t offset, uint32_t from, int depth);
+    static uint32_t IndexOfEntry(const Entry* entry);
+
+    const ITrackerHandleManager* m_owner{ nullptr };
+    Entry* m_root{ nullptr };
+    std::unordered_map<TreeViewNode*, std::unique_ptr<Entry>> m_entries;
+    uint32_t m_seed{ 0x9E3779B9u };
+};
@@ -30,6 +30,17 @@ winrt::TreeViewNode TreeViewNode::get_ParentImpl()
 
 void TreeViewNode::put_ParentImpl(winrt::TreeViewNode const& value)
 {
+    // Move our selection state over to the counts of the new parent.
+    if (auto oldParent = get_ParentImpl())
+    {
+        winrt::get_self<TreeViewNode>(oldParent)->UpdateChildSelectionCounts(m_multiSelectionState, TreeNodeSelectionState::UnSelected);
+    }
+
+    if (value)
+    {
+        winrt::get_self<TreeViewNode>(value)->UpdateChildSelectionCounts(TreeNodeSelectionState::UnSelected, m_multiSelectionState);
+    }
+
     if (value != nullptr)
     {
         m_parentNode = winrt::make_weak(value);
@@ -78,9 +89,55 @@ TreeNodeSelectionState TreeViewNode::SelectionState()
 
 void TreeViewNode::SelectionState(TreeNodeSelectionState const& state)
 {
+    if (auto parent = get_ParentImpl())
+    {
+        winrt::get_self<TreeViewNode>(parent)->UpdateChildSelectionCounts(m_multiSelectionState, state);
+    }
+
     m_multiSelectionState = state;
 }
 
+TreeNodeSelectionState TreeViewNode::SelectionStateBasedOnChildren()
+{
+    if (m_partialSelectedChildrenCount > 0 ||
+        (m_selectedChildrenCount > 0 && m_selectedChildrenCount < Children().Size()))
+    {
+        return TreeNodeSelectionState::PartialSelected;
+    }
+
+    return m_selectedChildrenCount > 0 ? TreeNodeSelectionState::Selected : TreeNodeSelectionState::UnSelected;
+}
+
+void TreeViewNode::UpdateChildSelectionCounts(TreeNodeSelectionState const& oldState, TreeNodeSelectionState const& newState)
+{
+    if (oldState == newState)
+    {
+        return;
+    }
+
+    switch (oldState)
+    {
+    case TreeNodeSelectionState::Selected:
+        MUX_ASSERT(m_selectedChildrenCount > 0);
+        m_selectedChildrenCount--;
+        break;
+    case TreeNodeSelectionState::PartialSelected:
+        MUX_ASSERT(m_partialSelectedChildrenCount > 0);
+        m_partialSelectedChildrenCount--;
+        break;
+    }
+
+    switch (newState)
+    {
+    case TreeNodeSelectionState::Selected:
+        m_selectedChildrenCount++;
+        break;
+    case TreeNodeSelectionState::PartialSelected:
+        m_partialSelectedChildrenCount++;
+        break;
+    }
+}
+
 void TreeViewNode::UpdateDepth(int depth)
 {
     // Update our depth
@@ -40,6 +40,7 @@ public:
     void ItemsSource(winrt::IInspectable const& value);
     TreeNodeSelectionState SelectionState();
     void SelectionState(TreeNodeSelectionState const& state);
+    TreeNodeSelectionState SelectionStateBasedOnChildren();
 
 // Enable "ToString" on TreeViewNode to show stringable data correctly
 #pragma region ICustomPropertyProvider
@@ -71,6 +72,12 @@ private:
     void RemoveFromChildrenNodes(int index, int count);
     bool m_isContentMode{ false };
     TreeNodeSelectionState m_multiSelectionState{ TreeNodeSelectionState::UnSelected };
+    // How many children are selected or partially selected, kept up to date as children change
+    // selection state or come and go, so that the tri-state of a parent doesn't need to look at
+    // its siblings.
+    unsigned int m_selectedChildrenCount{ 0 };
+    unsigned int m_partialSelectedChildrenCount{ 0 };
+    void UpdateChildSelectionCounts(TreeNodeSelectionState const& oldState, TreeNodeSelectionState const& newState);
     hstring GetContentAsString();
 
 public:
@@ -8,6 +8,7 @@
 #include "VectorChangedEventArgs.h"
 #include "TreeViewList.h"
 #include <HashMap.h>
+#include <unordered_set>
 
 // Need to update node selection states on UI before vector changes.
 // Listen on vector change events don't solve the problem because the event already happened when the event handler gets called.
@@ -28,6 +29,19 @@ class SelectedTreeNodeVector :
 
 private:
     winrt::weak_ref<ViewModel> m_viewModel{ nullptr };
+    // Position of each node in the vector above, so that Contains and IndexOfNode don't have to search it.
+    std::unordered_map<TreeViewNode*, unsigned int> m_nodePositions;
+
+    // Entries from startIndex onwards moved after an insert or remove; refresh their positions.
+    void UpdateNodePositionsFrom(unsigned int startIndex)
+    {
+        auto inner = GetVectorInnerImpl();
+        const unsigned int size = inner->Size();
+        for (unsigned int i = startIndex; i < size; i++)
+        {
+            m_nodePositions[winrt::get_self<TreeViewNode>(inner->GetAt(i))] = i;
+        }
+    }
 
     void UpdateSelection(winrt::TreeViewNode const& node, TreeNodeSelectionState state)
     {
@@ -100,8 +114,21 @@ public:
 
     bool Contains(winrt::TreeViewNode const& node)
     {
-        uint32_t index;
-        return GetVectorInnerImpl()->IndexOf(node, index);
+        return node && m_nodePositions.count(winrt::get_self<TreeViewNode>(node)) > 0;
+    }
+
+    bool IndexOfNode(winrt::TreeViewNode const& node, unsigned int& index)
+    {
+        if (node)
+        {
+            auto it = m_nodePositions.find(winrt::get_self<TreeViewNode>(node));
+            if (it != m_nodePositions.end())
+            {
+                index = it->second;
+                return true;
+            }
+        }
+        return false;
     }
 
     // Default write methods will trigger TreeView visual updates.
@@ -109,6 +136,7 @@ public:
     void InsertAtCore(unsigned int index, winrt::TreeViewNode const& node)
     {
         GetVectorInnerImpl()->InsertAt(index, node);
+        UpdateNodePositionsFrom(index);
 
         // Keep SelectedItems and SelectedNodes in sync
         if (auto viewModel = m_viewModel.get())
@@ -129,7 +157,10 @@ public:
 
     void RemoveAtCore(unsigned int index)
     {
-        GetVectorInnerImpl()->RemoveAt(index);
+        auto inner = GetVectorInnerImpl();
+        m_nodePositions.erase(winrt::get_self<TreeViewNode>(inner->GetAt(index)));
+        inner->RemoveAt(index);
+        UpdateNodePositionsFrom(index);
 
         // Keep SelectedItems and SelectedNodes in sync
         if (auto viewModel = m_viewModel.get())
@@ -163,6 +194,13 @@ class SelectedItemsVector :
 
 private:
     winrt::weak_ref<ViewModel> m_viewModel{ nullptr };
+    // Membership of the vector above by object identity, which is what IndexOf compares.
+    std::unordered_set<void*> m_itemSet;
+
+    static void* IdentityOf(winrt::IInspectable const& item)
+    {
+        return item ? winrt::get_abi(item.as<winrt::Windows::Foundation::IUnknown>()) : nullptr;
+    }
 
 public:
     void SetViewModel(ViewModel& viewModel)
@@ -180,6 +218,7 @@ public:
         if (!Contains(item))
         {
             GetVectorInnerImpl()->InsertAt(index, item);
+            m_itemSet.insert(IdentityOf(item));
 
             // Keep SelectedNodes and SelectedItems in sync
             if (auto viewModel = m_viewModel.get())
@@ -207,7 +246,9 @@ public:
 
     void RemoveAt(unsigned int index)
     {
-        GetVectorInnerImpl()->RemoveAt(index);
+        auto inner = GetVectorInnerImpl();
+        m_itemSet.erase(IdentityOf(inner->GetAt(index)));
+        inner->RemoveAt(index);
 
         // Keep SelectedNodes and SelectedItems in sync
         if (auto viewModel = m_viewModel.get())
@@ -245,8 +286,7 @@ public:
 
     bool Contains(winrt::IInspectable const& item)
     {
-        uint32_t index;
-        return GetVectorInnerImpl()->IndexOf(item, index);
+        return m_itemSet.count(IdentityOf(item)) > 0;
     }
 };
 
@@ -321,8 +361,7 @@ void ViewModel::ModifySelectByIndex(int index, TreeNodeSelectionState const& sta
 
 uint32_t ViewModel::Size()
 {
-    auto inner = GetVectorInnerImpl();
-    return inner->Size();
+    return m_flatTree.Size();
 }
 
 winrt::IInspectable ViewModel::GetAt(uint32_t index)
@@ -339,25 +378,24 @@ bool ViewModel::IndexOf(winrt::IInspectable const& value, uint32_t& index)
     }
     else
     {
-        auto inner = GetVectorInnerImpl();
-        return inner->IndexOf(value, index);
+        return IndexOfNode(value.try_as<winrt::TreeViewNode>(), index);
     }
 }
 
 uint32_t ViewModel::GetMany(uint32_t const startIndex, winrt::array_view<winrt::IInspectable> values)
 {
-    auto inner = GetVectorInnerImpl();
-    if (IsContentMode())
+    const uint32_t size = Size();
+    if (startIndex >= size)
     {
-        auto vector = winrt::make<Vector<winrt::IInspectable>>();
-        int size = Size();
-        for (int i = 0; i < size; i++)
-        {
-            vector.Append(GetNodeAt(i).Content());
-        }
-        return vector.GetMany(startIndex, values);
+        return 0;
     }
-    return inner->GetMany(startIndex, values);
+
+    const uint32_t actual = std::min(size - startIndex, values.size());
+    for (uint32_t i = 0; i < actual; i++)
+    {
+        values[i] = GetAt(startIndex + i);
+    }
+    return actual;
 }
 
 winrt::IVectorView<winrt::IInspectable> ViewModel::GetView()
@@ -367,97 +405,63 @@ winrt::IVectorView<winrt::IInspectable> ViewModel::GetView()
 
 winrt::TreeViewNode ViewModel::GetNodeAt(uint32_t index)
 {
-    auto inner = GetVectorInnerImpl();
-    return inner->GetAt(index).as<winrt::TreeViewNode>();
+    return m_flatTree.GetAt(index);
 }
 
 void ViewModel::SetAt(uint32_t index, winrt::IInspectable const& value)
 {
-    auto inner = GetVectorInnerImpl();
-    auto current = inner->GetAt(index).as<winrt::TreeViewNode>();
-    inner->SetAt(index, value);
-
-    winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
+    for (auto& entry : m_flatTree.RemoveAt(index, 1))
+    {
+        UnhookNodeEvents(*entry);
+    }
 
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector[index]);
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector[index]);
+    for (auto& entry : m_flatTree.InsertAt(index, { value.as<winrt::TreeViewNode>() }))
+    {
+        HookNodeEvents(*entry);
+    }
 
-    // Hook up events and replace tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector[index] = tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged });
-    m_IsExpandedChangedEventTokenVector[index] = tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged });
+    GetVectorInnerImpl()->RaiseChildrenChanged(winrt::CollectionChange::ItemChanged, index);
 }
 
 void ViewModel::InsertAt(uint32_t index, winrt::IInspectable const& value)
 {
-    GetVectorInnerImpl()->InsertAt(index, value);
-    winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
-
-    //Hook up events and save tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector.insert(m_collectionChangedEventTokenVector.begin() + index, tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged }));
-    m_IsExpandedChangedEventTokenVector.insert(m_IsExpandedChangedEventTokenVector.begin() + index, tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged }));
+    InsertNodesIntoView(index, { value.as<winrt::TreeViewNode>() });
 }
 
 void ViewModel::RemoveAt(uint32_t index)
 {
-    auto inner = GetVectorInnerImpl();
-    auto current = inner->GetAt(index).as<winrt::TreeViewNode>();
-    inner->RemoveAt(index);
-
-    // Unhook event handlers
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector[index]);
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector[index]);
-
-    // Remove tokens from vectors
-    m_collectionChangedEventTokenVector.erase(m_collectionChangedEventTokenVector.begin() + index);
-    m_IsExpandedChangedEventTokenVector.erase(m_IsExpandedChangedEventTokenVector.begin() + index);
+    RemoveNodesFromView(index, 1);
 }
 
 void ViewModel::Append(winrt::IInspectable const& value)
 {
-    GetVectorInnerImpl()->Append(value);
-    winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
-    
-    // Hook up events and save tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector.push_back(tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged }));
-    m_IsExpandedChangedEventTokenVector.push_back(tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged }));
+    InsertAt(Size(), value);
 }
 
 void ViewModel::RemoveAtEnd()
 {
-    auto inner = GetVectorInnerImpl();
-    auto current = inner->GetAt(Size() - 1).as<winrt::TreeViewNode>();
-    inner->RemoveAtEnd();
-
-    // unhook events
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector.back());
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector.back());
-
-    // remove tokens
-    m_collectionChangedEventTokenVector.pop_back();
-    m_IsExpandedChangedEventTokenVector.pop_back();
+    if (Size() > 0)
+    {
+        RemoveAt(Size() - 1);
+    }
 }
 
 void ViewModel::Clear()
 {
-    // Don't call GetVectorInnerImpl()->Clear() directly because we need to remove hooked events
-    unsigned int count = Size();
-    while (count != 0)
-    {
-        RemoveAtEnd();
-        count--;
-    }
+    RemoveNodesFromView(0, Size());
 }
 
 void ViewModel::ReplaceAll(winrt::array_view<winrt::IInspectable const> items)
 {
-    auto inner = GetVectorInnerImpl();
-    return inner->ReplaceAll(items);
+    Clear();
+
+    std::vector<winrt::TreeViewNode> nodes;
+    nodes.reserve(items.size());
+    for (auto const& item : items)
+    {
+        nodes.push_back(item.as<winrt::TreeViewNode>());
+    }
+    InsertNodesIntoView(0, nodes);
 }
 
 // Helper function
@@ -466,11 +470,7 @@ void ViewModel::PrepareView(const winrt::TreeViewNode& originNode)
     // Remove any existing RootNode events/children
     if (auto existingOriginNode = m_originNode.get())
     {
-        for (int i = (existingOriginNode.Children().Size() - 1); i >= 0; i--)
-        {
-            auto removeNode = existingOriginNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-            RemoveNodeAndDescendantsFromView(removeNode);
-        }
+        RemoveNodesFromView(0, Size());
 
         if (m_rootNodeChildrenChangedEventToken.value != 0)
         {
@@ -483,13 +483,9 @@ void ViewModel::PrepareView(const winrt::TreeViewNode& originNode)
     m_rootNodeChildrenChangedEventToken = winrt::get_self<TreeViewNode>(originNode)->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged });
     originNode.IsExpanded(true);
 
-    int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < originNode.Children().Size(); i++)
-    {
-        auto addNode = originNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-        AddNodeToView(addNode, i + allOpenedDescendantsCount);
-        allOpenedDescendantsCount = AddNodeDescendantsToView(addNode, i, allOpenedDescendantsCount);
-    }
+    std::vector<winrt::TreeViewNode> nodes;
+    AppendVisibleDescendants(originNode, nodes);
+    InsertNodesIntoView(0, nodes);
 }
 
 void ViewModel::SetOwningList(winrt::TreeViewList const& owningList)
@@ -508,169 +504,132 @@ bool ViewModel::IsInSingleSelectionMode()
 }
 
 // Private helpers
-void ViewModel::AddNodeToView(const winrt::TreeViewNode& value, unsigned int index)
-{
-    InsertAt(index, value);
-}
 
-int ViewModel::AddNodeDescendantsToView(const winrt::TreeViewNode& value, unsigned int index, int offset)
+// Small changes keep raising one notification per node so the list can animate them and keep focus
+// on its containers. Past this many nodes, we raise a single Reset instead: handling tens of thousands
+// of single item notifications is what used to freeze the UI when expanding a large folder.
+static constexpr unsigned int c_maxItemChangeNotifications = 100;
+
+void ViewModel::InsertNodesIntoView(unsigned int index, std::vector<winrt::TreeViewNode> const& nodes)
 {
-    if (value.IsExpanded())
+    if (nodes.size() > c_maxItemChangeNotifications)
     {
-        unsigned int size = value.Children().Size();
-        for (unsigned int i = 0; i < size; i++)
+        for (auto& entry : m_flatTree.InsertAt(index, nodes))
         {
-            auto childNode = value.Children().GetAt(i).as<winrt::TreeViewNode>();
-            offset++;
-            AddNodeToView(childNode, offset + index);
-            offset = AddNodeDescendantsToView(childNode, index, offset);
+            HookNodeEvents(*entry);
         }
 
-        return offset;
+        GetVectorInnerImpl()->RaiseChildrenChanged(winrt::CollectionChange::Reset, 0u);
     }
+    else
+    {
+        for (unsigned int i = 0; i < nodes.size(); i++)
+        {
+            for (auto& entry : m_flatTree.InsertAt(index + i, { nodes[i] }))
+            {
+                HookNodeEvents(*entry);
+            }
 
-    return offset;
+            GetVectorInnerImpl()->RaiseChildrenChanged(winrt::CollectionChange::ItemInserted, index + i);
+        }
+    }
 }
 
-void ViewModel::RemoveNodeAndDescendantsFromView(const winrt::TreeViewNode& value)
+void ViewModel::RemoveNodesFromView(unsigned int index, unsigned int count)
 {
-    UINT32 valueIndex;
-    if (value.IsExpanded())
+    if (count > c_maxItemChangeNotifications)
     {
-        unsigned int size = value.Children().Size();
-        for (unsigned int i = 0; i < size; i++)
+        for (auto& entry : m_flatTree.RemoveAt(index, count))
         {
-            auto childNode = value.Children().GetAt(i).as<winrt::TreeViewNode>();
-            RemoveNodeAndDescendantsFromView(childNode);
+            UnhookNodeEvents(*entry);
         }
-    }
 
-    bool containsValue = IndexOfNode(value, valueIndex);
-    if (containsValue)
-    {
-        RemoveAt(valueIndex);
+        GetVectorInnerImpl()->RaiseChildrenChanged(winrt::CollectionChange::Reset, 0u);
     }
-}
-
-void ViewModel::RemoveNodesAndDescendentsWithFlatIndexRange(unsigned int lowIndex, unsigned int highIndex)
-{
-    MUX_ASSERT(lowIndex <= highIndex);
-
-    for (int i = static_cast<int>(highIndex); i >= static_cast<int>(lowIndex); i--)
+    else
     {
-        RemoveNodeAndDescendantsFromView(GetNodeAt(i));
+        // Remove from the end of the range so that descendants go away before their ancestors.
+        for (unsigned int i = count; i > 0; i--)
+        {
+            for (auto& entry : m_flatTree.RemoveAt(index + i - 1, 1))
+            {
+                UnhookNodeEvents(*entry);
+            }
+
+            GetVectorInnerImpl()->RaiseChildrenChanged(winrt::CollectionChange::ItemRemoved, index + i - 1);
+        }
     }
 }
 
-int ViewModel::GetNextIndexInFlatTree(const winrt::TreeViewNode& node)
+void ViewModel::HookNodeEvents(FlattenedTree::Entry& entry)
 {
-    unsigned int index = 0;
-    bool isNodeInFlatList = IndexOfNode(node, index);
-
-    if (isNodeInFlatList)
-    {
-        index++;
-    }
-    else
-    {
-        // node is Root node, so next index in flat tree is 0
-        index = 0;
-    }
-    return index;
+    auto tvnNode = winrt::get_self<TreeViewNode>(entry.node.get());
+    entry.childrenChangedToken = tvnNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged });
+    entry.expandedChangedToken = tvnNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged });
 }
 
-// When ViewModel receives a event, it only includes the sender(parent TreeViewNode) and index.
-// We can't use sender[index] directly because it is already updated/removed
-// To find the removed TreeViewNode:
-//   calcuate allOpenedDescendantsCount in sender[0..index-1] first
-//   then add offset and finally return TreeViewNode by looking up the flat tree.
-winrt::TreeViewNode ViewModel::GetRemovedChildTreeViewNodeByIndex(winrt::TreeViewNode const& node, unsigned int childIndex)
+void ViewModel::UnhookNodeEvents(FlattenedTree::Entry& entry, bool useSafeGet)
 {
-    unsigned int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < childIndex; i++)
+    if (auto node = entry.node.safe_get(useSafeGet))
     {
-        winrt::TreeViewNode calcNode = node.Children().GetAt(i).as<winrt::TreeViewNode>();
-        if (calcNode.IsExpanded())
-        {
-            allOpenedDescendantsCount += GetExpandedDescendantCount(calcNode);
-        }
+        auto tvnNode = winrt::get_self<TreeViewNode>(node);
+        tvnNode->ChildrenChanged(entry.childrenChangedToken);
+        tvnNode->RemoveExpandedChanged(entry.expandedChangedToken);
     }
-
-    unsigned int childIndexInFlatTree = GetNextIndexInFlatTree(node) + childIndex + allOpenedDescendantsCount;
-    return GetNodeAt(childIndexInFlatTree);
 }
 
-int ViewModel::CountDescendants(const winrt::TreeViewNode& value)
+// Collects the descendants of value that are visible when value is, in the order they show up in the flat tree.
+void ViewModel::AppendVisibleDescendants(winrt::TreeViewNode const& value, std::vector<winrt::TreeViewNode>& nodes)
 {
-    int descendantCount = 0;
-    unsigned int size = value.Children().Size();
-    for (unsigned int i = 0; i < size; i++)
+    if (value.IsExpanded())
     {
-        auto childNode = value.Children().GetAt(i).as<winrt::TreeViewNode>();
-        descendantCount++;
-        if (childNode.IsExpanded())
+        for (auto const& childNode : value.Children())
         {
-            descendantCount = descendantCount + CountDescendants(childNode);
+            nodes.push_back(childNode);
+            AppendVisibleDescendants(childNode, nodes);
         }
     }
-
-    return descendantCount;
 }
 
-unsigned int ViewModel::IndexOfNextSibling(winrt::TreeViewNode& childNode)
+// Returns false when the children of parentNode are not shown, either because it is collapsed or
+// because it is not in the flat tree itself. The root node is never in the flat tree but its
+// children always start at 0.
+bool ViewModel::TryGetChildrenStartIndex(winrt::TreeViewNode const& parentNode, unsigned int& index)
 {
-    auto parentNode = childNode.Parent();
-    unsigned int stopIndex;
-    bool isLastRelativeChild = true;
-    while (parentNode && isLastRelativeChild)
-    {
-        unsigned int relativeIndex;
-        parentNode.Children().IndexOf(childNode, relativeIndex);
-        if (parentNode.Children().Size() - 1 != relativeIndex)
-        {
-            isLastRelativeChild = false;
-        }
-        else
-        {
-            childNode = parentNode;
-            parentNode = parentNode.Parent();
-        }
-    }
-
-    if (parentNode)
+    if (parentNode == m_originNode.safe_get())
     {
-        unsigned int siblingIndex;
-        parentNode.Children().IndexOf(childNode, siblingIndex);
-        auto siblingNode = parentNode.Children().GetAt(siblingIndex + 1);
-        IndexOfNode(siblingNode, stopIndex);
+        index = 0;
+        return parentNode.IsExpanded();
     }
-    else
+
+    if (parentNode.IsExpanded() && IndexOfNode(parentNode, index))
     {
-        stopIndex = Size();
+        index++;
+        return true;
     }
 
-    return stopIndex;
+    return false;
 }
 
-unsigned int ViewModel::GetExpandedDescendantCount(winrt::TreeViewNode& parentNode)
+// A child shows up right after the visible descendants of its previous sibling.
+unsigned int ViewModel::IndexOfChildInFlatTree(winrt::TreeViewNode const& parentNode, unsigned int childrenStartIndex, unsigned int childIndex)
 {
-    unsigned int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < parentNode.Children().Size(); i++)
+    auto children = parentNode.Children();
+    for (unsigned int i = childIndex; i > 0; i--)
     {
-        auto childNode = parentNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-        allOpenedDescendantsCount++;
-        if (childNode.IsExpanded())
+        unsigned int siblingIndex;
+        if (IndexOfNode(children.GetAt(i - 1), siblingIndex))
         {
-            allOpenedDescendantsCount += CountDescendants(childNode);
+            return m_flatTree.EndOfDescendants(siblingIndex);
         }
     }
-    return allOpenedDescendantsCount;
+
+    return childrenStartIndex;
 }
 
 bool ViewModel::IsNodeSelected(winrt::TreeViewNode const& targetNode)
 {
-    unsigned int index;
-    return m_selectedNodes.get().IndexOf(targetNode, index);
+    return winrt::get_self<SelectedTreeNodeVector>(m_selectedNodes.get())->Contains(targetNode);
 }
 
 TreeNodeSelectionState ViewModel::NodeSelectionState(winrt::TreeViewNode const& targetNode)
@@ -695,7 +654,7 @@ void ViewModel::UpdateNodeSelection(winrt::TreeViewNode const& selectNode, TreeN
         case TreeNodeSelectionState::PartialSelected:
         case TreeNodeSelectionState::UnSelected:
             unsigned int index;
-            if (selectedNodes->IndexOf(selectNode, index))
+            if (selectedNodes->IndexOfNode(selectNode, index))
             {
                 selectedNodes->RemoveAtCore(index);
                 winrt::get_self<TreeViewNode>(selectNode)->ChildrenChanged(m_selectedNodeChildrenChangedEventTokenVector[index]);
@@ -754,29 +713,7 @@ void ViewModel::UpdateSelectionStateOfAncestors(winrt::TreeViewNode const& targe
 
 TreeNodeSelectionState ViewModel::SelectionStateBasedOnChildren(winrt::TreeViewNode const& node)
 {
-    bool hasSelectedChildren{ false };
-    bool hasUnSelectedChildren{ false };
-
-    for (auto const& childNode : node.Children())
-    {
-        auto state = NodeSelectionState(childNode);
-        if (state == TreeNodeSelectionState::Selected)
-        {
-            hasSelectedChildren = true;
-        }
-        else if (state == TreeNodeSelectionState::UnSelected)
-        {
-            hasUnSelectedChildren = true;
-        }
-
-        if ((hasSelectedChildren && hasUnSelectedChildren) ||
-            state == TreeNodeSelectionState::PartialSelected)
-        {
-            return TreeNodeSelectionState::PartialSelected;
-        }
-    }
-
-    return hasSelectedChildren ? TreeNodeSelectionState::Selected : TreeNodeSelectionState::UnSelected;
+    return winrt::get_self<TreeViewNode>(node)->SelectionStateBasedOnChildren();
 }
 
 void ViewModel::NotifyContainerOfSelectionChange(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState)
@@ -809,7 +746,7 @@ winrt::TreeViewNode ViewModel::GetAssociatedNode(winrt::IInspectable item)
 
 bool ViewModel::IndexOfNode(winrt::TreeViewNode const& targetNode, uint32_t& index)
 {
-    return GetVectorInnerImpl()->IndexOf(targetNode, index);
+    return m_flatTree.IndexOf(targetNode, index);
 }
 
 void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, winrt::IInspectable const& args)
@@ -825,12 +762,12 @@ void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, win
     case (winrt::CollectionChange::Reset):
     {
         auto resetNode = sender.as<winrt::TreeViewNode>();
-        if (resetNode.IsExpanded())
+        unsigned int childrenStartIndex;
+        if (TryGetChildrenStartIndex(resetNode, childrenStartIndex))
         {
-            //The lowIndex is the index of the first child, while the high index is the index of the last descendant in the list.
-            unsigned int lowIndex = GetNextIndexInFlatTree(resetNode);
-            unsigned int highIndex = IndexOfNextSibling(resetNode) - 1;
-            RemoveNodesAndDescendentsWithFlatIndexRange(lowIndex, highIndex);
+            // The previous children and their descendants are still in the flat tree right after the reset node.
+            const unsigned int endIndex = resetNode == m_originNode.safe_get() ? Size() : m_flatTree.EndOfDescendants(childrenStartIndex - 1);
+            RemoveNodesFromView(childrenStartIndex, endIndex - childrenStartIndex);
 
             // reset the status of resetNodes children
             CollapseNode(resetNode);
@@ -840,43 +777,24 @@ void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, win
         break;
     }
 
-    // We will find the correct index of insertion by first checking if the
-    // node we are inserting into is expanded. If it is we will start walking
-    // down the tree and counting the open items. This is to ensure we place
-    // the inserted item in the correct index. If along the way we bump into
-    // the item being inserted, we insert there then return, because we don't
-    // need to do anything further.
+    // The inserted node goes right after the visible descendants of its previous sibling,
+    // followed by its own visible descendants.
     case (winrt::CollectionChange::ItemInserted):
     {
-        auto targetNode = sender.as<winrt::TreeViewNode>().Children().GetAt(index).as<winrt::TreeViewNode>();
+        auto parentNode = sender.as<winrt::TreeViewNode>();
+        auto targetNode = parentNode.Children().GetAt(index).as<winrt::TreeViewNode>();
 
         if (IsContentMode())
         {
             m_itemToNodeMap.get().Insert(targetNode.Content(), targetNode);
         }
 
-        auto parentNode = targetNode.Parent();
-        unsigned int nextNodeIndex = GetNextIndexInFlatTree(parentNode);
-        int allOpenedDescendantsCount = 0;
-
-        if (parentNode.IsExpanded())
+        unsigned int childrenStartIndex;
+        if (TryGetChildrenStartIndex(parentNode, childrenStartIndex))
         {
-            for (unsigned int i = 0; i < parentNode.Children().Size(); i++)
-            {
-                auto childNode = parentNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-                if (childNode == targetNode)
-                {
-                    AddNodeToView(targetNode, nextNodeIndex + i + allOpenedDescendantsCount);
-                    if (targetNode.IsExpanded())
-                    {
-                        AddNodeDescendantsToView(targetNode, nextNodeIndex + i, allOpenedDescendantsCount);
-                    }
-                }
-                else if (childNode.IsExpanded())
-                {
-                    allOpenedDescendantsCount += CountDescendants(childNode);
-                }
-            }
+            std::vector<winrt::TreeViewNode> nodes{ targetNode };
+            AppendVisibleDescendants(targetNode, nodes);
+            InsertNodesIntoView(IndexOfChildInFlatTree(parentNode, childrenStartIndex, index), nodes);
         }
 
         break;
@@ -887,10 +805,14 @@ void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, win
     case (winrt::CollectionChange::ItemRemoved):
     {
         auto removingNodeParent = sender.as<winrt::TreeViewNode>();
-        if (removingNodeParent.IsExpanded())
-        {
-            auto removedNode = GetRemovedChildTreeViewNodeByIndex(removingNodeParent, index);
-            RemoveNodeAndDescendantsFromView(removedNode);
+        unsigned int childrenStartIndex;
+        if (TryGetChildrenStartIndex(removingNodeParent, childrenStartIndex))
+        {
+            // The removed node is already gone from the children, but it is still in the flat tree
+            // where the node at index used to be.
+            const unsigned int removedNodeIndex = IndexOfChildInFlatTree(removingNodeParent, childrenStartIndex, index);
+            auto removedNode = GetNodeAt(removedNodeIndex);
+            RemoveNodesFromView(removedNodeIndex, m_flatTree.EndOfDescendants(removedNodeIndex) - removedNodeIndex);
             if (IsContentMode())
             {
                 m_itemToNodeMap.get().Remove(removedNode.Content());
@@ -904,16 +826,18 @@ void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, win
     // Updates the TreeNode that changed in the ViewModel.
     case (winrt::CollectionChange::ItemChanged):
     {
-        auto targetNode = sender.as<winrt::TreeViewNode>().Children().GetAt(index).as<winrt::TreeViewNode>();
         auto changingNodeParent = sender.as<winrt::TreeViewNode>();
-        if (changingNodeParent.IsExpanded())
+        auto targetNode = changingNodeParent.Children().GetAt(index).as<winrt::TreeViewNode>();
+        unsigned int childrenStartIndex;
+        if (TryGetChildrenStartIndex(changingNodeParent, childrenStartIndex))
         {
-            auto removedNode = GetRemovedChildTreeViewNodeByIndex(changingNodeParent, index);
-            unsigned int removedNodeIndex = 0;
-            MUX_ASSERT(IndexOfNode(removedNode, removedNodeIndex));
+            const unsigned int removedNodeIndex = IndexOfChildInFlatTree(changingNodeParent, childrenStartIndex, index);
+            auto removedNode = GetNodeAt(removedNodeIndex);
+            RemoveNodesFromView(removedNodeIndex, m_flatTree.EndOfDescendants(removedNodeIndex) - removedNodeIndex);
 
-            RemoveNodeAndDescendantsFromView(removedNode);
-            InsertAt(removedNodeIndex, targetNode.as<winrt::IInspectable>());
+            std::vector<winrt::TreeViewNode> nodes{ targetNode };
+            AppendVisibleDescendants(targetNode, nodes);
+            InsertNodesIntoView(removedNodeIndex, nodes);
 
             if (IsContentMode())
             {
@@ -1016,21 +940,15 @@ void ViewModel::TreeViewNodePropertyChanged(winrt::TreeViewNode const& sender, w
 void ViewModel::TreeViewNodeIsExpandedPropertyChanged(winrt::TreeViewNode const& sender, winrt::IDependencyPropertyChangedEventArgs const& args)
 {
     auto targetNode = sender.as<winrt::TreeViewNode>();
+    unsigned int index;
+    const bool isNodeInFlatTree = IndexOfNode(targetNode, index);
     if (targetNode.IsExpanded())
     {
-        if (targetNode.Children().Size() != 0)
+        if (isNodeInFlatTree && targetNode.Children().Size() != 0)
         {
-            int openedDescendantOffset = 0;
-            unsigned int index;
-            IndexOfNode(targetNode, index);
-            index = index + 1;
-            for (unsigned int i = 0; i < targetNode.Children().Size(); i++)
-            {
-                winrt::TreeViewNode childNode{ nullptr };
-                childNode = targetNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-                AddNodeToView(childNode, index + i + openedDescendantOffset);
-                openedDescendantOffset = AddNodeDescendantsToView(childNode, index + i, openedDescendantOffset);
-            }
+            std::vector<winrt::TreeViewNode> nodes;
+            AppendVisibleDescendants(targetNode, nodes);
+            InsertNodesIntoView(index + 1, nodes);
         }
 
         //Notify TreeView that a node is being expanded.
@@ -1038,11 +956,9 @@ void ViewModel::TreeViewNodeIsExpandedPropertyChanged(winrt::TreeViewNode const&
     }
     else
     {
-        for (unsigned int i = 0; i < targetNode.Children().Size(); i++)
+        if (isNodeInFlatTree)
         {
-            winrt::TreeViewNode childNode{ nullptr };
-            childNode = targetNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-            RemoveNodeAndDescendantsFromView(childNode);
+            RemoveNodesFromView(index + 1, m_flatTree.EndOfDescendants(index) - index - 1);
         }
 
         //Notife TreeView that a node is being collapsed
@@ -1077,15 +993,9 @@ bool ViewModel::IsContentMode()
 void ViewModel::ClearEventTokenVectors()
 {
     // Remove ChildrenChanged and ExpandedChanged events
-    auto inner = GetVectorInnerImpl();
-    for (uint32_t i =0 ; i < Size(); i++)
+    for (auto& entry : m_flatTree.Clear())
     {
-        if (auto current = inner->SafeGetAt(i))
-        {
-            auto tvnCurrent = winrt::get_self<TreeViewNode>(current.as<winrt::TreeViewNode>());
-            tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector.at(i));
-            tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector.at(i));
-        }
+        UnhookNodeEvents(*entry, true /* useSafeGet */);
     }
 
     // Remove SelectedNodeChildrenChangtedEvent
@@ -1102,7 +1012,5 @@ void ViewModel::ClearEventTokenVectors()
     }
 
     // Clear token vectors
-    m_collectionChangedEventTokenVector.clear();
-    m_IsExpandedChangedEventTokenVector.clear();
     m_selectedNodeChildrenChangedEventTokenVector.clear();
 }
@@ -4,6 +4,7 @@
 #pragma once
 #include <Vector.h>
 #include "TreeViewNode.h"
+#include "FlattenedTree.h"
 
 using TreeNodeSelectionState = TreeViewNode::TreeNodeSelectionState;
 using ViewModelVectorOptions = typename VectorOptionsFromFlag<winrt::IInspectable, MakeVectorParam<VectorFlag::Observable, VectorFlag::DependencyObjectBase>()>;
@@ -78,26 +79,23 @@ private:
     tracker_ref<winrt::IVector<winrt::TreeViewNode>> m_selectedNodes{ this };
     event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IInspectable>> m_nodeExpandingEventSource{ this };
     event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IInspectable>> m_nodeCollapsedEventSource{ this };
-    std::vector<winrt::event_token> m_collectionChangedEventTokenVector;
     std::vector<winrt::event_token> m_selectedNodeChildrenChangedEventTokenVector;
-    std::vector<winrt::event_token> m_IsExpandedChangedEventTokenVector;
     winrt::event_token m_rootNodeChildrenChangedEventToken;
     winrt::weak_ref<winrt::TreeViewList> m_TreeViewList{ nullptr };
     tracker_ref<winrt::TreeViewNode> m_originNode{ this };
     bool m_isContentMode{ false };
     tracker_ref<winrt::IVector<winrt::IInspectable>> m_selectedItems{ this };
     tracker_ref<winrt::IMap<winrt::IInspectable, winrt::TreeViewNode>> m_itemToNodeMap{ this };
+    FlattenedTree m_flatTree{ this };
 
     // Methods
-    winrt::TreeViewNode GetRemovedChildTreeViewNodeByIndex(winrt::TreeViewNode const& node, unsigned int childIndex);
-    int CountDescendants(const winrt::TreeViewNode& value);
-    void AddNodeToView(const winrt::TreeViewNode& value, unsigned int index);
-    int AddNodeDescendantsToView(const winrt::TreeViewNode& value, unsigned int index, int offset);
-    void RemoveNodeAndDescendantsFromView(const winrt::TreeViewNode& value);
-    void RemoveNodesAndDescendentsWithFlatIndexRange(unsigned int startIndex, unsigned int stopIndex);
-    int GetNextIndexInFlatTree(const winrt::TreeViewNode& indexNode);
-    unsigned int IndexOfNextSibling(winrt::TreeViewNode& childNode);
-    unsigned int GetExpandedDescendantCount(winrt::TreeViewNode& parentNode);
+    void InsertNodesIntoView(unsigned int index, std::vector<winrt::TreeViewNode> const& nodes);
+    void RemoveNodesFromView(unsigned int index, unsigned int count);
+    void HookNodeEvents(FlattenedTree::Entry& entry);
+    void UnhookNodeEvents(FlattenedTree::Entry& entry, bool useSafeGet = false);
+    void AppendVisibleDescendants(winrt::TreeViewNode const& value, std::vector<winrt::TreeViewNode>& nodes);
+    bool TryGetChildrenStartIndex(winrt::TreeViewNode const& parentNode, unsigned int& index);
+    unsigned int IndexOfChildInFlatTree(winrt::TreeViewNode const& parentNode, unsigned int childrenStartIndex, unsigned int childIndex);
     void UpdateNodeSelection(winrt::TreeViewNode const& selectNode, TreeNodeSelectionState const& selectionState);
     void UpdateSelectionStateOfDescendants(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState);
     void UpdateSelectionStateOfAncestors(winrt::TreeViewNode const& targetNode);
@@ -0,0 +1,212 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "StructuredTrace.h"
+#include <mutex>
+
+namespace
+{
+    // Must be a power of two.
+    constexpr uint64_t c_ringCapacity = 4096;
+
+    struct TraceEventDescriptor
+    {
+        PCWSTR name;
+        PCWSTR intNames[2];
+        PCWSTR floatNames[3];
+    };
+
+    // Indexed by TraceEventId. A null name means that payload field is not used.
+    constexpr TraceEventDescriptor c_descriptors[] =
+    {
+        { L"EventsDropped", { L"count", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"RepeaterMeasureBegin", { nullptr, nullptr }, { L"availableWidth", L"availableHeight", nullptr } },
+        { L"RepeaterMeasureEnd", { L"realizedCount", nullptr }, { L"desiredWidth", L"desiredHeight", nullptr } },
+        { L"RepeaterArrangeBegin", { nullptr, nullptr }, { L"finalWidth", L"finalHeight", nullptr } },
+        { L"RepeaterArrangeEnd", { L"touchedCount", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"RepeaterElementCreated", { L"index", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"RepeaterElementRecycled", { L"index", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"RepeaterElementCleared", { L"index", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"ScrollerStateChanged", { L"state", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"ScrollerViewChanged", { nullptr, nullptr }, { L"horizontalOffset", L"verticalOffset", L"zoomFactor" } },
+        { L"ScrollerViewChangeCompleted", { L"viewChangeId", L"result" }, { nullptr, nullptr, nullptr } },
+        { L"ScrollViewerStateChanged", { L"state", nullptr }, { nullptr, nullptr, nullptr } },
+        { L"ScrollViewerViewChanged", { nullptr, nullptr }, { L"horizontalOffset", L"verticalOffset", L"zoomFactor" } },
+    };
+    static_assert(ARRAYSIZE(c_descriptors) == static_cast<size_t>(TraceEventId::Count), "Every TraceEventId needs a descriptor.");
+
+    // Single producer ring. The owning thread is the only writer, Drain may read it from any thread.
+    // Each slot carries the sequence number of the event it holds, so a reader can tell when the
+    // writer lapped it while it was copying the slot.
+    struct TraceRing
+    {
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{ 0 };
+            TraceEvent event{};
+        };
+
+        std::atomic<uint64_t> head{ 0 };
+        uint64_t tail{ 0 };     // Only used by Drain, under s_ringsLock.
+        uint32_t threadId{ ::GetCurrentThreadId() };
+        Slot slots[c_ringCapacity]{};
+    };
+
+    std::mutex s_ringsLock;
+    std::vector<std::unique_ptr<TraceRing>> s_rings;
+    thread_local TraceRing* t_ring{ nullptr };
+
+    TraceRing* GetRingForCurrentThread() noexcept
+    {
+        if (!t_ring)
+        {
+            // Rings are never freed so that Drain can still read events of threads that went away.
+            try
+            {
+                auto ring = std::make_unique<TraceRing>();
+                std::lock_guard<std::mutex> lock(s_ringsLock);
+                s_rings.push_back(std::move(ring));
+                t_ring = s_rings.back().get();
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        return t_ring;
+    }
+}
+
+std::atomic<bool> StructuredTrace::s_isEnabled{ false };
+
+/* static */
+void StructuredTrace::IsEnabled(bool value)
+{
+    s_isEnabled.store(value, std::memory_order_relaxed);
+}
+
+/* static */
+void StructuredTrace::Write(
+    TraceEventId id,
+    const void* sender,
+    int32_t int0,
+    int32_t int1,
+    float float0,
+    float float1,
+    float float2) noexcept
+{
+    if (auto ring = GetRingForCurrentThread())
+    {
+        LARGE_INTEGER timestamp{};
+        ::QueryPerformanceCounter(&timestamp);
+
+        const auto index = ring->head.load(std::memory_order_relaxed);
+        auto& slot = ring->slots[index & (c_ringCapacity - 1)];
+
+        // Invalidate the slot before overwriting it so that a concurrent Drain drops it.
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.event = { timestamp.QuadPart, sender, ring->threadId, id, { int0, int1 }, { float0, float1, float2 } };
+
+        slot.sequence.store(index + 1, std::memory_order_release);
+        ring->head.store(index + 1, std::memory_order_release);
+    }
+}
+
+/* static */
+void StructuredTrace::Drain(std::vector<TraceEvent>& events)
+{
+    const auto firstNewEvent = events.size();
+    {
+        std::lock_guard<std::mutex> lock(s_ringsLock);
+        for (auto& ring : s_rings)
+        {
+            const auto head = ring->head.load(std::memory_order_acquire);
+            auto index = std::max(ring->tail, head > c_ringCapacity ? head - c_ringCapacity : 0);
+            uint64_t dropped = index - ring->tail;
+            const auto firstRingEvent = events.size();
+
+            for (; index < head; ++index)
+            {
+                const auto& slot = ring->slots[index & (c_ringCapacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != index + 1)
+                {
+                    ++dropped;
+                    continue;
+                }
+
+                const auto event = slot.event;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) != index + 1)
+                {
+                    ++dropped;
+                    continue;
+                }
+
+                events.push_back(event);
+            }
+
+            if (dropped > 0)
+            {
+                // Report the gap right before the oldest event we still have for this thread.
+                TraceEvent droppedEvent{};
+                droppedEvent.timestamp = events.size() > firstRingEvent ? events[firstRingEvent].timestamp : 0;
+                droppedEvent.threadId = ring->threadId;
+                droppedEvent.id = TraceEventId::EventsDropped;
+                droppedEvent.ints[0] = static_cast<int32_t>(std::min<uint64_t>(dropped, INT32_MAX));
+                events.insert(events.begin() + firstRingEvent, droppedEvent);
+            }
+
+            ring->tail = head;
+        }
+    }
+
+    std::stable_sort(events.begin() + firstNewEvent, events.end(), [](const TraceEvent& lhs, const TraceEvent& rhs)
+    {
+        return lhs.timestamp < rhs.timestamp;
+    });
+}
+
+/* static */
+std::wstring StructuredTrace::Format(const TraceEvent& event)
+{
+    static const int64_t s_frequency = []()
+    {
+        LARGE_INTEGER frequency{};
+        ::QueryPerformanceFrequency(&frequency);
+        return frequency.QuadPart;
+    }();
+
+    const auto& descriptor = c_descriptors[static_cast<size_t>(event.id) < ARRAYSIZE(c_descriptors) ? static_cast<size_t>(event.id) : 0];
+    WCHAR buffer[256]{};
+    StringCchPrintfW(buffer, ARRAYSIZE(buffer), L"%.3f [%u] %ls %p",
+        static_cast<double>(event.timestamp) * 1000.0 / static_cast<double>(s_frequency),
+        event.threadId,
+        descriptor.name,
+        event.sender);
+    std::wstring result{ buffer };
+
+    for (size_t i = 0; i < ARRAYSIZE(descriptor.intNames); ++i)
+    {
+        if (descriptor.intNames[i])
+        {
+            StringCchPrintfW(buffer, ARRAYSIZE(buffer), L" %ls=%d", descriptor.intNames[i], event.ints[i]);
+            result += buffer;
+        }
+    }
+
+    for (size_t i = 0; i < ARRAYSIZE(descriptor.floatNames); ++i)
+    {
+        if (descriptor.floatNames[i])
+        {
+            StringCchPrintfW(buffer, ARRAYSIZE(buffer), L" %ls=%.2f", descriptor.floatNames[i], event.floats[i]);
+            result += buffer;
+        }
+    }
+
+    return result;
+}
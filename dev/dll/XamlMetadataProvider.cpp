@@ -8,10 +8,20 @@
 #include "MUXControlsFactory.h"
 
 std::vector<XamlMetadataProvider::Entry>* XamlMetadataProvider::s_types{ nullptr };
+std::unordered_map<std::wstring_view, size_t>* XamlMetadataProvider::s_typeIndex{ nullptr };
+std::once_flag XamlMetadataProvider::s_registerTypesOnce{};
 
 XamlMetadataProvider::XamlMetadataProvider()
 {
-    RegisterTypes();
+    // The registrations are process-wide, so only the first provider instance needs to
+    // run them. Every later instance shares the same entries and index. Providers can be
+    // created on more than one thread, so the entries and index are built under call_once
+    // and never modified afterwards.
+    std::call_once(s_registerTypesOnce, [this]()
+    {
+        RegisterTypes();
+        BuildTypeIndex();
+    });
 }
 
 void XamlMetadataProvider::Initialize()
@@ -35,21 +45,40 @@ bool XamlMetadataProvider::RegisterXamlType(
     return true;
 }
 
+void XamlMetadataProvider::BuildTypeIndex()
+{
+    if (!s_types)
+    {
+        return;
+    }
+
+    auto index = new std::unordered_map<std::wstring_view, size_t>();
+    index->reserve(s_types->size());
+
+    for (size_t i = 0; i < s_types->size(); i++)
+    {
+        // The key views the entry's hstring buffer, which does not move when the vector
+        // reallocates. emplace keeps the first registration for a name.
+        index->emplace(static_cast<std::wstring_view>(s_types->at(i).typeName), i);
+    }
+
+    s_typeIndex = index;
+}
+
 winrt::IXamlType XamlMetadataProvider::GetXamlType(
     const wstring_view& typeName)
 {
-    if (s_types)
+    if (s_typeIndex)
     {
-        for (auto& entry : *s_types)
+        auto const it = s_typeIndex->find(static_cast<std::wstring_view>(typeName));
+        if (it != s_typeIndex->end())
         {
-            if (typeName == entry.typeName)
+            auto& entry = s_types->at(it->second);
+            if (!entry.xamlType)
             {
-                if (!entry.xamlType)
-                {
-                    entry.xamlType = entry.createXamlTypeCallback();
-                }
-                return entry.xamlType;
+                entry.xamlType = entry.createXamlTypeCallback();
             }
+            return entry.xamlType;
         }
     }
 
@@ -55,7 +55,14 @@ private:
         winrt::IXamlType xamlType;
     };
 
+    // Builds the name -> s_types position lookup used by GetXamlType. Only called once, from the
+    // first provider's constructor after RegisterTypes. The IXamlType for an entry is still only
+    // created the first time it is asked for.
+    static void BuildTypeIndex();
+
     // Defined as raw pointer so it doesn't have an initializer, this way we can control when it's initialized relative to other globals.
     // TODO: will clean this up with MSFT:9427272 - Codegen the IXamlMetadataProvider stuff
     static std::vector<Entry>* s_types;
+    static std::unordered_map<std::wstring_view, size_t>* s_typeIndex;
+    static std::once_flag s_registerTypesOnce;
 };
@@ -47,8 +47,11 @@
 
 // STL
 #include <vector>
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <functional>
+#include <mutex>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -0,0 +1,70 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <atomic>
+
+// Events recorded by StructuredTrace. The meaning of each payload field is described
+// by the matching entry in StructuredTrace.cpp, which is only used when formatting.
+enum class TraceEventId : uint16_t
+{
+    EventsDropped,
+    RepeaterMeasureBegin,
+    RepeaterMeasureEnd,
+    RepeaterArrangeBegin,
+    RepeaterArrangeEnd,
+    RepeaterElementCreated,
+    RepeaterElementRecycled,
+    RepeaterElementCleared,
+    ScrollerStateChanged,
+    ScrollerViewChanged,
+    ScrollerViewChangeCompleted,
+    ScrollViewerStateChanged,
+    ScrollViewerViewChanged,
+    Count
+};
+
+struct TraceEvent
+{
+    int64_t timestamp{};        // QueryPerformanceCounter ticks.
+    const void* sender{};
+    uint32_t threadId{};
+    TraceEventId id{};
+    int32_t ints[2]{};
+    float floats[3]{};
+};
+
+// Low overhead tracing that records fixed size binary events instead of formatted strings.
+// Each thread writes into its own ring buffer without taking locks, the oldest events get
+// overwritten when a ring is full. Nothing is formatted until the events are drained, which
+// makes it cheap enough to leave on while capturing layout and scrolling timelines.
+class StructuredTrace
+{
+public:
+    static bool IsEnabled() { return s_isEnabled.load(std::memory_order_relaxed); }
+    static void IsEnabled(bool value);
+
+    static void Write(
+        TraceEventId id,
+        const void* sender,
+        int32_t int0 = 0,
+        int32_t int1 = 0,
+        float float0 = 0.0f,
+        float float1 = 0.0f,
+        float float2 = 0.0f) noexcept;
+
+    // Appends the events recorded on all threads since the previous call, in timestamp order.
+    static void Drain(std::vector<TraceEvent>& events);
+    static std::wstring Format(const TraceEvent& event);
+
+private:
+    static std::atomic<bool> s_isEnabled;
+};
+
+#define MUX_TRACE_EVENT(id, sender, ...) \
+if (StructuredTrace::IsEnabled()) \
+{ \
+    StructuredTrace::Write(TraceEventId::id, sender, __VA_ARGS__); \
+} \
+
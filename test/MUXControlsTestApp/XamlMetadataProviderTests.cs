@@ -0,0 +1,79 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+
+using MUXControlsTestApp.Utilities;
+
+using Windows.UI.Xaml;
+using Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+using ColorPicker = Microsoft.UI.Xaml.Controls.ColorPicker;
+using XamlControlsXamlMetaDataProvider = Microsoft.UI.Xaml.XamlTypeInfo.XamlControlsXamlMetaDataProvider;
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
+{
+    // XamlControlsXamlMetaDataProvider does not exist in the OS repo,
+    // so we can't execute these tests as authored there.
+    [TestClass]
+    public class XamlMetadataProviderTests
+    {
+        [TestMethod]
+        public void VerifyTypeLookupForAllPublicTypes()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var typeNames = GetPublicTypeNames();
+                Log.Comment("Resolving {0} type names", typeNames.Count);
+
+                var provider = new XamlControlsXamlMetaDataProvider();
+
+                // The first pass creates each IXamlType, the second only pays for the lookup.
+                var stopwatch = Stopwatch.StartNew();
+                int resolved = typeNames.Count(name => provider.GetXamlType(name) != null);
+                stopwatch.Stop();
+                Log.Comment("Cold lookup: {0} resolved in {1} ms", resolved, stopwatch.Elapsed.TotalMilliseconds);
+
+                const int iterations = 100;
+                stopwatch.Restart();
+                for (int i = 0; i < iterations; i++)
+                {
+                    foreach (var name in typeNames)
+                    {
+                        provider.GetXamlType(name);
+                    }
+                }
+                stopwatch.Stop();
+                Log.Comment("Warm lookup: {0} us per pass", stopwatch.Elapsed.TotalMilliseconds * 1000 / iterations);
+
+                Verify.IsGreaterThan(resolved, 0);
+                Verify.IsNull(provider.GetXamlType("Microsoft.UI.Xaml.Controls.NotARealType"));
+
+                // A second provider shares the registrations with the first one.
+                var otherProvider = new XamlControlsXamlMetaDataProvider();
+                var colorPickerName = typeof(ColorPicker).FullName;
+                Verify.AreSame(provider.GetXamlType(colorPickerName), otherProvider.GetXamlType(colorPickerName));
+            });
+        }
+
+        private static List<string> GetPublicTypeNames()
+        {
+            return typeof(ColorPicker).Assembly.GetExportedTypes()
+                .Where(t => t.Namespace != null && t.Namespace.StartsWith("Microsoft.UI.Xaml"))
+                .Select(t => t.FullName)
+                .ToList();
+        }
+    }
+}